@@ -0,0 +1,175 @@
+#include "BenchHarness.h"
+
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QSysInfo>
+#include <QTextStream>
+#include <QThread>
+#include <QtMath>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace Bench {
+
+qint64 Result::percentile(double p) const
+{
+    if (samples.isEmpty()) return 0;
+    // 最近秩法：第ceil(p * n)个样本
+    const int rank = qBound(1, qCeil(p * samples.size()), int(samples.size()));
+    return samples[rank - 1];
+}
+
+QJsonObject Result::toJson() const
+{
+    qint64 total = 0;
+    for (qint64 sample : samples) total += sample;
+    const qint64 median = percentile(0.5);
+
+    QJsonObject object;
+    object["name"] = name;
+    object["size"] = size;
+    object["items"] = items;
+    object["iterations"] = int(samples.size());
+    object["mean_ns"] = samples.isEmpty() ? 0.0 : double(total) / samples.size();
+    object["min_ns"] = samples.isEmpty() ? 0 : samples.first();
+    object["p50_ns"] = median;
+    object["p90_ns"] = percentile(0.9);
+    object["p99_ns"] = percentile(0.99);
+    object["max_ns"] = samples.isEmpty() ? 0 : samples.last();
+    object["items_per_second"] = median > 0 ? items * 1e9 / median : 0.0;
+    if (!error.isEmpty()) object["error"] = error;
+    return object;
+}
+
+Runner::Runner(int minIterations, double minSeconds, int maxIterations)
+    : m_minIterations(qMax(1, minIterations)),
+      m_minSeconds(minSeconds),
+      m_maxIterations(qMax(m_minIterations, maxIterations))
+{
+}
+
+bool Runner::enabled(const QString &name) const
+{
+    return m_filter.isEmpty() || name.contains(m_filter);
+}
+
+const Result &Runner::run(const QString &name, qint64 size, qint64 items,
+                          const std::function<void()> &body, const std::function<void()> &setup)
+{
+    Result result;
+    result.name = name;
+    result.size = size;
+    result.items = items;
+
+    QElapsedTimer total;
+    total.start();
+    QElapsedTimer timer;
+    m_failure.clear();
+    while (result.samples.size() < m_maxIterations &&
+           (result.samples.size() < m_minIterations || total.elapsed() < m_minSeconds * 1000)) {
+        if (setup) setup();
+        timer.start();
+        body();
+        const qint64 elapsed = timer.nsecsElapsed();
+        if (!m_failure.isEmpty()) {
+            result.error = m_failure;
+            break;
+        }
+        result.samples.append(elapsed);
+    }
+    std::sort(result.samples.begin(), result.samples.end());
+
+    if (!result.error.isEmpty()) {
+        QTextStream(stderr) << QString("%1  size=%2  FAILED: %3\n")
+                                   .arg(name, -36)
+                                   .arg(size)
+                                   .arg(result.error);
+        m_results.append(result);
+        return m_results.last();
+    }
+
+    // 进度写到stderr，stdout只留给JSON
+    const qint64 median = result.percentile(0.5);
+    QTextStream(stderr) << QString("%1  size=%2  p50=%3ms  p99=%4ms  %5 items/s\n")
+                               .arg(name, -36)
+                               .arg(size)
+                               .arg(median / 1e6, 0, 'f', 3)
+                               .arg(result.percentile(0.99) / 1e6, 0, 'f', 3)
+                               .arg(median > 0 ? items * 1e9 / median : 0.0, 0, 'g', 4);
+
+    m_results.append(result);
+    return m_results.last();
+}
+
+QJsonObject Runner::report(const QJsonObject &context) const
+{
+    QJsonArray benchmarks;
+    for (const Result &result : m_results) benchmarks.append(result.toJson());
+
+    QJsonObject root;
+    root["context"] = context;
+    root["benchmarks"] = benchmarks;
+    return root;
+}
+
+QJsonObject environment()
+{
+    QJsonObject context;
+    context["date"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+    context["qt_version"] = QString(qVersion());
+    context["cpu_architecture"] = QSysInfo::currentCpuArchitecture();
+    context["os"] = QSysInfo::prettyProductName();
+    context["num_cpus"] = QThread::idealThreadCount();
+#ifdef NDEBUG
+    context["build_type"] = QString("release");
+#else
+    context["build_type"] = QString("debug");
+#endif
+    return context;
+}
+
+KLineColumns syntheticBars(qint64 count, quint32 seed)
+{
+    std::mt19937 random(seed);
+    std::normal_distribution<double> returns(0, 0.001);
+    std::uniform_real_distribution<double> range(0, 0.002);
+    std::uniform_real_distribution<double> volumes(100, 10000);
+
+    KLineColumns bars;
+    bars.reserve(int(count));
+    qint64 time = KLineTime::daysFromCivil(2020, 1, 2) * KLineTime::kDayMs +
+                  (9 * 60 + 30) * KLineTime::kMinuteMs;
+    double price = 100;
+    for (qint64 i = 0; i < count; ++i) {
+        const double open = price;
+        const double close = qMax(0.01, open * (1 + returns(random)));
+        const double high = qMax(open, close) * (1 + range(random));
+        const double low = qMin(open, close) * (1 - range(random));
+        const double volume = std::floor(volumes(random));
+        bars.append(time, open, high, low, close, volume, volume * close, 0);
+        price = close;
+        time += KLineTime::kMinuteMs;
+    }
+    return bars;
+}
+
+QVector<qint64> parseCounts(const QString &text)
+{
+    QVector<qint64> counts;
+    for (QString item : text.split(',', Qt::SkipEmptyParts)) {
+        item = item.trimmed().toLower();
+        qint64 multiplier = 1;
+        if (item.endsWith('k')) multiplier = 1000;
+        if (item.endsWith('m')) multiplier = 1000000;
+        if (item.endsWith('g')) multiplier = 1000000000;
+        if (multiplier > 1) item.chop(1);
+
+        bool ok = false;
+        const double value = item.toDouble(&ok);
+        if (ok && value > 0) counts.append(qint64(value * multiplier));
+    }
+    return counts;
+}
+
+}  // namespace Bench
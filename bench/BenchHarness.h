@@ -0,0 +1,79 @@
+#ifndef BENCHHARNESS_H
+#define BENCHHARNESS_H
+
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QString>
+#include <QVector>
+#include <functional>
+
+#include "core/KLineColumns.h"
+
+// 基准测试共用的计时框架：每个用例重复运行，记录每次耗时，
+// 输出中位数、百分位和吞吐量，结果以JSON汇总，便于发布前与基线对比。
+namespace Bench {
+
+struct Result
+{
+    QString name;
+    qint64 size = 0;   // 数据集K线数
+    qint64 items = 0;  // 单次运行处理的元素数，用于计算吞吐量
+    QVector<qint64> samples;  // 每次运行的纳秒数，已排序
+    QString error;            // 非空表示用例失败，samples不含失败的那次
+
+    qint64 percentile(double p) const;
+    QJsonObject toJson() const;
+};
+
+class Runner
+{
+public:
+    // 每个用例至少运行minIterations次，并且累计至少minSeconds秒（不超过maxIterations次）
+    Runner(int minIterations = 5, double minSeconds = 0.5, int maxIterations = 1000);
+
+    // setup不计时，在每次运行前调用，例如恢复被修改的输入
+    const Result &run(const QString &name, qint64 size, qint64 items,
+                      const std::function<void()> &body,
+                      const std::function<void()> &setup = nullptr);
+    // 在body中调用：丢弃本次计时，停止当前用例并把它记为失败
+    void fail(const QString &reason) { m_failure = reason; }
+    // 名称中包含filter的用例才运行，filter为空表示全部
+    bool enabled(const QString &name) const;
+    void setFilter(const QString &filter) { m_filter = filter; }
+
+    const QVector<Result> &results() const { return m_results; }
+    QJsonObject report(const QJsonObject &context) const;
+
+private:
+    int m_minIterations;
+    double m_minSeconds;
+    int m_maxIterations;
+    QString m_filter;
+    QString m_failure;
+    QVector<Result> m_results;
+};
+
+// 运行环境：Qt版本、CPU核数、构建类型、时间，写入JSON的context
+QJsonObject environment();
+
+// 从2020-01-02 09:30开始逐分钟的随机游走1分钟K线，seed相同时数据相同
+KLineColumns syntheticBars(qint64 count, quint32 seed = 42);
+
+// 解析"10k,1m,100m"形式的数量列表，k/m/g分别为10^3/10^6/10^9
+QVector<qint64> parseCounts(const QString &text);
+
+// 防止编译器把结果未被使用的计算优化掉
+template <typename T>
+inline void doNotOptimize(const T &value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+}
+
+}  // namespace Bench
+
+#endif  // BENCHHARNESS_H
@@ -0,0 +1,387 @@
+// 端到端基准测试：CSV解析 -> 周期合成 -> 指标计算 -> 交给QML的窗口数据 -> 离屏绘制一帧。
+//
+// kline_bench [--sizes 10k,100k,1m] [--csv-max 1m] [--iterations 5] [--min-time 0.5]
+//             [--filter 名称片段] [--frame 1920x1080] [--out result.json] [--trace trace.json]
+//
+// 数据集为随机游走的1分钟K线，--sizes可以到100m（约6.4GB内存）；超过--csv-max的数据集
+// 跳过需要CSV文本的用例。结果JSON写到--out或stdout，进度写到stderr。
+// 指标用例另有单精度(TA_S_*)版本，JSON的accuracy字段是单精度相对双精度的误差。
+
+#include <QCommandLineParser>
+#include <QEventLoop>
+#include <QFile>
+#include <QGuiApplication>
+#include <QImage>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QLoggingCategory>
+#include <QPainter>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QTimer>
+#include <cmath>
+
+#include "BenchHarness.h"
+#include "chart/KLineChartRenderer.h"
+#include "core/KLineCsv.h"
+#include "core/KLineDataProvider.h"
+#include "core/KLineIndicators.h"
+#include "core/KLineSnapshotCache.h"
+#include "core/KLineTrace.h"
+
+namespace {
+
+// KLineDataWorker::getPeriodMinutes支持的全部时间周期
+const QStringList kPeriods = {"1m", "5m", "15m", "30m", "1h", "4h", "1d"};
+// 端到端和绘制用例使用的指标
+const QStringList kFrameIndicators = {"MA", "BBANDS", "OBV"};
+constexpr int kVisibleBars = 500;
+constexpr int kLoadTimeoutMs = 10 * 60 * 1000;
+
+QString toCsv(const KLineColumns &bars)
+{
+    QString csv;
+    csv.reserve(bars.size() * 72);
+    csv += "时间,开盘,最高,最低,收盘,成交量,成交额\n";
+    for (int i = 0; i < bars.size(); ++i) {
+        csv += KLineTime::format(bars.time[i]);
+        for (double value : {bars.open[i], bars.high[i], bars.low[i], bars.close[i],
+                             bars.volume[i], bars.turnover[i]}) {
+            csv += ',';
+            csv += QString::number(value, 'f', 2);
+        }
+        csv += '\n';
+    }
+    return csv;
+}
+
+// 当前线程同步调用worker，与界面走完全相同的合成代码
+KLineColumns synthesize(const KLineColumns &bars, const QString &period,
+                        const QStringList &indicators, KLineSeriesMap *series = nullptr)
+{
+    KLineDataWorker worker;
+    worker.setIndicators(indicators);
+    KLineColumns result;
+    QObject::connect(&worker, &KLineDataWorker::dataProcessed,
+                     [&](int, const KLineColumns &output, const KLineSeriesMap &outputSeries) {
+                         result = output;
+                         if (series) *series = outputSeries;
+                     });
+    worker.processData(KLineDataWorker::kNoGeneration, bars, period);
+    return result;
+}
+
+void renderFrame(const KLineColumns &bars, const KLineSeriesMap &series, int viewStart,
+                 int viewCount, QImage &image)
+{
+    KLineChartRenderer renderer(bars, series);
+    renderer.setIndicators(kFrameIndicators);
+    renderer.setView(viewStart, viewCount);
+    QPainter painter(&image);
+    renderer.render(&painter, QRectF(QPointF(0, 0), QSizeF(image.size())));
+}
+
+void benchCsv(Bench::Runner &runner, const KLineColumns &bars, const QString &csv)
+{
+    const QString name = "csv/parse";
+    if (!runner.enabled(name)) return;
+
+    KLineColumns parsed;
+    KLineTicks ticks;
+    runner.run(name, bars.size(), bars.size(), [&]() {
+        KLineCsv::parse(csv, parsed, ticks);
+        Bench::doNotOptimize(parsed);
+    });
+}
+
+void benchSynthesis(Bench::Runner &runner, const KLineColumns &bars)
+{
+    for (const QString &period : kPeriods) {
+        const QString name = "synthesize/" + period;
+        if (!runner.enabled(name)) continue;
+
+        runner.run(name, bars.size(), bars.size(), [&]() {
+            const KLineColumns result = synthesize(bars, period, {});
+            Bench::doNotOptimize(result);
+        });
+    }
+}
+
+void benchIndicators(Bench::Runner &runner, const KLineColumns &bars)
+{
+    const QStringList names = KLineIndicators::names();
+    // 单精度模式与应用相同：镜像在数据集生成时建立一次（这里在计时之外），计时只包含指标本身
+    KLineColumns single = bars;
+    single.buildSingle();
+    for (const KLineIndicators::Precision precision :
+         {KLineIndicators::Double, KLineIndicators::Float}) {
+        const bool isFloat = precision == KLineIndicators::Float;
+        const QString prefix = isFloat ? "indicators_f32/" : "indicators/";
+        const KLineColumns &input = isFloat ? single : bars;
+        KLineIndicators::setPrecision(precision);
+
+        for (const QString &indicator : names) {
+            const QString name = prefix + indicator;
+            if (!runner.enabled(name)) continue;
+
+            runner.run(name, bars.size(), bars.size(), [&]() {
+                KLineSeriesMap out;
+                KLineIndicators::compute(indicator, input, out);
+                Bench::doNotOptimize(out);
+            });
+        }
+
+        // 界面切换数据集时一次性计算的整批指标
+        if (runner.enabled(prefix + "batch")) {
+            runner.run(prefix + "batch", bars.size(), bars.size() * names.size(), [&]() {
+                KLineSeriesMap out;
+                for (const QString &indicator : names) {
+                    KLineIndicators::compute(indicator, input, out);
+                }
+                Bench::doNotOptimize(out);
+            });
+        }
+    }
+    KLineIndicators::setPrecision(KLineIndicators::Double);
+}
+
+// 单精度指标相对双精度的误差，每个输出序列一项：
+// max_abs为最大绝对误差，max_rel为max_abs除以双精度序列的最大绝对值，
+// nan_mismatch为只有一边是NaN的位置数
+QJsonArray indicatorAccuracy(const KLineColumns &bars)
+{
+    KLineColumns mirrored = bars;
+    mirrored.buildSingle();
+    KLineSeriesMap reference, single;
+    for (const QString &indicator : KLineIndicators::names()) {
+        KLineIndicators::setPrecision(KLineIndicators::Double);
+        KLineIndicators::compute(indicator, bars, reference);
+        KLineIndicators::setPrecision(KLineIndicators::Float);
+        KLineIndicators::compute(indicator, mirrored, single);
+    }
+    KLineIndicators::setPrecision(KLineIndicators::Double);
+
+    QJsonArray rows;
+    for (auto it = reference.cbegin(); it != reference.cend(); ++it) {
+        const QVector<double> &expected = it.value();
+        const QVector<double> actual = single.value(it.key());
+        double maxAbs = 0, scale = 0;
+        int nanMismatch = 0;
+        for (int i = 0; i < expected.size() && i < actual.size(); ++i) {
+            if (std::isnan(expected[i]) != std::isnan(actual[i])) {
+                ++nanMismatch;
+                continue;
+            }
+            if (std::isnan(expected[i])) continue;
+            maxAbs = qMax(maxAbs, std::abs(actual[i] - expected[i]));
+            scale = qMax(scale, std::abs(expected[i]));
+        }
+
+        QJsonObject row;
+        row["name"] = it.key();
+        row["size"] = bars.size();
+        row["max_abs"] = maxAbs;
+        row["max_rel"] = scale > 0 ? maxAbs / scale : 0.0;
+        row["nan_mismatch"] = nanMismatch;
+        rows.append(row);
+        QTextStream(stderr) << "accuracy/" << it.key() << ": max_abs " << maxAbs << ", max_rel "
+                            << row["max_rel"].toDouble() << ", nan_mismatch " << nanMismatch
+                            << "\n";
+    }
+    return rows;
+}
+
+// 经由KLineDataProvider的完整链路：读文件、解析、后台合成和指标、发布窗口，再画出第一帧。
+// 快照缓存指向临时目录：CSV用例关闭缓存，每次都解析CSV；快照用例先同步写好快照，
+// 每次都从快照加载，两条路径分开计时
+void benchProvider(Bench::Runner &runner, const KLineColumns &bars, const QString &csv,
+                   const QSize &frameSize)
+{
+    const bool endToEnd = runner.enabled("end_to_end/load_to_first_frame");
+    const bool fromSnapshot = runner.enabled("end_to_end/snapshot_to_first_frame");
+    const bool handoff = runner.enabled("handoff/window");
+    if (!endToEnd && !fromSnapshot && !handoff) return;
+
+    QTemporaryDir dir;
+    const QString path = dir.filePath("bench.csv");
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) return;
+    file.write(csv.toUtf8());
+    file.close();
+    KLineSnapshotCache::setCacheDir(dir.filePath("snapshots"));
+    KLineSnapshotCache::setEnabled(false);
+
+    KLineDataProvider provider;
+    provider.setIndicators(kFrameIndicators);
+    provider.setCsvFile(path);
+    provider.setKlinePeriod("5m");
+
+    // 超时返回false
+    auto load = [&provider]() {
+        QEventLoop loop;
+        QTimer timeout;
+        timeout.setSingleShot(true);
+        QObject::connect(&provider, &KLineDataProvider::dataLoaded, &loop, &QEventLoop::quit);
+        QObject::connect(&timeout, &QTimer::timeout, &loop, &QEventLoop::quit);
+        timeout.start(kLoadTimeoutMs);
+        provider.loadData();
+        loop.exec();
+        return timeout.isActive();
+    };
+
+    QImage image(frameSize, QImage::Format_ARGB32_Premultiplied);
+    auto loadToFirstFrame = [&]() {
+        if (!load()) {
+            runner.fail("load timed out");
+            return;
+        }
+        const KLineColumns window = provider.windowBars();
+        KLineSeriesMap series;
+        const QStringList keys = {"MA", "BBANDS.upper", "BBANDS.middle", "BBANDS.lower", "OBV"};
+        for (const QString &key : keys) series.insert(key, provider.windowSeries(key));
+        const int count = qMin(kVisibleBars, window.size());
+        renderFrame(window, series, window.size() - count, count, image);
+    };
+
+    if (endToEnd) {
+        runner.run("end_to_end/load_to_first_frame", bars.size(), bars.size(), loadToFirstFrame);
+    }
+
+    if (fromSnapshot) {
+        // 快照内容与界面第一次加载后写入的相同：解析同一个CSV得到的分钟K线
+        KLineColumns parsed;
+        KLineTicks ticks;
+        QString error;
+        KLineSnapshotCache::setEnabled(true);
+        if (KLineCsv::readFile(path, parsed, ticks, &error) &&
+            KLineSnapshotCache::write(path, parsed, &error)) {
+            runner.run("end_to_end/snapshot_to_first_frame", bars.size(), bars.size(),
+                       loadToFirstFrame);
+        } else {
+            QTextStream(stderr) << "无法写入快照: " << error << "\n";
+        }
+        KLineSnapshotCache::setEnabled(false);
+    }
+
+    // 交给QML的窗口：在历史两端之间来回跳转，每次都切片并重建QVariantList
+    if (handoff && provider.totalCount() == 0) load();
+    if (handoff && provider.totalCount() > 0) {
+        bool atStart = false;
+        runner.run("handoff/window", bars.size(), qMax(1, provider.windowBars().size()), [&]() {
+            atStart = !atStart;
+            provider.ensureWindow(atStart ? 0 : provider.totalCount() - kVisibleBars,
+                                  kVisibleBars);
+            Bench::doNotOptimize(provider.data());
+        });
+    }
+    KLineSnapshotCache::setCacheDir(QString());
+}
+
+void benchRender(Bench::Runner &runner, const KLineColumns &bars, const QSize &frameSize)
+{
+    const bool visible = runner.enabled("render/frame_visible");
+    const bool full = runner.enabled("render/frame_full_history");
+    if (!visible && !full) return;
+
+    KLineSeriesMap series;
+    for (const QString &indicator : kFrameIndicators) {
+        KLineIndicators::compute(indicator, bars, series);
+    }
+
+    QImage image(frameSize, QImage::Format_ARGB32_Premultiplied);
+    const int count = qMin(kVisibleBars, bars.size());
+    if (visible) {
+        runner.run("render/frame_visible", bars.size(), count,
+                   [&]() { renderFrame(bars, series, bars.size() - count, count, image); });
+    }
+    // 整个历史挤在一帧内，检验LOD分组让绘制与像素宽度而非K线数相关
+    if (full) {
+        runner.run("render/frame_full_history", bars.size(), bars.size(),
+                   [&]() { renderFrame(bars, series, 0, bars.size(), image); });
+    }
+}
+
+}  // namespace
+
+int main(int argc, char *argv[])
+{
+    // 绘制用例只需要软件光栅化，不依赖显示器
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) qputenv("QT_QPA_PLATFORM", "offscreen");
+    QGuiApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.addOption({"sizes", "数据集K线数列表", "list", "10k,100k,1m"});
+    parser.addOption({"csv-max", "生成CSV文本的最大K线数", "count", "1m"});
+    parser.addOption({"iterations", "每个用例的最少运行次数", "count", "5"});
+    parser.addOption({"min-time", "每个用例的最少运行秒数", "seconds", "0.5"});
+    parser.addOption({"filter", "只运行名称包含该片段的用例", "text"});
+    parser.addOption({"frame", "绘制用例的图片尺寸", "WxH", "1920x1080"});
+    parser.addOption({"out", "JSON结果文件，缺省写到stdout", "file"});
+    parser.addOption({"trace", "同时记录追踪span，写出Chrome trace JSON", "file"});
+    parser.process(app);
+    // 打开追踪会计入每个span的两次取时间戳，对比基准结果时两边的设置要一致
+    KLineTrace::setEnabled(parser.isSet("trace"));
+
+    if (!KLineIndicators::ensureInitialized()) {
+        QTextStream(stderr) << "TA-Lib初始化失败\n";
+        return 1;
+    }
+    // 数据处理链路的调试输出会干扰计时
+    QLoggingCategory::setFilterRules("default.debug=false");
+
+    const QVector<qint64> sizes = Bench::parseCounts(parser.value("sizes"));
+    const QVector<qint64> csvLimit = Bench::parseCounts(parser.value("csv-max"));
+    const qint64 csvMax = csvLimit.isEmpty() ? 0 : csvLimit.first();
+    const QStringList frame = parser.value("frame").split('x');
+    const QSize frameSize = frame.size() == 2 ? QSize(frame[0].toInt(), frame[1].toInt())
+                                              : QSize(1920, 1080);
+
+    Bench::Runner runner(parser.value("iterations").toInt(),
+                         parser.value("min-time").toDouble());
+    runner.setFilter(parser.value("filter"));
+
+    QJsonArray accuracy;
+    for (qint64 size : sizes) {
+        QTextStream(stderr) << "== " << size << " bars ==\n";
+        const KLineColumns bars = Bench::syntheticBars(size);
+        if (size <= csvMax) {
+            const QString csv = toCsv(bars);
+            benchCsv(runner, bars, csv);
+            benchProvider(runner, bars, csv, frameSize);
+        }
+        benchSynthesis(runner, bars);
+        benchIndicators(runner, bars);
+        if (runner.enabled("accuracy")) {
+            for (const QJsonValue &row : indicatorAccuracy(bars)) accuracy.append(row);
+        }
+        benchRender(runner, bars, frameSize);
+    }
+
+    QJsonObject context = Bench::environment();
+    context["executable"] = "kline_bench";
+    context["frame"] = parser.value("frame");
+    QJsonObject report = runner.report(context);
+    if (!accuracy.isEmpty()) report["accuracy"] = accuracy;
+    const QByteArray json = QJsonDocument(report).toJson();
+
+    KLineIndicators::shutdown();
+
+    QString traceError;
+    if (parser.isSet("trace") &&
+        !KLineTrace::exportChromeTrace(parser.value("trace"), &traceError)) {
+        QTextStream(stderr) << "无法写入" << parser.value("trace") << ": " << traceError << "\n";
+    }
+
+    if (parser.isSet("out")) {
+        QFile out(parser.value("out"));
+        if (!out.open(QIODevice::WriteOnly)) {
+            QTextStream(stderr) << "无法写入" << parser.value("out") << "\n";
+            return 1;
+        }
+        out.write(json);
+        return 0;
+    }
+    QTextStream(stdout) << json;
+    return 0;
+}
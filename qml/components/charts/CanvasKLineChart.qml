@@ -1,83 +1,277 @@
+import KLineModule
 import QtQuick
 
 Item {
     id: root
 
     // 对外暴露的属性 - 只接收K线数据
-    property var klineData: []
+    property var klineData: []  // 已加载窗口
+    property int totalCount: klineData.length
+    property int windowOffset: 0
+    property int datasetRevision: 0  // 变化时视为新数据集，视口重置到最新K线
+    property bool hasVolume: false  // 有成交量时在价格图下方显示成交量副图
+    property var overlayIndicators: ["MA"]  // 叠加在价格图上的指标，例如["MA", "BBANDS"]
+    property var indicatorPanes: []  // 指标副图，每个元素是provider的一个指标输出名，例如"MFI"
+    property var provider: null  // KLineDataProvider，供C++绘制组件直接读取列式数据
     property string title: "K线图表 (Canvas绘制)"
+    // 副图高度：每个不超过总高度的20%，副图合计不超过60%
+    property int subPaneCount: (hasVolume ? 1 : 0) + indicatorPanes.length
+    property real subPaneHeight: subPaneCount > 0 ? Math.round(panesHeight * Math.min(0.2, 0.6 / subPaneCount)) : 0
+    property bool showNavigator: true  // 最下方显示整段历史的导航条
+    property real navigatorHeight: showNavigator ? 40 : 0
+    readonly property real panesHeight: height - navigatorHeight
+    property bool showHud: false  // 右上角显示帧时间和延迟HUD
+    // 自上而下的可见窗格，供十字光标和命中测试使用
+    property var panes: [priceArea]
 
-    // 监听数据变化
-    onKlineDataChanged: {
-        if (klineData && klineData.length > 0) {
-            // 初始化显示参数
-            chartBase.startIndex = Math.max(0, klineData.length - chartBase.visibleCount);
+    // 视口接近已加载窗口边缘时发出，由数据加载器换入新窗口
+    signal windowRequested(int startIndex, int visibleCount)
+
+    // 实时行情只更新了第index根K线时调用，只重绘这一列
+    function updateBar(index) {
+        metrics.markTick();
+        canvas.invalidateBar(index);
+    }
+
+    function updatePanes() {
+        var list = [priceArea];
+        if (hasVolume)
+            list.push(volumePane);
+
+        for (var i = 0; i < indicatorRepeater.count; i++) {
+            var pane = indicatorRepeater.itemAt(i);
+            if (pane)
+                list.push(pane);
+
+        }
+        panes = list;
+    }
+
+    onHasVolumeChanged: updatePanes()
+
+    // 新数据集：初始化显示参数
+    onDatasetRevisionChanged: {
+        if (totalCount > 0) {
             chartBase.updateVisibleCount();
-            chartBase.updatePriceRange();
+            chartBase.resetView();
             // 触发重绘
-            canvas.requestPaint();
+            repaintScheduler.invalidate(RepaintScheduler.AllLayers);
         }
     }
 
-    // 基础数据和功能组件
+    // 所有层的重绘请求在这里按帧合并
+    RepaintScheduler {
+        id: repaintScheduler
+
+        onAboutToRepaint: function(fullLayers) {
+            if ((fullLayers & RepaintScheduler.SeriesLayer) && chartBase.klineData.length > 0)
+                chartBase.updatePriceRange();
+
+        }
+        onRepaintLayer: function(layer, rect) {
+            if (layer === RepaintScheduler.OverlayLayer)
+                crosshair.requestPaint();
+            else
+                canvas.paintLayer(layer, rect);
+        }
+    }
+
+    // 基础数据和功能组件，坐标系与价格图一致
     ChartBase {
         id: chartBase
 
-        anchors.fill: parent
+        x: 0
+        y: 0
+        width: root.width
+        height: priceArea.height
         klineData: root.klineData
+        totalCount: root.totalCount
+        windowOffset: root.windowOffset
+        provider: root.provider
+        // 窗格在Column中的位置变化时自动更新
+        paneTops: root.panes.map(function(pane) {
+            return pane.y;
+        })
+        onWindowRequested: function(startIndex, visibleCount) {
+            root.windowRequested(startIndex, visibleCount);
+        }
     }
 
-    Rectangle {
+    // 价格图和各副图自上而下排列，共享chartBase的横轴和视口，纵轴各自独立
+    Column {
         anchors.fill: parent
-        color: "#2b2b2b"
 
-        // Canvas绘制组件
-        KLineCanvas {
-            id: canvas
+        Rectangle {
+            id: priceArea
+
+            // 价格图内纵坐标对应的价格
+            function valueAt(y) {
+                if (chartBase.chartHeight <= 0)
+                    return NaN;
+
+                var ratio = (y - chartBase.topMargin) / chartBase.chartHeight;
+                return chartBase.maxPrice - ratio * (chartBase.maxPrice - chartBase.minPrice);
+            }
+
+            function formatValue(value) {
+                return Number(value).toFixed(2);
+            }
+
+            width: parent.width
+            height: root.panesHeight - root.subPaneHeight * root.subPaneCount
+            color: "#2b2b2b"
+
+            // Canvas绘制组件
+            KLineCanvas {
+                id: canvas
+
+                anchors.fill: parent
+                chartBase: chartBase
+                scheduler: repaintScheduler
+                provider: root.provider
+                overlays: root.overlayIndicators
+            }
+
+            // 标题
+            Text {
+                anchors.top: parent.top
+                anchors.horizontalCenter: parent.horizontalCenter
+                anchors.topMargin: 5
+                text: root.title
+                color: "white"
+                font.pixelSize: 16
+                font.bold: true
+            }
 
-            anchors.fill: parent
-            chartBase: chartBase
         }
 
-        // 交互处理组件
-        ChartInteraction {
-            id: interaction
+        // 成交量副图
+        ChartPane {
+            id: volumePane
 
+            width: parent.width
+            height: root.hasVolume ? root.subPaneHeight : 0
+            visible: root.hasVolume
             chartBase: chartBase
-            canvas: canvas
-        }
+            series: volumeSeries
+            title: "VOL"
+
+            VolumeSeriesItem {
+                id: volumeSeries
+
+                anchors.fill: parent
+                provider: root.provider
+                viewStart: chartBase.viewStart
+                viewCount: chartBase.viewSpan
+            }
 
-        // 标题
-        Text {
-            anchors.top: parent.top
-            anchors.horizontalCenter: parent.horizontalCenter
-            anchors.topMargin: 5
-            text: root.title
-            color: "white"
-            font.pixelSize: 16
-            font.bold: true
         }
 
-        // 工具提示组件
-        ChartTooltip {
-            id: tooltip
+        // 指标副图
+        Repeater {
+            id: indicatorRepeater
 
+            model: root.indicatorPanes
+            onItemAdded: root.updatePanes()
+            onItemRemoved: root.updatePanes()
+
+            ChartPane {
+                width: parent.width
+                height: root.subPaneHeight
+                chartBase: chartBase
+                series: lineSeries
+                title: modelData
+
+                LineSeriesItem {
+                    id: lineSeries
+
+                    anchors.fill: parent
+                    provider: root.provider
+                    series: modelData
+                    viewStart: chartBase.viewStart
+                    viewCount: chartBase.viewSpan
+                }
+
+            }
+
+        }
+
+        // 整段历史的导航条，拖动其中的窗口驱动chartBase的视口
+        ChartNavigator {
+            width: parent.width
+            height: root.navigatorHeight
+            visible: root.showNavigator
             chartBase: chartBase
+            provider: root.provider
         }
 
     }
 
-    // 监听chartBase的数据变化
+    // 交互处理组件，覆盖全部窗格（不含导航条）
+    ChartInteraction {
+        id: interaction
+
+        width: root.width
+        height: root.panesHeight
+        chartBase: chartBase
+        canvas: canvas
+    }
+
+    // 跨窗格十字光标
+    CrosshairOverlay {
+        id: crosshair
+
+        width: root.width
+        height: root.panesHeight
+        chartBase: chartBase
+        panes: root.panes
+    }
+
+    // 工具提示组件
+    ChartTooltip {
+        id: tooltip
+
+        chartBase: chartBase
+    }
+
+    // 帧时间、绘制耗时和延迟的直方图，HUD显示时才记录
+    ChartMetrics {
+        id: metrics
+
+        active: root.showHud
+    }
+
+    ChartHud {
+        anchors.top: parent.top
+        anchors.right: parent.right
+        anchors.margins: 8
+        visible: root.showHud
+        metrics: metrics
+    }
+
+    // 监听chartBase的数据和视口变化（窗口换页时视口保持不变，只需重绘）
     Connections {
         function onKlineDataChanged() {
-            if (chartBase.klineData && chartBase.klineData.length > 0) {
-                // 初始化显示参数
-                chartBase.startIndex = Math.max(0, chartBase.klineData.length - chartBase.visibleCount);
-                chartBase.updateVisibleCount();
-                chartBase.updatePriceRange();
-                // 触发重绘
-                canvas.requestPaint();
-            }
+            if (chartBase.klineData && chartBase.klineData.length > 0)
+                repaintScheduler.invalidate(RepaintScheduler.AllLayers);
+
+        }
+
+        function onStartIndexChanged() {
+            repaintScheduler.invalidate(RepaintScheduler.AllLayers);
+        }
+
+        function onVisibleCountChanged() {
+            repaintScheduler.invalidate(RepaintScheduler.AllLayers);
+        }
+
+        // 小数视口逐帧变化：K线和坐标轴只更新变换和刻度，网格线跟随时间刻度移动
+        function onViewStartChanged() {
+            repaintScheduler.invalidate(RepaintScheduler.GridLayer);
+        }
+
+        function onViewSpanChanged() {
+            repaintScheduler.invalidate(RepaintScheduler.GridLayer);
         }
 
         target: chartBase
@@ -1,3 +1,4 @@
+import KLineModule
 import QtQuick
 
 Item {
@@ -7,7 +8,11 @@ Item {
 
     // 基础数据属性
     property string csvFile: ""
-    property var klineData: []
+    property var klineData: []  // 当前已加载的窗口
+    property int totalCount: klineData.length  // 完整序列长度
+    property int windowOffset: 0  // klineData[0]对应的完整序列序号
+    property var provider: null  // KLineDataProvider，悬停服务直接读取列式窗口
+    property alias hover: hoverService  // hover.snapshot为悬停K线的快照
     property real minPrice: 0
     property real maxPrice: 0
     // 绘制区域边距
@@ -23,59 +28,104 @@ Item {
     property bool showCrosshair: false
     property real mouseX: 0
     property real mouseY: 0
+    property int hoveredPane: -1  // 鼠标所在窗格，-1表示不在任何窗格内
+    property var paneTops: []  // 各窗格自上而下的顶边纵坐标，与mouseY同一坐标系
     // 缩放和滚动相关属性
     property real zoomFactor: 1
     property real minZoom: 0.05 // 允许更小的缩放值，看到更多K线
     property real maxZoom: 10
-    property int startIndex: 0
-    property int visibleCount: 50
+    // 实际绘制的视口：第一根K线的小数序号和可见K线数(可以是小数)。
+    // 拖动、惯性滚动和缩放动画逐帧改变它们，场景图组件只更新变换矩阵，不重建顶点
+    property real viewStart: 0
+    property real viewSpan: 50
+    // 缩放和平滑滚动的目标视口，动画每帧向它指数趋近
+    property real targetViewStart: 0
+    property real targetViewSpan: 50
+    property real panVelocity: 0  // 惯性滚动速度，K线/秒
+    property real panFriction: 4  // 惯性速度的衰减速率，1/秒
+    property real zoomSmoothing: 18  // 缩放动画的趋近速率，1/秒
+    readonly property int startIndex: Math.max(0, Math.floor(viewStart)) // 第一根可见K线，窗口换页和逐根计算使用
+    property int visibleCount: 50  // 缩放级别对应的可见K线数
+    property int displayCount: Math.max(1, Math.min(Math.ceil(viewSpan), totalCount - startIndex)) // 实际绘制的K线数
     property int baseVisibleCount: 50 // 基础可见数量
     property int maxVisibleCount: 200 // 最大可见数量
     // 拖拽相关属性
     property bool isDragging: false
     property real lastMouseX: 0
+    property real lastMoveTime: 0
+    property real dragVelocity: 0  // 拖动中估计的速度，松手后作为惯性初速度，K线/秒
+
+    // 视口变化，数据提供器据此决定是否换入新窗口
+    signal windowRequested(int startIndex, int visibleCount)
+
+    onStartIndexChanged: windowRequested(startIndex, visibleCount)
+    onVisibleCountChanged: windowRequested(startIndex, visibleCount)
 
     // 工具函数
     function getKLineIndexFromX(x) {
-        if (getVisibleData().length === 0)
-            return -1;
+        return hoverService.indexAt(x);
+    }
 
-        var chartX = x - leftMargin;
-        if (chartX < 0 || chartX > chartWidth)
+    // 二分查找纵坐标y所在的窗格
+    function paneAt(y) {
+        var lo = 0;
+        var hi = paneTops.length - 1;
+        if (hi < 0 || y < paneTops[0])
             return -1;
 
-        var visibleData = getVisibleData();
-        var candleSpacing = chartWidth / visibleData.length;
-        var index = Math.floor(chartX / candleSpacing);
-        var actualIndex = startIndex + Math.max(0, Math.min(index, visibleData.length - 1));
-        return Math.max(0, Math.min(actualIndex, klineData.length - 1));
+        while (lo < hi) {
+            var mid = (lo + hi + 1) >> 1;
+            if (paneTops[mid] <= y)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+        return lo;
+    }
+
+    // 鼠标命中测试：所有窗格共享横轴，K线序号只取决于x，窗格只取决于y。
+    // 同时更新悬停服务的快照
+    function hitTest(x, y) {
+        return {
+            "index": hoverService.hover(x),
+            "pane": paneAt(y)
+        };
     }
 
     function getVisibleData() {
         if (klineData.length === 0)
             return [];
 
-        var endIndex = Math.min(startIndex + visibleCount, klineData.length);
-        return klineData.slice(startIndex, endIndex);
+        // startIndex是完整序列中的序号，换算到窗口内
+        var from = Math.max(0, startIndex - windowOffset);
+        var to = Math.min(startIndex + visibleCount - windowOffset, klineData.length);
+        if (to <= from)
+            return [];
+
+        return klineData.slice(from, to);
+    }
+
+    // 按完整序列序号取K线，不在已加载窗口内时返回null
+    function barAt(index) {
+        var i = index - windowOffset;
+        return (i >= 0 && i < klineData.length) ? klineData[i] : null;
     }
 
     function zoomIn(centerX) {
-        var oldZoom = zoomFactor;
-        var newZoom = Math.min(maxZoom, zoomFactor * 1.2);
-        if (Math.abs(newZoom - oldZoom) > 0.001) {
-            zoomFactor = newZoom;
-            updateVisibleCount();
-            adjustScrollPosition(centerX, oldZoom);
-        }
+        zoomBy(1.2, centerX);
     }
 
     function zoomOut(centerX) {
-        var oldZoom = zoomFactor;
-        var newZoom = Math.max(minZoom, zoomFactor / 1.2);
-        if (Math.abs(newZoom - oldZoom) > 0.001) {
+        zoomBy(1 / 1.2, centerX);
+    }
+
+    // 按factor连续缩放，触控板和触摸捏合的小幅度缩放也能平滑生效
+    function zoomBy(factor, centerX) {
+        var newZoom = Math.max(minZoom, Math.min(maxZoom, zoomFactor * factor));
+        if (Math.abs(newZoom - zoomFactor) > 0.001) {
             zoomFactor = newZoom;
             updateVisibleCount();
-            adjustScrollPosition(centerX, oldZoom);
+            adjustScrollPosition(centerX);
         }
     }
 
@@ -90,38 +140,100 @@ Item {
         // 设置合理的边界，允许更小的可见数量
         var minCount = 5;
         // 降低最小值，允许看到更少的K线
-        var maxCount = Math.min(maxVisibleCount, klineData.length);
+        var maxCount = Math.min(maxVisibleCount, totalCount);
         // 大幅提高上限，支持更多K线
         visibleCount = Math.max(minCount, Math.min(maxCount, theoreticalCount));
     }
 
-    function adjustScrollPosition(centerX, oldZoom) {
-        if (klineData.length === 0 || chartWidth <= 0 || oldZoom <= 0)
+    // 缩放中心对应的K线在缩放前后保持在同一位置。
+    // 以目标视口为基准，连续的滚轮事件在动画过程中可以叠加
+    function adjustScrollPosition(centerX) {
+        if (totalCount === 0 || chartWidth <= 0)
             return ;
 
         // 计算缩放中心相对位置 (0-1)
         var relativeX = Math.max(0, Math.min(1, (centerX - leftMargin) / chartWidth));
-        // 计算旧的可见数据量（与updateVisibleCount逻辑保持一致）
-        var oldTheoreticalCount;
-        if (oldZoom <= 1)
-            oldTheoreticalCount = Math.floor(baseVisibleCount + (1 - oldZoom) * 150);
-        else
-            oldTheoreticalCount = Math.floor(baseVisibleCount / oldZoom);
-        var oldVisibleCount = Math.max(5, Math.min(maxVisibleCount, oldTheoreticalCount));
-        // 计算缩放中心对应的数据索引
-        var centerDataIndex = startIndex + relativeX * oldVisibleCount;
-        // 调整startIndex使缩放中心保持相对位置
-        var newStartIndex = centerDataIndex - relativeX * visibleCount;
-        // 确保索引在有效范围内
-        startIndex = Math.max(0, Math.min(Math.floor(newStartIndex), klineData.length - visibleCount));
+        var anchor = targetViewStart + relativeX * targetViewSpan;
+        targetViewSpan = visibleCount;
+        targetViewStart = clampViewStart(anchor - relativeX * visibleCount, visibleCount);
+        viewAnimation.running = true;
+    }
+
+    function clampViewStart(start, span) {
+        return Math.max(0, Math.min(start, Math.max(0, totalCount - span)));
+    }
+
+    // 新数据集：视口停在最新K线，不做动画
+    function resetView() {
+        panVelocity = 0;
+        viewAnimation.running = false;
+        targetViewSpan = visibleCount;
+        viewSpan = visibleCount;
+        targetViewStart = clampViewStart(totalCount - visibleCount, visibleCount);
+        viewStart = targetViewStart;
+    }
+
+    // 立即平移bars根K线(可以是小数)，拖动时使用
+    function scrollBy(bars) {
+        var start = clampViewStart(viewStart + bars, viewSpan);
+        targetViewStart += start - viewStart;
+        viewStart = start;
+    }
+
+    // 松手后按velocity(K线/秒)惯性滚动
+    function fling(velocity) {
+        panVelocity = velocity;
+        if (panVelocity !== 0)
+            viewAnimation.running = true;
+
+    }
+
+    function stopKinetic() {
+        panVelocity = 0;
+    }
+
+    // 立即跳到以start为起点的视口，导航条拖动和点击时使用
+    function jumpTo(start) {
+        stopKinetic();
+        scrollBy(start - viewStart);
+    }
+
+    // 每帧推进惯性滚动和缩放动画，dt为距上一帧的秒数
+    function stepAnimation(dt) {
+        if (panVelocity !== 0) {
+            var before = viewStart;
+            scrollBy(panVelocity * dt);
+            panVelocity *= Math.exp(-panFriction * dt);
+            // 速度足够小或到达数据边界时停止
+            if (Math.abs(panVelocity) < 0.5 || viewStart === before)
+                panVelocity = 0;
+
+        }
+        var f = 1 - Math.exp(-zoomSmoothing * dt);
+        var spanDelta = targetViewSpan - viewSpan;
+        var startDelta = targetViewStart - viewStart;
+        var settled = Math.abs(spanDelta) < 0.001 && Math.abs(startDelta) < 0.001;
+        if (settled) {
+            viewSpan = targetViewSpan;
+            viewStart = targetViewStart;
+        } else {
+            // 起点和宽度按同一比例趋近，缩放中心在动画过程中保持不动
+            viewSpan += spanDelta * f;
+            viewStart += startDelta * f;
+        }
+        if (settled && panVelocity === 0)
+            viewAnimation.running = false;
+
     }
 
     function scrollLeft() {
-        startIndex = Math.max(0, startIndex - Math.max(1, Math.floor(visibleCount * 0.1)));
+        targetViewStart = clampViewStart(targetViewStart - Math.max(1, Math.floor(visibleCount * 0.1)), targetViewSpan);
+        viewAnimation.running = true;
     }
 
     function scrollRight() {
-        startIndex = Math.min(klineData.length - visibleCount, startIndex + Math.max(1, Math.floor(visibleCount * 0.1)));
+        targetViewStart = clampViewStart(targetViewStart + Math.max(1, Math.floor(visibleCount * 0.1)), targetViewSpan);
+        viewAnimation.running = true;
     }
 
     function updatePriceRange() {
@@ -143,4 +255,23 @@ Item {
         }
     }
 
+    // 由显示器的帧时钟驱动，每次垂直同步推进一次
+    FrameAnimation {
+        id: viewAnimation
+
+        // 卡顿后的第一帧限制步长，避免视口跳跃
+        onTriggered: root.stepAnimation(Math.min(frameTime, 0.05))
+    }
+
+    // 横坐标到K线序号的映射和悬停快照在C++中完成，悬停时不切片数组
+    HoverService {
+        id: hoverService
+
+        provider: root.provider
+        viewStart: root.viewStart
+        viewCount: root.viewSpan
+        plotLeft: root.leftMargin
+        plotWidth: root.chartWidth
+    }
+
 }
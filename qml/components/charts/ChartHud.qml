@@ -0,0 +1,119 @@
+import KLineModule
+import QtQuick
+
+// 帧时间和延迟HUD：每个直方图一行，显示样本数、p50、p99和最大值
+Rectangle {
+    id: hud
+
+    property var metrics: null  // ChartMetrics
+
+    width: 340
+    height: content.height + 16
+    color: "#cc1e1e1e"
+    border.color: "#555555"
+    border.width: 1
+    radius: 4
+
+    Column {
+        id: content
+
+        x: 8
+        y: 8
+        width: parent.width - 16
+        spacing: 2
+
+        Row {
+            spacing: 8
+
+            Text {
+                text: "指标"
+                width: 150
+                color: "#88c0d0"
+                font.pixelSize: 10
+                font.bold: true
+            }
+
+            Text {
+                text: "n / p50 / p99 / max"
+                color: "#88c0d0"
+                font.pixelSize: 10
+                font.bold: true
+            }
+
+        }
+
+        Repeater {
+            model: hud.metrics ? hud.metrics.rows : []
+
+            Row {
+                spacing: 8
+
+                Text {
+                    text: modelData.name
+                    width: 150
+                    elide: Text.ElideRight
+                    color: "white"
+                    font.pixelSize: 10
+                    font.family: "monospace"
+                }
+
+                Text {
+                    // p99超过一帧(16ms)的时间指标标红
+                    text: modelData.count + " / " + modelData.p50.toFixed(2) + " / " + modelData.p99.toFixed(2) + " / " + modelData.max.toFixed(2) + " " + modelData.unit
+                    color: modelData.unit === "ms" && modelData.p99 > 16 ? "#ff6b6b" : "white"
+                    font.pixelSize: 10
+                    font.family: "monospace"
+                }
+
+            }
+
+        }
+
+        Row {
+            spacing: 12
+
+            Text {
+                text: "导出"
+                color: "#88c0d0"
+                font.pixelSize: 10
+                font.underline: true
+
+                MouseArea {
+                    anchors.fill: parent
+                    cursorShape: Qt.PointingHandCursor
+                    onClicked: {
+                        var path = hud.metrics.exportJson("");
+                        status.text = path ? "已写出 " + path : "导出失败";
+                    }
+                }
+
+            }
+
+            Text {
+                text: "清零"
+                color: "#88c0d0"
+                font.pixelSize: 10
+                font.underline: true
+
+                MouseArea {
+                    anchors.fill: parent
+                    cursorShape: Qt.PointingHandCursor
+                    onClicked: hud.metrics.reset()
+                }
+
+            }
+
+            Text {
+                id: status
+
+                width: content.width - 80
+                elide: Text.ElideLeft
+                color: "#aaaaaa"
+                font.pixelSize: 10
+            }
+
+        }
+
+    }
+
+}
@@ -7,7 +7,6 @@ MouseArea {
     property var chartBase: null
     property var canvas: null
 
-    anchors.fill: parent
     hoverEnabled: true
     acceptedButtons: Qt.LeftButton | Qt.RightButton
     onPositionChanged: function(mouse) {
@@ -16,24 +15,26 @@ MouseArea {
 
         chartBase.mouseX = mouse.x;
         chartBase.mouseY = mouse.y;
-        // 处理拖拽滚动
-        if (chartBase.isDragging && (mouse.buttons & Qt.LeftButton)) {
-            var deltaX = mouse.x - chartBase.lastMouseX;
-            var moveRatio = deltaX / chartBase.chartWidth;
-            var moveCount = Math.floor(moveRatio * chartBase.visibleCount);
-            if (Math.abs(moveCount) >= 1) {
-                chartBase.startIndex = Math.max(0, Math.min(chartBase.klineData.length - chartBase.visibleCount, chartBase.startIndex - moveCount));
-                chartBase.lastMouseX = mouse.x;
-                if (canvas)
-                    canvas.requestPaint();
+        // 处理拖拽滚动：按像素换算为小数根K线，视口跟手移动
+        if (chartBase.isDragging && (mouse.buttons & Qt.LeftButton) && chartBase.chartWidth > 0) {
+            var bars = -(mouse.x - chartBase.lastMouseX) / chartBase.chartWidth * chartBase.viewSpan;
+            chartBase.scrollBy(bars);
+            // 速度做指数平滑，松手时作为惯性初速度
+            var now = Date.now();
+            var dt = (now - chartBase.lastMoveTime) / 1000;
+            if (dt > 0)
+                chartBase.dragVelocity = 0.8 * (bars / dt) + 0.2 * chartBase.dragVelocity;
 
-            }
+            chartBase.lastMouseX = mouse.x;
+            chartBase.lastMoveTime = now;
         }
-        // 更新悬浮信息
-        chartBase.hoveredIndex = chartBase.getKLineIndexFromX(mouse.x);
+        // 更新悬浮信息：K线、网格和坐标轴都没有变化，只重绘光标层
+        var hit = chartBase.hitTest(mouse.x, mouse.y);
+        chartBase.hoveredIndex = hit.index;
+        chartBase.hoveredPane = hit.pane;
         chartBase.showCrosshair = (chartBase.hoveredIndex >= 0);
         if (canvas)
-            canvas.requestPaint();
+            canvas.requestOverlayPaint();
 
     }
     onPressed: function(mouse) {
@@ -41,17 +42,25 @@ MouseArea {
             return ;
 
         if (mouse.button === Qt.LeftButton) {
+            // 按下时停住正在进行的惯性滚动
+            chartBase.stopKinetic();
             chartBase.isDragging = true;
             chartBase.lastMouseX = mouse.x;
+            chartBase.lastMoveTime = Date.now();
+            chartBase.dragVelocity = 0;
         }
     }
     onReleased: function(mouse) {
         if (!chartBase)
             return ;
 
-        if (mouse.button === Qt.LeftButton)
+        if (mouse.button === Qt.LeftButton && chartBase.isDragging) {
             chartBase.isDragging = false;
+            // 松手前停顿过的拖动不产生惯性
+            if (Date.now() - chartBase.lastMoveTime < 50)
+                chartBase.fling(chartBase.dragVelocity);
 
+        }
     }
     onExited: function() {
         if (!chartBase)
@@ -59,20 +68,33 @@ MouseArea {
 
         chartBase.showCrosshair = false;
         chartBase.hoveredIndex = -1;
+        chartBase.hoveredPane = -1;
+        chartBase.hover.clear();
         chartBase.isDragging = false;
         if (canvas)
-            canvas.requestPaint();
+            canvas.requestOverlayPaint();
 
     }
     onWheel: function(wheel) {
-        if (!chartBase || !canvas)
+        if (!chartBase)
             return ;
 
-        var centerX = wheel.x;
-        if (wheel.angleDelta.y > 0)
-            chartBase.zoomIn(centerX);
-        else if (wheel.angleDelta.y < 0)
-            chartBase.zoomOut(centerX);
-        canvas.requestPaint();
+        // 触控板横向滑动直接平移；纵向滚动按滚动量连续缩放，每个标准滚轮刻度(120)缩放1.2倍
+        if (Math.abs(wheel.pixelDelta.x) > Math.abs(wheel.pixelDelta.y) && chartBase.chartWidth > 0) {
+            chartBase.stopKinetic();
+            chartBase.scrollBy(-wheel.pixelDelta.x / chartBase.chartWidth * chartBase.viewSpan);
+        } else if (wheel.angleDelta.y !== 0) {
+            chartBase.zoomBy(Math.pow(1.2, wheel.angleDelta.y / 120), wheel.x);
+        }
+    }
+
+    // 触摸屏和触控板的捏合缩放
+    PinchHandler {
+        target: null
+        onScaleChanged: function(delta) {
+            if (interaction.chartBase)
+                interaction.chartBase.zoomBy(delta, centroid.position.x);
+
+        }
     }
 }
@@ -0,0 +1,76 @@
+import KLineModule
+import QtQuick
+
+// 导航条：主图下方的整段历史缩略图，半透明窗口标出当前视口。
+// 拖动窗口平移视口，点击窗口以外的位置直接跳到以该处为中心的视口。
+// 缩略图由ChartOverviewItem按像素列汇总绘制，与K线总数无关。
+Rectangle {
+    id: navigator
+
+    property var chartBase: null
+    property var provider: null
+    property alias mode: overview.mode
+    // 缩略图横轴：整个历史均匀铺满绘图区宽度
+    readonly property real barCount: overview.barCount
+    readonly property real pixelsPerBar: barCount > 0 ? overview.width / barCount : 0
+
+    color: "#232323"
+
+    // 与上方窗格之间的分隔线
+    Rectangle {
+        width: parent.width
+        height: 1
+        color: "#444444"
+    }
+
+    ChartOverviewItem {
+        id: overview
+
+        x: navigator.chartBase ? navigator.chartBase.leftMargin : 0
+        y: 2
+        width: navigator.chartBase ? navigator.chartBase.chartWidth : navigator.width
+        height: navigator.height - 4
+        provider: navigator.provider
+    }
+
+    // 当前视口，最窄保留几个像素以便拖动
+    Rectangle {
+        id: viewWindow
+
+        visible: navigator.barCount > 0 && navigator.chartBase
+        x: overview.x + (navigator.chartBase ? navigator.chartBase.viewStart : 0) * navigator.pixelsPerBar
+        y: 1
+        width: Math.max(6, (navigator.chartBase ? navigator.chartBase.viewSpan : 0) * navigator.pixelsPerBar)
+        height: navigator.height - 2
+        color: "#30FFFFFF"
+        border.color: "#80FFFFFF"
+        border.width: 1
+    }
+
+    MouseArea {
+        property real pressOffset: 0  // 按下位置相对窗口左边的K线数，拖动时保持不变
+
+        function barAt(x) {
+            return (x - overview.x) / navigator.pixelsPerBar;
+        }
+
+        anchors.fill: parent
+        enabled: navigator.barCount > 0 && navigator.chartBase
+        cursorShape: pressed ? Qt.ClosedHandCursor : Qt.PointingHandCursor
+        onPressed: function(mouse) {
+            var chartBase = navigator.chartBase;
+            var bar = barAt(mouse.x);
+            // 点在窗口外：先把视口中心移到这里，再按住拖动
+            if (mouse.x < viewWindow.x || mouse.x > viewWindow.x + viewWindow.width)
+                chartBase.jumpTo(bar - chartBase.viewSpan / 2);
+
+            pressOffset = bar - chartBase.viewStart;
+        }
+        onPositionChanged: function(mouse) {
+            if (pressed)
+                navigator.chartBase.jumpTo(barAt(mouse.x) - pressOffset);
+
+        }
+    }
+
+}
@@ -0,0 +1,56 @@
+import QtQuick
+
+// 副图窗格：与价格图共享chartBase的横轴和视口，纵轴由自己的序列组件独立缩放。
+// 序列组件作为子项放入，自动铺满绘图区；series指向它，用于纵轴标签和十字光标取值。
+Rectangle {
+    id: pane
+
+    property var chartBase: null
+    property var series: null
+    property string title: ""
+    property real topPadding: 16
+    default property alias content: plotArea.data
+
+    // 窗格内纵坐标对应的数值，十字光标标签使用
+    function valueAt(y) {
+        return series ? series.valueAt(y - plotArea.y) : NaN;
+    }
+
+    function formatValue(value) {
+        var magnitude = Math.abs(value);
+        if (magnitude >= 100000000)
+            return (value / 100000000).toFixed(2) + "亿";
+
+        if (magnitude >= 10000)
+            return (value / 10000).toFixed(2) + "万";
+
+        return value.toFixed(2);
+    }
+
+    color: "#2b2b2b"
+
+    // 与上一个窗格之间的分隔线
+    Rectangle {
+        width: parent.width
+        height: 1
+        color: "#444444"
+    }
+
+    Item {
+        id: plotArea
+
+        x: pane.chartBase ? pane.chartBase.leftMargin : 0
+        y: pane.topPadding
+        width: pane.chartBase ? pane.chartBase.chartWidth : pane.width
+        height: pane.height - pane.topPadding
+    }
+
+    Text {
+        x: 5
+        y: 2
+        text: pane.title + (pane.series ? "  " + pane.formatValue(pane.series.maxValue) : "")
+        color: "#FFFFFF"
+        font.pixelSize: 12
+    }
+
+}
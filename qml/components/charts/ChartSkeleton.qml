@@ -0,0 +1,70 @@
+import QtQuick
+
+// 启动和首次加载期间的占位图：灰色蜡烛缓慢明暗交替，图表组件和数据就绪后隐藏
+Rectangle {
+    id: skeleton
+
+    property int candleCount: 48
+
+    color: "#1e1e1e"
+
+    Row {
+        id: candles
+
+        anchors.fill: parent
+        anchors.margins: 40
+        spacing: 4
+
+        Repeater {
+            model: skeleton.candleCount
+
+            Item {
+                // 固定的伪随机起伏，避免每次显示都不同
+                readonly property real level: 0.5 + 0.3 * Math.sin(index * 0.37) + 0.1 * Math.sin(index * 1.9)
+
+                width: (candles.width - candles.spacing * (skeleton.candleCount - 1)) / skeleton.candleCount
+                height: candles.height
+
+                Rectangle {
+                    anchors.horizontalCenter: parent.horizontalCenter
+                    width: 1
+                    height: parent.height * 0.22
+                    y: parent.height * (1 - parent.level) - height / 2
+                    color: "#3b4252"
+                }
+
+                Rectangle {
+                    width: parent.width
+                    height: parent.height * 0.12
+                    y: parent.height * (1 - parent.level) - height / 2
+                    color: "#3b4252"
+                    radius: 1
+                }
+
+            }
+
+        }
+
+    }
+
+    SequentialAnimation on opacity {
+        running: skeleton.visible
+        loops: Animation.Infinite
+
+        NumberAnimation {
+            from: 1
+            to: 0.5
+            duration: 700
+            easing.type: Easing.InOutQuad
+        }
+
+        NumberAnimation {
+            from: 0.5
+            to: 1
+            duration: 700
+            easing.type: Easing.InOutQuad
+        }
+
+    }
+
+}
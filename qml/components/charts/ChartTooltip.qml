@@ -5,12 +5,14 @@ Rectangle {
 
     // 引用外部数据
     property var chartBase: null
+    // 悬停K线的快照，由C++悬停服务在悬停的K线变化时整体更新一次
+    property var bar: chartBase && chartBase.hover.snapshot.valid ? chartBase.hover.snapshot : null
 
-    visible: chartBase && chartBase.showCrosshair && chartBase.hoveredIndex >= 0
+    visible: chartBase && chartBase.showCrosshair && bar !== null
     x: chartBase ? Math.min(chartBase.mouseX + 10, parent.width - width - 10) : 0
     y: chartBase ? Math.max(10, chartBase.mouseY - height - 10) : 0
     width: 180
-    height: 120
+    height: 138
     color: "#333333"
     border.color: "#666666"
     border.width: 1
@@ -22,54 +24,52 @@ Rectangle {
         spacing: 4
 
         Text {
-            property var chart: tooltip.chartBase
-            text: (chart && chart.hoveredIndex >= 0 && chart.hoveredIndex < chart.klineData.length) ? "时间: " + chart.klineData[chart.hoveredIndex].time : ""
+            text: tooltip.bar ? "时间: " + tooltip.bar.time : ""
             color: "white"
             font.pixelSize: 11
             font.bold: true
         }
 
         Text {
-            property var chart: tooltip.chartBase
-            text: (chart && chart.hoveredIndex >= 0 && chart.hoveredIndex < chart.klineData.length) ? "开盘: " + chart.klineData[chart.hoveredIndex].open.toFixed(2) : ""
+            text: tooltip.bar ? "开盘: " + tooltip.bar.open.toFixed(2) : ""
             color: "white"
             font.pixelSize: 10
         }
 
         Text {
-            property var chart: tooltip.chartBase
-            text: (chart && chart.hoveredIndex >= 0 && chart.hoveredIndex < chart.klineData.length) ? "最高: " + chart.klineData[chart.hoveredIndex].high.toFixed(2) : ""
+            text: tooltip.bar ? "最高: " + tooltip.bar.high.toFixed(2) : ""
             color: "#FF6666"
             font.pixelSize: 10
         }
 
         Text {
-            property var chart: tooltip.chartBase
-            text: (chart && chart.hoveredIndex >= 0 && chart.hoveredIndex < chart.klineData.length) ? "最低: " + chart.klineData[chart.hoveredIndex].low.toFixed(2) : ""
+            text: tooltip.bar ? "最低: " + tooltip.bar.low.toFixed(2) : ""
             color: "#66FF66"
             font.pixelSize: 10
         }
 
         Text {
-            property var chart: tooltip.chartBase
-            property bool isRising: chart && chart.hoveredIndex >= 0 && chart.hoveredIndex < chart.klineData.length && chart.klineData[chart.hoveredIndex].close >= chart.klineData[chart.hoveredIndex].open
-
-            text: (chart && chart.hoveredIndex >= 0 && chart.hoveredIndex < chart.klineData.length) ? "收盘: " + chart.klineData[chart.hoveredIndex].close.toFixed(2) : ""
-            color: isRising ? "#FF0000" : "#00FF00"
+            text: tooltip.bar ? "收盘: " + tooltip.bar.close.toFixed(2) : ""
+            color: tooltip.bar && tooltip.bar.rising ? "#FF0000" : "#00FF00"
             font.pixelSize: 10
             font.bold: true
         }
 
         Text {
-            property var chart: tooltip.chartBase
-            property real change: (chart && chart.hoveredIndex >= 0 && chart.hoveredIndex < chart.klineData.length) ? chart.klineData[chart.hoveredIndex].close - chart.klineData[chart.hoveredIndex].open : 0
-            property real changePercent: (chart && chart.hoveredIndex >= 0 && chart.hoveredIndex < chart.klineData.length && chart.klineData[chart.hoveredIndex].open > 0) ? (change / chart.klineData[chart.hoveredIndex].open * 100) : 0
+            property real change: tooltip.bar ? tooltip.bar.change : 0
+            property real changePercent: tooltip.bar ? tooltip.bar.changePercent : 0
 
             text: "涨跌: " + (change >= 0 ? "+" : "") + change.toFixed(2) + " (" + (changePercent >= 0 ? "+" : "") + changePercent.toFixed(2) + "%)"
             color: change >= 0 ? "#FF0000" : "#00FF00"
             font.pixelSize: 10
         }
 
+        Text {
+            text: tooltip.bar ? "成交量: " + Math.round(tooltip.bar.volume) : ""
+            color: "#d8dee9"
+            font.pixelSize: 10
+        }
+
     }
 
 }
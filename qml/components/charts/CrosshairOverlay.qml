@@ -0,0 +1,48 @@
+import QtQuick
+
+// 跨所有窗格的十字光标：竖线贯穿全部窗格，横线和数值标签只画在鼠标所在的窗格。
+// 只在光标层失效时重绘，K线和坐标轴不受影响。
+Canvas {
+    id: overlay
+
+    property var chartBase: null
+    // 自上而下的窗格，每个窗格提供valueAt(y)和formatValue(value)
+    property var panes: []
+
+    onPaint: {
+        var ctx = getContext("2d");
+        ctx.clearRect(0, 0, width, height);
+        if (!chartBase || !chartBase.showCrosshair || chartBase.hoveredIndex < 0)
+            return ;
+
+        ctx.strokeStyle = "#FFFF00";
+        ctx.lineWidth = 1;
+        ctx.setLineDash([5, 5]);
+        // 垂直线
+        ctx.beginPath();
+        ctx.moveTo(chartBase.mouseX, chartBase.topMargin);
+        ctx.lineTo(chartBase.mouseX, height);
+        ctx.stroke();
+        // 水平线
+        ctx.beginPath();
+        ctx.moveTo(chartBase.leftMargin, chartBase.mouseY);
+        ctx.lineTo(chartBase.leftMargin + chartBase.chartWidth, chartBase.mouseY);
+        ctx.stroke();
+        ctx.setLineDash([]);
+        // 所在窗格的纵轴数值
+        var hit = chartBase.hoveredPane;
+        if (hit < 0 || hit >= panes.length)
+            return ;
+
+        var pane = panes[hit];
+        var value = pane.valueAt(chartBase.mouseY - chartBase.paneTops[hit]);
+        if (isNaN(value))
+            return ;
+
+        ctx.fillStyle = "#FFFF00";
+        ctx.fillRect(0, chartBase.mouseY - 8, chartBase.leftMargin - 4, 16);
+        ctx.fillStyle = "#000000";
+        ctx.font = "12px Arial";
+        ctx.fillText(pane.formatValue(value), 5, chartBase.mouseY + 4);
+    }
+}
@@ -1,16 +1,92 @@
+import KLineModule
 import QtQuick
 
-Canvas {
+// 分层绘制：背景网格和最新价标签各是一个独立的Canvas，K线、主图指标和坐标轴刻度是场景图组件。
+// 每层绘制结果保留为纹理，只有自身失效时才重绘；十字光标由图表的CrosshairOverlay跨窗格绘制。
+// 失效请求交给scheduler按帧合并，由它回调paintLayer。
+// K线层的顶点只在数据或LOD变化时构建，平移缩放只改变它的变换矩阵。
+Item {
     id: canvas
 
     // 引用外部数据
     property var chartBase: null
+    property var scheduler: null
+    property var provider: null  // KLineDataProvider，K线层直接读取列式数据
+    property var overlays: []  // 主图叠加指标，例如["MA", "BBANDS"]
+    // 叠加指标展开为各条输出线及其颜色，全部由一个LineSeriesItem批量绘制
+    property var overlaySeries: {
+        var names = [];
+        var colors = [];
+        for (var i = 0; i < overlays.length; i++) {
+            if (overlays[i] === "BBANDS") {
+                names.push("BBANDS.upper", "BBANDS.middle", "BBANDS.lower");
+                colors.push("#4682B4", "#FFFFFF", "#4682B4");
+            } else {
+                names.push(overlays[i]);
+                colors.push(i === 0 ? "#FFD700" : "#DA70D6");
+            }
+        }
+        return {
+            "names": names,
+            "colors": colors
+        };
+    }
+
+    // 视口或数据变化：重绘所有层
+    function requestPaint() {
+        scheduler.invalidate(RepaintScheduler.GridLayer | RepaintScheduler.SeriesLayer | RepaintScheduler.AxisLayer | RepaintScheduler.OverlayLayer);
+    }
+
+    // 鼠标移动：只重绘光标层
+    function requestOverlayPaint() {
+        scheduler.invalidate(RepaintScheduler.OverlayLayer);
+    }
+
+    // 单根K线变化（例如实时行情更新最后一根）：只重绘这一列和价格轴。
+    // 超出当前价格范围时坐标变换改变，退回到整体重绘
+    function invalidateBar(index) {
+        var bar = chartBase ? chartBase.barAt(index) : null;
+        if (!bar || index < chartBase.startIndex || index >= chartBase.startIndex + chartBase.visibleCount)
+            return ;
+
+        if (bar.high > chartBase.maxPrice || bar.low < chartBase.minPrice) {
+            requestPaint();
+            return ;
+        }
+        seriesLayer.invalidateBar(index);
+        scheduler.invalidateRect(RepaintScheduler.AxisLayer, Qt.rect(0, 0, chartBase.leftMargin, height));
+    }
+
+    // 由scheduler每帧回调，rect为空表示整层
+    function paintLayer(layer, rect) {
+        var target = null;
+        if (layer === RepaintScheduler.GridLayer)
+            target = gridLayer;
+        else if (layer === RepaintScheduler.SeriesLayer)
+            target = seriesLayer;
+        else if (layer === RepaintScheduler.AxisLayer)
+            target = axisLayer;
+        if (!target)
+            return ;
+
+        if (target === seriesLayer)
+            seriesLayer.update();
+        else if (rect.width > 0 && rect.height > 0)
+            target.markDirty(rect);
+        else
+            target.requestPaint();
+    }
+
+    function hasData() {
+        return chartBase && chartBase.klineData.length > 0;
+    }
 
     function drawBackground(ctx) {
         ctx.fillStyle = "#2b2b2b";
         ctx.fillRect(0, 0, width, height);
     }
 
+    // 网格线与坐标轴刻度对齐
     function drawGrid(ctx) {
         if (!chartBase)
             return ;
@@ -18,199 +94,154 @@ Canvas {
         ctx.strokeStyle = "#444444";
         ctx.lineWidth = 1;
         ctx.setLineDash([2, 2]);
-        var visibleData = chartBase.getVisibleData();
-        if (visibleData.length === 0)
-            return ;
-
-        // 垂直网格线
-        var xStep = chartBase.chartWidth / Math.max(1, visibleData.length - 1);
-        for (var i = 0; i <= visibleData.length; i++) {
-            var x = chartBase.leftMargin + i * xStep;
-            ctx.beginPath();
+        ctx.beginPath();
+        var xs = timeAxis.tickPositions();
+        for (var i = 0; i < xs.length; i++) {
+            var x = Math.round(chartBase.leftMargin + xs[i]) + 0.5;
             ctx.moveTo(x, chartBase.topMargin);
             ctx.lineTo(x, chartBase.topMargin + chartBase.chartHeight);
-            ctx.stroke();
         }
-        // 水平网格线
-        var gridLines = 5;
-        for (var j = 0; j <= gridLines; j++) {
-            var y = chartBase.topMargin + j * (chartBase.chartHeight / gridLines);
-            ctx.beginPath();
+        var ys = valueAxis.tickPositions();
+        for (var j = 0; j < ys.length; j++) {
+            var y = Math.round(chartBase.topMargin + ys[j]) + 0.5;
             ctx.moveTo(chartBase.leftMargin, y);
             ctx.lineTo(chartBase.leftMargin + chartBase.chartWidth, y);
-            ctx.stroke();
         }
+        ctx.stroke();
         ctx.setLineDash([]);
     }
 
-    function drawKLines(ctx) {
+    // 刻度标签由valueAxis/timeAxis绘制，这一层只画最后一根可见K线的收盘价标签
+    function drawLastPrice(ctx) {
         if (!chartBase)
             return ;
 
-        var visibleData = chartBase.getVisibleData();
-        if (visibleData.length === 0)
+        var lastBar = chartBase.barAt(chartBase.startIndex + chartBase.displayCount - 1);
+        if (!lastBar)
             return ;
 
-        var candleWidth = chartBase.chartWidth / visibleData.length * 0.6;
-        var candleSpacing = chartBase.chartWidth / visibleData.length;
-        for (var i = 0; i < visibleData.length; i++) {
-            var kline = visibleData[i];
-            var x = chartBase.leftMargin + i * candleSpacing + candleSpacing * 0.2;
-            var highY = priceToY(kline.high);
-            var lowY = priceToY(kline.low);
-            var openY = priceToY(kline.open);
-            var closeY = priceToY(kline.close);
-            var isRising = kline.close >= kline.open;
-            var color = isRising ? "#FF0000" : "#00FF00";
-            // 绘制影线
-            ctx.strokeStyle = color;
-            ctx.lineWidth = 1;
-            ctx.beginPath();
-            ctx.moveTo(x + candleWidth / 2, highY);
-            ctx.lineTo(x + candleWidth / 2, lowY);
-            ctx.stroke();
-            // 绘制实体
-            var bodyHeight = Math.abs(closeY - openY);
-            var bodyY = Math.min(openY, closeY);
-            if (bodyHeight < 1)
-                bodyHeight = 1;
-
-            ctx.fillStyle = color;
-            ctx.fillRect(x, bodyY, candleWidth, bodyHeight);
-            ctx.strokeStyle = color;
-            ctx.lineWidth = 1;
-            ctx.strokeRect(x, bodyY, candleWidth, bodyHeight);
-        }
+        var lastY = priceToY(lastBar.close);
+        ctx.fillStyle = lastBar.close >= lastBar.open ? "#FF0000" : "#00FF00";
+        ctx.fillRect(0, lastY - 8, chartBase.leftMargin - 4, 16);
+        ctx.fillStyle = "#FFFFFF";
+        ctx.font = "12px Arial";
+        ctx.fillText(Number(lastBar.close).toFixed(2), 5, lastY + 4);
     }
 
-    function drawAxes(ctx) {
+    function priceToY(price) {
         if (!chartBase)
-            return ;
+            return 0;
 
-        ctx.strokeStyle = "#FFFFFF";
-        ctx.fillStyle = "#FFFFFF";
-        ctx.font = "12px Arial";
-        ctx.lineWidth = 1;
-        ctx.setLineDash([]);
-        // Y轴标签（价格）
-        var priceSteps = 5;
-        for (var i = 0; i <= priceSteps; i++) {
-            var price = chartBase.minPrice + (chartBase.maxPrice - chartBase.minPrice) * i / priceSteps;
-            var y = chartBase.topMargin + chartBase.chartHeight - i * (chartBase.chartHeight / priceSteps);
-            ctx.fillText(Number(price).toFixed(2), 5, y + 4);
-        }
-        // X轴标签（时间）
-        var visibleData = chartBase.getVisibleData();
-        if (visibleData.length > 0) {
-            var maxLabels = 8;
-            var step = Math.max(1, Math.ceil(visibleData.length / maxLabels));
-            var previousDate = "";
-            for (var j = 0; j < visibleData.length; j += step) {
-                var currentDate = getDateFromTime(visibleData[j].time);
-                var showDate = (currentDate !== previousDate);
-                var x = chartBase.leftMargin + j * (chartBase.chartWidth / visibleData.length) + (chartBase.chartWidth / visibleData.length) / 2;
-                var timeStr = formatTime(visibleData[j].time, showDate);
-                ctx.save();
-                ctx.translate(x, height - 5);
-                ctx.rotate(-Math.PI / 6);
-                if (timeStr.indexOf('\n') !== -1) {
-                    var lines = timeStr.split('\n');
-                    ctx.fillText(lines[0], 0, -8);
-                    ctx.fillText(lines[1], 0, 8);
-                } else {
-                    ctx.fillText(timeStr, 0, 0);
-                }
-                ctx.restore();
-                previousDate = currentDate;
-            }
-            // 显示最后一个时间点
-            var lastIndex = visibleData.length - 1;
-            if (lastIndex % step !== 0) {
-                var lastDate = getDateFromTime(visibleData[lastIndex].time);
-                var showLastDate = (lastDate !== previousDate);
-                var lastX = chartBase.leftMargin + lastIndex * (chartBase.chartWidth / visibleData.length) + (chartBase.chartWidth / visibleData.length) / 2;
-                var lastTimeStr = formatTime(visibleData[lastIndex].time, showLastDate);
-                ctx.save();
-                ctx.translate(lastX, height - 5);
-                ctx.rotate(-Math.PI / 6);
-                if (lastTimeStr.indexOf('\n') !== -1) {
-                    var lastLines = lastTimeStr.split('\n');
-                    ctx.fillText(lastLines[0], 0, -8);
-                    ctx.fillText(lastLines[1], 0, 8);
-                } else {
-                    ctx.fillText(lastTimeStr, 0, 0);
-                }
-                ctx.restore();
-            }
-        }
+        var ratio = (price - chartBase.minPrice) / (chartBase.maxPrice - chartBase.minPrice);
+        return chartBase.topMargin + chartBase.chartHeight - ratio * chartBase.chartHeight;
     }
 
-    function formatTime(timeString, showDate) {
-        var timeParts = timeString.split(' ');
-        if (timeParts.length >= 2) {
-            var date = timeParts[0];
-            var time = timeParts[1];
-            var timeParts2 = time.split(':');
-            var timeStr = "00:00";
-            if (timeParts2.length >= 2)
-                timeStr = timeParts2[0] + ":" + timeParts2[1];
-
-            if (showDate) {
-                var dateParts = date.split('-');
-                if (dateParts.length >= 3) {
-                    var shortDate = dateParts[1] + "-" + dateParts[2];
-                    return shortDate + "\n" + timeStr;
-                }
-            }
-            return timeStr;
+    Canvas {
+        id: gridLayer
+
+        anchors.fill: parent
+        onPaint: {
+            var ctx = getContext("2d");
+            ctx.clearRect(0, 0, width, height);
+            canvas.drawBackground(ctx);
+            if (canvas.hasData())
+                canvas.drawGrid(ctx);
+
         }
-        return "00:00";
     }
 
-    function getDateFromTime(timeString) {
-        var timeParts = timeString.split(' ');
-        return timeParts.length > 0 ? timeParts[0] : "";
-    }
+    // 场景图层共用的绘图区，纵轴范围与价格轴一致
+    Item {
+        id: plotArea
+
+        x: chartBase ? chartBase.leftMargin : 0
+        y: chartBase ? chartBase.topMargin : 0
+        width: chartBase ? chartBase.chartWidth : 0
+        height: chartBase ? chartBase.chartHeight : 0
+
+        // 布林带填充在K线下方
+        BandSeriesItem {
+            anchors.fill: parent
+            visible: canvas.overlays.indexOf("BBANDS") >= 0
+            provider: canvas.provider
+            upperSeries: visible ? "BBANDS.upper" : ""
+            lowerSeries: visible ? "BBANDS.lower" : ""
+            autoRange: false
+            viewStart: chartBase ? chartBase.viewStart : 0
+            viewCount: chartBase ? chartBase.viewSpan : 1
+            minValue: chartBase ? chartBase.minPrice : 0
+            maxValue: chartBase ? chartBase.maxPrice : 1
+        }
 
-    function priceToY(price) {
-        if (!chartBase)
-            return 0;
+        CandleSeriesItem {
+            id: seriesLayer
+
+            anchors.fill: parent
+            provider: canvas.provider
+            viewStart: chartBase ? chartBase.viewStart : 0
+            viewCount: chartBase ? chartBase.viewSpan : 1
+            minValue: chartBase ? chartBase.minPrice : 0
+            maxValue: chartBase ? chartBase.maxPrice : 1
+        }
+
+        LineSeriesItem {
+            anchors.fill: parent
+            provider: canvas.provider
+            series: canvas.overlaySeries.names
+            colors: canvas.overlaySeries.colors
+            autoRange: false
+            viewStart: chartBase ? chartBase.viewStart : 0
+            viewCount: chartBase ? chartBase.viewSpan : 1
+            minValue: chartBase ? chartBase.minPrice : 0
+            maxValue: chartBase ? chartBase.maxPrice : 1
+        }
 
-        var ratio = (price - chartBase.minPrice) / (chartBase.maxPrice - chartBase.minPrice);
-        return chartBase.topMargin + chartBase.chartHeight - ratio * chartBase.chartHeight;
     }
 
-    function drawCrosshair(ctx) {
-        if (!chartBase || !chartBase.showCrosshair || chartBase.hoveredIndex < 0)
-            return ;
+    // 坐标轴刻度标签：字形图集上的贴图四边形，视口变化时不经过Canvas
+    ChartAxisItem {
+        id: valueAxis
+
+        orientation: ChartAxisItem.ValueAxis
+        x: 0
+        y: chartBase ? chartBase.topMargin : 0
+        width: chartBase ? chartBase.leftMargin : 0
+        height: chartBase ? chartBase.chartHeight : 0
+        minValue: chartBase ? chartBase.minPrice : 0
+        maxValue: chartBase ? chartBase.maxPrice : 1
+        visible: canvas.hasData()
+    }
 
-        ctx.strokeStyle = "#FFFF00";
-        ctx.lineWidth = 1;
-        ctx.setLineDash([5, 5]);
-        // 垂直线
-        ctx.beginPath();
-        ctx.moveTo(chartBase.mouseX, chartBase.topMargin);
-        ctx.lineTo(chartBase.mouseX, chartBase.topMargin + chartBase.chartHeight);
-        ctx.stroke();
-        // 水平线
-        ctx.beginPath();
-        ctx.moveTo(chartBase.leftMargin, chartBase.mouseY);
-        ctx.lineTo(chartBase.leftMargin + chartBase.chartWidth, chartBase.mouseY);
-        ctx.stroke();
-        ctx.setLineDash([]);
+    ChartAxisItem {
+        id: timeAxis
+
+        orientation: ChartAxisItem.TimeAxis
+        x: chartBase ? chartBase.leftMargin : 0
+        y: chartBase ? chartBase.topMargin + chartBase.chartHeight : 0
+        width: chartBase ? chartBase.chartWidth : 0
+        height: chartBase ? chartBase.bottomMargin : 0
+        provider: canvas.provider
+        viewStart: chartBase ? chartBase.viewStart : 0
+        viewCount: chartBase ? chartBase.viewSpan : 1
+        tickSpacing: 70
     }
 
-    onPaint: {
-        var ctx = getContext("2d");
-        ctx.clearRect(0, 0, width, height);
-        if (!chartBase || chartBase.klineData.length === 0)
-            return ;
+    Canvas {
+        id: axisLayer
 
-        chartBase.updatePriceRange();
-        drawBackground(ctx);
-        drawGrid(ctx);
-        drawKLines(ctx);
-        drawAxes(ctx);
-        drawCrosshair(ctx);
+        anchors.fill: parent
+        onPaint: function(region) {
+            var ctx = getContext("2d");
+            ctx.save();
+            ctx.beginPath();
+            ctx.rect(region.x, region.y, region.width, region.height);
+            ctx.clip();
+            ctx.clearRect(region.x, region.y, region.width, region.height);
+            if (canvas.hasData())
+                canvas.drawLastPrice(ctx);
+
+            ctx.restore();
+        }
     }
+
 }
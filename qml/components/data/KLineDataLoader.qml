@@ -7,14 +7,56 @@ Item {
     // 输入属性
     property string csvFile: ""
     property string klinePeriod: "1m"  // 默认1分钟周期
+    property string sessionTemplate: "24h"  // 交易时段模板，决定周期K线的分桶边界
+    property var indicators: []  // 需要在后台计算的指标，例如["MFI", "OBV"]；MA总是计算
     // 输出属性
-    property var klineData: []
+    property var klineData: []  // 只包含当前窗口的数据
     property bool isLoading: dataProvider.isLoading
+    property string loadStage: dataProvider.loadStage  // "读取"、"合成"，空表示空闲
+    property real loadProgress: dataProvider.loadProgress  // 读取阶段的进度(0~1)
+    property int totalCount: dataProvider.totalCount
+    property int windowOffset: 0  // klineData[0]在完整序列中的序号
+    property int datasetRevision: 0  // 每次加载新数据集时递增，窗口换页和后续预览不变
+    property bool previewShown: false  // 本次加载是否已显示过预览
+    property bool hasVolume: dataProvider.hasVolume  // 数据集是否包含成交量，换页时不变
+    property alias provider: dataProvider  // C++绘制组件直接读取列式窗口
 
     // 信号
     signal dataLoaded(var data)
     signal dataError(string error)
 
+    // 视口变化时调用，接近窗口边缘时由C++换入新窗口
+    function ensureWindow(startIndex, visibleCount) {
+        dataProvider.ensureWindow(startIndex, visibleCount);
+    }
+
+    // 中止当前的读取或合成，已显示的数据保留
+    function cancelLoad() {
+        dataProvider.cancelLoad();
+    }
+
+    // 行格式: [时间, 开, 高, 低, 收, 成交量, 成交额, 持仓量, MA]
+    function toKLines(data) {
+        var tempData = [];
+        for (var i = 0; i < data.length; i++) {
+            var row = data[i];
+            if (row.length >= 5) {
+                var kline = {
+                    "time": row[0],
+                    "open": parseFloat(row[1]),
+                    "high": parseFloat(row[2]),
+                    "low": parseFloat(row[3]),
+                    "close": parseFloat(row[4]),
+                    "volume": row.length > 5 ? row[5] : 0,
+                    "turnover": row.length > 6 ? row[6] : 0,
+                    "openInterest": row.length > 7 ? row[7] : 0
+                };
+                tempData.push(kline);
+            }
+        }
+        return tempData;
+    }
+
     // 数据提供器
     KLineDataProvider {
         id: dataProvider
@@ -25,23 +67,32 @@ Item {
         }
         csvFile: root.csvFile
         klinePeriod: root.klinePeriod
+        sessionTemplate: root.sessionTemplate
+        indicators: root.indicators
         onDataLoaded: {
-            var tempData = [];
-            for (var i = 0; i < data.length; i++) {
-                var row = data[i];
-                if (row.length >= 5) {
-                    var kline = {
-                        "time": row[0],
-                        "open": parseFloat(row[1]),
-                        "high": parseFloat(row[2]),
-                        "low": parseFloat(row[3]),
-                        "close": parseFloat(row[4])
-                    };
-                    tempData.push(kline);
-                }
-            }
+            var tempData = root.toKLines(data);
+            root.windowOffset = dataProvider.windowOffset;
             root.klineData = tempData;
+            root.datasetRevision++;
+            root.previewShown = false;
             root.dataLoaded(tempData);
         }
+        // 首个预览替换了上一个数据集，视口重置一次；之后的预览只更新窗口，不打断浏览
+        onPreviewLoaded: {
+            root.windowOffset = dataProvider.windowOffset;
+            root.klineData = root.toKLines(data);
+            if (!root.previewShown) {
+                root.previewShown = true;
+                root.datasetRevision++;
+            }
+        }
+        onIsLoadingChanged: {
+            if (!isLoading)
+                root.previewShown = false;
+        }
+        onWindowChanged: {
+            root.windowOffset = dataProvider.windowOffset;
+            root.klineData = root.toKLines(data);
+        }
     }
 }
@@ -13,12 +13,31 @@ ApplicationWindow {
     title: qsTr("专业K线图表")
     Component.onCompleted: {
         console.log("KLine应用启动完成");
+        restoreLastSession();
+    }
+
+    // 恢复上次查看的文件和周期，CSV有快照时直接加载快照
+    function restoreLastSession() {
+        var session = dataLoader.provider.lastSession();
+        if (!session.file)
+            return;
+
+        for (var i = 0; i < periodComboBox.periodData.length; i++) {
+            if (periodComboBox.periodData[i].value === session.period) {
+                periodComboBox.currentIndex = i;
+                break;
+            }
+        }
+        console.log("恢复上次会话:", session.file, session.period);
+        dataLoader.csvFile = session.file;
     }
 
     // 数据加载器
     KLineDataLoader {
         id: dataLoader
         klinePeriod: periodComboBox.getCurrentValue()
+        sessionTemplate: sessionComboBox.getCurrentValue()
+        indicators: overlayComboBox.getCurrentValue().concat(indicatorComboBox.getCurrentValue())
     }
 
     // 顶部工具栏
@@ -63,7 +82,7 @@ ApplicationWindow {
 
             ComboBox {
                 id: periodComboBox
-                width: 120
+                width: 140
                 height: 40
 
                 property var periodData: [
@@ -94,6 +113,26 @@ ApplicationWindow {
                     {
                         text: "1天",
                         value: "1d"
+                    },
+                    {
+                        text: "100笔",
+                        value: "tick:100"
+                    },
+                    {
+                        text: "成交量1万",
+                        value: "vol:10000"
+                    },
+                    {
+                        text: "成交额100万",
+                        value: "dollar:1000000"
+                    },
+                    {
+                        text: "价格跨度1.0",
+                        value: "range:1"
+                    },
+                    {
+                        text: "Renko 0.5",
+                        value: "renko:0.5"
                     }
                 ]
 
@@ -117,25 +156,193 @@ ApplicationWindow {
                 font.pixelSize: 14
             }
 
-            // 加载指示器
+            // 交易时段选择
+            Text {
+                anchors.verticalCenter: parent.verticalCenter
+                text: "时段:"
+                color: "#d8dee9"
+                font.pixelSize: 14
+            }
+
+            ComboBox {
+                id: sessionComboBox
+                width: 140
+                height: 40
+
+                property var sessionData: [
+                    {
+                        text: "全天24小时",
+                        value: "24h"
+                    },
+                    {
+                        text: "A股",
+                        value: "cn_stock"
+                    },
+                    {
+                        text: "国内期货",
+                        value: "cn_futures"
+                    },
+                    {
+                        text: "国内期货(夜盘至02:30)",
+                        value: "cn_futures_late"
+                    },
+                    {
+                        text: "港股",
+                        value: "hk_stock"
+                    },
+                    {
+                        text: "美股",
+                        value: "us_equity"
+                    }
+                ]
+
+                function getCurrentValue() {
+                    return sessionData[currentIndex].value;
+                }
+
+                model: sessionData
+                textRole: "text"
+                currentIndex: 0
+            }
+
+            // 主图叠加指标选择
+            Text {
+                anchors.verticalCenter: parent.verticalCenter
+                text: "主图:"
+                color: "#d8dee9"
+                font.pixelSize: 14
+            }
+
+            ComboBox {
+                id: overlayComboBox
+                width: 120
+                height: 40
+
+                property var overlayData: [
+                    {
+                        text: "MA",
+                        value: ["MA"]
+                    },
+                    {
+                        text: "MA+BOLL",
+                        value: ["MA", "BBANDS"]
+                    },
+                    {
+                        text: "无",
+                        value: []
+                    }
+                ]
+
+                function getCurrentValue() {
+                    return overlayData[currentIndex].value;
+                }
+
+                model: overlayData
+                textRole: "text"
+                currentIndex: 0
+            }
+
+            // 指标副图选择
+            Text {
+                anchors.verticalCenter: parent.verticalCenter
+                text: "副图:"
+                color: "#d8dee9"
+                font.pixelSize: 14
+            }
+
+            ComboBox {
+                id: indicatorComboBox
+                width: 140
+                height: 40
+
+                property var indicatorData: [
+                    {
+                        text: "无",
+                        value: []
+                    },
+                    {
+                        text: "MFI",
+                        value: ["MFI"]
+                    },
+                    {
+                        text: "OBV",
+                        value: ["OBV"]
+                    },
+                    {
+                        text: "ADOSC",
+                        value: ["ADOSC"]
+                    },
+                    {
+                        text: "MFI+OBV+ADOSC",
+                        value: ["MFI", "OBV", "ADOSC"]
+                    }
+                ]
+
+                function getCurrentValue() {
+                    return indicatorData[currentIndex].value;
+                }
+
+                model: indicatorData
+                textRole: "text"
+                currentIndex: 0
+            }
+
+            // 加载指示器：读取阶段显示进度，读取和合成都可取消
             Text {
                 anchors.verticalCenter: parent.verticalCenter
-                text: dataLoader.isLoading ? "数据处理中..." : ""
+                text: dataLoader.loadStage === "读取" ? "读取中 " + Math.round(dataLoader.loadProgress * 100) + "%" : "数据处理中..."
                 color: "#88c0d0"
                 font.pixelSize: 14
                 visible: dataLoader.isLoading
             }
+
+            Button {
+                text: "取消"
+                height: 40
+                visible: dataLoader.isLoading
+                onClicked: dataLoader.cancelLoad()
+            }
+        }
+    }
+
+    // F3切换帧时间和延迟HUD
+    Shortcut {
+        sequence: "F3"
+        onActivated: {
+            if (chartLoader.item)
+                chartLoader.item.showHud = !chartLoader.item.showHud;
         }
     }
 
-    // K线图表
-    CanvasKLineChart {
+    // K线图表：异步实例化，窗口先显示占位图，不等图表组件创建完成
+    Loader {
+        id: chartLoader
+
         anchors.top: toolbar.bottom
         anchors.left: parent.left
         anchors.right: parent.right
         anchors.bottom: parent.bottom
-        klineData: dataLoader.klineData
-        title: "专业K线图表"
+        asynchronous: true
+
+        sourceComponent: CanvasKLineChart {
+            klineData: dataLoader.klineData
+            totalCount: dataLoader.totalCount
+            windowOffset: dataLoader.windowOffset
+            datasetRevision: dataLoader.datasetRevision
+            hasVolume: dataLoader.hasVolume
+            provider: dataLoader.provider
+            overlayIndicators: overlayComboBox.getCurrentValue()
+            indicatorPanes: indicatorComboBox.getCurrentValue()
+            title: "专业K线图表"
+            onWindowRequested: function(startIndex, visibleCount) {
+                dataLoader.ensureWindow(startIndex, visibleCount);
+            }
+        }
+    }
+
+    ChartSkeleton {
+        anchors.fill: chartLoader
+        visible: chartLoader.status !== Loader.Ready || (dataLoader.isLoading && dataLoader.totalCount === 0)
     }
 
     // 文件选择对话框
@@ -13,7 +13,7 @@ def generate_kline_data(n, base_price=100, volatility=0.02):
     volatility: 波动率
 
     返回:
-    list: 包含K线数据的列表，每条数据格式为 [时间, 开盘, 最高, 最低, 收盘]
+    list: 包含K线数据的列表，每条数据格式为 [时间, 开盘, 最高, 最低, 收盘, 成交量, 成交额]
     """
     klines = []
     # 使用今天的开始时间，避免未来时间
@@ -52,6 +52,10 @@ def generate_kline_data(n, base_price=100, volatility=0.02):
         low_price = min(low_price, open_price, close_price)
         high_price = max(high_price, open_price, close_price)
 
+        # 成交量与波动幅度正相关，成交额按均价估算
+        volume = int(random.uniform(500, 1500) * (1 + abs(change_rate) / volatility))
+        turnover = volume * (open_price + high_price + low_price + close_price) / 4
+
         # 格式化数据
         timestamp = current_time.strftime("%Y-%m-%d %H:%M:%S")
         kline = [
@@ -60,6 +64,8 @@ def generate_kline_data(n, base_price=100, volatility=0.02):
             round(high_price, 2),
             round(low_price, 2),
             round(close_price, 2),
+            volume,
+            round(turnover, 2),
         ]
         klines.append(kline)
 
@@ -74,17 +80,17 @@ def save_to_csv(klines, filename="kline_data.csv"):
     """保存K线数据到CSV文件"""
     with open(filename, "w", newline="", encoding="utf-8") as csvfile:
         writer = csv.writer(csvfile)
-        writer.writerow(["时间", "开盘", "最高", "最低", "收盘"])
+        writer.writerow(["时间", "开盘", "最高", "最低", "收盘", "成交量", "成交额"])
         writer.writerows(klines)
     print(f"K线数据已保存到 {filename}")
 
 
 def print_klines(klines):
     """打印K线数据"""
-    print("时间\t\t\t开盘\t最高\t最低\t收盘")
-    print("-" * 60)
+    print("时间\t\t\t开盘\t最高\t最低\t收盘\t成交量")
+    print("-" * 70)
     for kline in klines:
-        print(f"{kline[0]}\t{kline[1]}\t{kline[2]}\t{kline[3]}\t{kline[4]}")
+        print(f"{kline[0]}\t{kline[1]}\t{kline[2]}\t{kline[3]}\t{kline[4]}\t{kline[5]}")
 
 
 if __name__ == "__main__":
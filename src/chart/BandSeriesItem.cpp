@@ -0,0 +1,104 @@
+#include "BandSeriesItem.h"
+
+#include <QSGGeometryNode>
+#include <limits>
+
+#include "SeriesGeometry.h"
+#include "core/KLineDataProvider.h"
+
+BandSeriesItem::BandSeriesItem(QQuickItem *parent) : ChartSeriesItem(parent)
+{
+    setAutoRange(true);
+}
+
+void BandSeriesItem::setUpperSeries(const QString &name)
+{
+    if (m_upperSeries == name) return;
+
+    m_upperSeries = name;
+    emit seriesChanged();
+    reload();
+}
+
+void BandSeriesItem::setLowerSeries(const QString &name)
+{
+    if (m_lowerSeries == name) return;
+
+    m_lowerSeries = name;
+    emit seriesChanged();
+    reload();
+}
+
+void BandSeriesItem::setColor(const QColor &color)
+{
+    if (m_color == color) return;
+
+    m_color = color;
+    emit colorChanged();
+    markContentDirty();
+}
+
+void BandSeriesItem::loadData(const KLineWindowSnapshot *window)
+{
+    m_upper = window ? window->series.value(m_upperSeries) : QVector<double>();
+    m_lower = window ? window->series.value(m_lowerSeries) : QVector<double>();
+
+    // 两条边界的NaN位置对齐，保证抽稀后上下两侧的分段一一对应
+    const int count = dataCount();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    double origin = 0;
+    bool found = false;
+    for (int i = 0; i < count; ++i) {
+        if (qIsNaN(m_upper[i]) || qIsNaN(m_lower[i])) {
+            m_upper[i] = nan;
+            m_lower[i] = nan;
+        } else if (!found) {
+            origin = m_lower[i];
+            found = true;
+        }
+    }
+    setValueOrigin(origin);
+}
+
+bool BandSeriesItem::dataRange(int from, int to, double *min, double *max) const
+{
+    bool found = false;
+    for (int i = from; i < to; ++i) {
+        if (qIsNaN(m_upper[i])) continue;
+        if (!found) {
+            *min = m_lower[i];
+            *max = m_upper[i];
+            found = true;
+        } else {
+            *min = qMin(*min, m_lower[i]);
+            *max = qMax(*max, m_upper[i]);
+        }
+    }
+    if (!found) return false;
+
+    const double margin = (*max - *min) * 0.1;
+    *min -= margin;
+    *max += margin;
+    return true;
+}
+
+QSGNode *BandSeriesItem::createContentNode()
+{
+    return SeriesGeometry::createColoredNode(QSGGeometry::DrawTriangleStrip);
+}
+
+void BandSeriesItem::updateContentNode(QSGNode *node)
+{
+    if (!isContentDirty()) return;
+
+    const QVector<QPolygonF> upper = decimate(m_upper, Decimation::Max);
+    const QVector<QPolygonF> lower = decimate(m_lower, Decimation::Min);
+    SeriesGeometry::StripVertices strip;
+    for (int i = 0; i < qMin(upper.size(), lower.size()); ++i) {
+        SeriesGeometry::appendBand(strip, upper[i], lower[i], m_color);
+    }
+
+    auto *geometryNode = static_cast<QSGGeometryNode *>(node);
+    SeriesGeometry::upload(geometryNode->geometry(), strip);
+    geometryNode->markDirty(QSGNode::DirtyGeometry);
+}
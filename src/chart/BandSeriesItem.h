@@ -0,0 +1,50 @@
+#ifndef BANDSERIESITEM_H
+#define BANDSERIESITEM_H
+
+#include <QColor>
+#include <QString>
+#include <QVector>
+
+#include "ChartSeriesItem.h"
+
+// 场景图填充带：填充provider窗口中upperSeries和lowerSeries两条指标输出之间的区域，
+// 例如布林带的BBANDS.upper和BBANDS.lower。
+// 合并组的上边界取组内最大值、下边界取组内最小值，任一边界为NaN的位置断开。
+// 顶点完全在数据坐标中，视口变化只更新变换矩阵。
+class BandSeriesItem : public ChartSeriesItem
+{
+    Q_OBJECT
+    Q_PROPERTY(QString upperSeries READ upperSeries WRITE setUpperSeries NOTIFY seriesChanged)
+    Q_PROPERTY(QString lowerSeries READ lowerSeries WRITE setLowerSeries NOTIFY seriesChanged)
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
+
+public:
+    explicit BandSeriesItem(QQuickItem *parent = nullptr);
+
+    QString upperSeries() const { return m_upperSeries; }
+    void setUpperSeries(const QString &name);
+    QString lowerSeries() const { return m_lowerSeries; }
+    void setLowerSeries(const QString &name);
+    QColor color() const { return m_color; }
+    void setColor(const QColor &color);
+
+signals:
+    void seriesChanged();
+    void colorChanged();
+
+protected:
+    void loadData(const KLineWindowSnapshot *window) override;
+    int dataCount() const override { return qMin(m_upper.size(), m_lower.size()); }
+    bool dataRange(int from, int to, double *min, double *max) const override;
+    QSGNode *createContentNode() override;
+    void updateContentNode(QSGNode *node) override;
+
+private:
+    QString m_upperSeries;
+    QString m_lowerSeries;
+    QColor m_color = QColor(0x46, 0x82, 0xB4, 0x40);
+    QVector<double> m_upper;
+    QVector<double> m_lower;
+};
+
+#endif  // BANDSERIESITEM_H
@@ -0,0 +1,144 @@
+#include "CandleSeriesItem.h"
+
+#include <QSGGeometryNode>
+
+#include "SeriesGeometry.h"
+#include "core/KLineDataProvider.h"
+
+CandleSeriesItem::CandleSeriesItem(QQuickItem *parent) : ChartSeriesItem(parent) {}
+
+void CandleSeriesItem::setRisingColor(const QColor &color)
+{
+    if (m_risingColor == color) return;
+
+    m_risingColor = color;
+    emit colorsChanged();
+    markContentDirty();
+}
+
+void CandleSeriesItem::setFallingColor(const QColor &color)
+{
+    if (m_fallingColor == color) return;
+
+    m_fallingColor = color;
+    emit colorsChanged();
+    markContentDirty();
+}
+
+void CandleSeriesItem::invalidateBar(int index)
+{
+    if (!provider()) return;
+
+    const KLineWindowSnapshotPtr window = provider()->snapshot();
+    const KLineColumns &bars = window->bars;
+    const qint64 local = index - window->firstBar;
+    const bool sameLayout = window->firstBar == dataOffset() && bars.size() == m_bars.size();
+    if (!sameLayout || lodLevel() != 0 || local < 0 || local >= bars.size() || m_dirtyBar >= 0) {
+        reload();
+        return;
+    }
+
+    m_bars = bars;
+    m_dirtyBar = int(local);
+    update();
+}
+
+void CandleSeriesItem::loadData(const KLineWindowSnapshot *window)
+{
+    m_bars = window ? window->bars : KLineColumns();
+    setValueOrigin(m_bars.isEmpty() ? 0 : m_bars.close.first());
+    m_dirtyBar = -1;
+}
+
+bool CandleSeriesItem::dataRange(int from, int to, double *min, double *max) const
+{
+    *min = m_bars.low[from];
+    *max = m_bars.high[from];
+    for (int i = from + 1; i < to; ++i) {
+        *min = qMin(*min, m_bars.low[i]);
+        *max = qMax(*max, m_bars.high[i]);
+    }
+    // 上下各留10%
+    const double margin = (*max - *min) * 0.1;
+    *min -= margin;
+    *max += margin;
+    return true;
+}
+
+QSGNode *CandleSeriesItem::createContentNode()
+{
+    auto *node = new QSGNode;
+    node->appendChildNode(SeriesGeometry::createColoredNode(QSGGeometry::DrawTriangles));
+    node->appendChildNode(SeriesGeometry::createColoredNode(QSGGeometry::DrawLines));
+    return node;
+}
+
+void CandleSeriesItem::updateContentNode(QSGNode *node)
+{
+    auto *bodyNode = static_cast<QSGGeometryNode *>(node->childAtIndex(0));
+    auto *wickNode = static_cast<QSGGeometryNode *>(node->childAtIndex(1));
+    QSGGeometry *bodies = bodyNode->geometry();
+    QSGGeometry *wicks = wickNode->geometry();
+
+    if (isContentDirty()) {
+        const qint64 first = firstGroup();
+        const int slots = groupCount();
+        bodies->allocate(slots * kBodyVertices);
+        wicks->allocate(slots * kWickVertices);
+        for (int slot = 0; slot < slots; ++slot) {
+            int from = 0, to = 0;
+            const double left = groupBounds(first, slot, &from, &to);
+            writeCandle(bodies, wicks, slot, left, from, to);
+        }
+    } else if (m_dirtyBar >= 0) {
+        // LOD为0时每根K线一组，组序号就是窗口内序号
+        writeCandle(bodies, wicks, m_dirtyBar, m_dirtyBar, m_dirtyBar, m_dirtyBar + 1);
+    } else {
+        return;
+    }
+
+    m_dirtyBar = -1;
+    bodyNode->markDirty(QSGNode::DirtyGeometry);
+    wickNode->markDirty(QSGNode::DirtyGeometry);
+}
+
+void CandleSeriesItem::writeCandle(QSGGeometry *bodies, QSGGeometry *wicks, int slot,
+                                   double left, int from, int to) const
+{
+    const double open = m_bars.open[from];
+    const double close = m_bars.close[to - 1];
+    double high = m_bars.high[from];
+    double low = m_bars.low[from];
+    for (int i = from + 1; i < to; ++i) {
+        high = qMax(high, m_bars.high[i]);
+        low = qMin(low, m_bars.low[i]);
+    }
+
+    // 合并组在数据坐标中占据[left, left + span)
+    const double span = double(lodSpan());
+    const double origin = valueOrigin();
+    const float x0 = float(left + span * 0.2);
+    const float x1 = float(left + span * 0.8);
+    const float xc = float(left + span * 0.5);
+    const float yOpen = float(open - origin);
+    const float yClose = float(close - origin);
+
+    const QColor &color = close >= open ? m_risingColor : m_fallingColor;
+    SeriesGeometry::writeRect(bodies->vertexDataAsColoredPoint2D() + slot * kBodyVertices, x0,
+                              yOpen, x1, yClose, color);
+
+    const uchar r = uchar(color.red());
+    const uchar g = uchar(color.green());
+    const uchar b = uchar(color.blue());
+    QSGGeometry::ColoredPoint2D *wick = wicks->vertexDataAsColoredPoint2D() + slot * kWickVertices;
+    wick[0].set(xc, float(high - origin), r, g, b, 255);
+    wick[1].set(xc, float(low - origin), r, g, b, 255);
+    // 开盘等于收盘时实体高度为0，补一条横线；否则退化为一个点不产生像素
+    if (open == close) {
+        wick[2].set(x0, yOpen, r, g, b, 255);
+        wick[3].set(x1, yOpen, r, g, b, 255);
+    } else {
+        wick[2].set(xc, yOpen, r, g, b, 255);
+        wick[3].set(xc, yOpen, r, g, b, 255);
+    }
+}
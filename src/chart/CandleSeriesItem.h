@@ -0,0 +1,53 @@
+#ifndef CANDLESERIESITEM_H
+#define CANDLESERIESITEM_H
+
+#include <QColor>
+
+#include "ChartSeriesItem.h"
+#include "core/KLineColumns.h"
+
+class QSGGeometry;
+
+// 场景图K线组件：实体为三角形，影线为线段，两者各一个顶点着色的几何节点。
+// 合并组的开盘取第一根、收盘取最后一根、最高最低取组内极值。
+class CandleSeriesItem : public ChartSeriesItem
+{
+    Q_OBJECT
+    Q_PROPERTY(QColor risingColor READ risingColor WRITE setRisingColor NOTIFY colorsChanged)
+    Q_PROPERTY(QColor fallingColor READ fallingColor WRITE setFallingColor NOTIFY colorsChanged)
+
+public:
+    explicit CandleSeriesItem(QQuickItem *parent = nullptr);
+
+    QColor risingColor() const { return m_risingColor; }
+    void setRisingColor(const QColor &color);
+    QColor fallingColor() const { return m_fallingColor; }
+    void setFallingColor(const QColor &color);
+
+    // 只有第index根K线的数值变化(例如实时行情更新最后一根)时调用，只改写这一根的顶点
+    Q_INVOKABLE void invalidateBar(int index);
+
+signals:
+    void colorsChanged();
+
+protected:
+    void loadData(const KLineWindowSnapshot *window) override;
+    int dataCount() const override { return m_bars.size(); }
+    bool dataRange(int from, int to, double *min, double *max) const override;
+    QSGNode *createContentNode() override;
+    void updateContentNode(QSGNode *node) override;
+
+private:
+    static constexpr int kBodyVertices = 6;  // 两个三角形
+    static constexpr int kWickVertices = 4;  // 影线 + 十字星横线
+
+    void writeCandle(QSGGeometry *bodies, QSGGeometry *wicks, int slot, double left, int from,
+                     int to) const;
+
+    KLineColumns m_bars;
+    QColor m_risingColor = QColor(0xFF, 0x00, 0x00);
+    QColor m_fallingColor = QColor(0x00, 0xFF, 0x00);
+    int m_dirtyBar = -1;  // 窗口内序号
+};
+
+#endif  // CANDLESERIESITEM_H
@@ -0,0 +1,324 @@
+#include "ChartAxisItem.h"
+
+#include <QQuickWindow>
+#include <QSGGeometryNode>
+#include <QSGTexture>
+#include <QSGTextureMaterial>
+#include <QScopedPointer>
+#include <QtMath>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "core/KLineColumns.h"
+#include "core/KLineDataProvider.h"
+#include "core/KLineMetrics.h"
+#include "core/KLineTrace.h"
+
+namespace {
+
+// 标签几何节点，持有图集纹理
+class AxisLabelNode : public QSGGeometryNode
+{
+public:
+    AxisLabelNode() : m_geometry(QSGGeometry::defaultAttributes_TexturedPoint2D(), 0)
+    {
+        m_geometry.setDrawingMode(QSGGeometry::DrawTriangles);
+        m_material.setFlag(QSGMaterial::Blending, true);
+        setGeometry(&m_geometry);
+        setMaterial(&m_material);
+    }
+
+    void setTexture(QSGTexture *texture)
+    {
+        m_texture.reset(texture);
+        m_material.setTexture(texture);
+        markDirty(QSGNode::DirtyMaterial);
+    }
+
+private:
+    QSGGeometry m_geometry;
+    QSGTextureMaterial m_material;
+    QScopedPointer<QSGTexture> m_texture;
+};
+
+}  // namespace
+
+ChartAxisItem::ChartAxisItem(QQuickItem *parent) : QQuickItem(parent)
+{
+    setFlag(ItemHasContents, true);
+}
+
+ChartAxisItem::~ChartAxisItem() { delete m_atlas; }
+
+double ChartAxisItem::niceNumber(double range, bool round)
+{
+    if (range <= 0) return 1;
+
+    const double exponent = std::floor(std::log10(range));
+    const double magnitude = std::pow(10.0, exponent);
+    const double fraction = range / magnitude;
+    double nice;
+    if (round) {
+        nice = fraction < 1.5 ? 1 : fraction < 3 ? 2 : fraction < 7 ? 5 : 10;
+    } else {
+        nice = fraction <= 1 ? 1 : fraction <= 2 ? 2 : fraction <= 5 ? 5 : 10;
+    }
+    return nice * magnitude;
+}
+
+void ChartAxisItem::setOrientation(Orientation orientation)
+{
+    if (m_orientation == orientation) return;
+
+    m_orientation = orientation;
+    m_labelCache.clear();
+    m_labelDecimals = -1;
+    emit axisChanged();
+    reload();
+}
+
+void ChartAxisItem::setProvider(KLineDataProvider *provider)
+{
+    if (m_provider == provider) return;
+
+    if (m_provider) disconnect(m_provider, nullptr, this, nullptr);
+    m_provider = provider;
+    if (m_provider) {
+        connect(m_provider, &KLineDataProvider::dataChanged, this, &ChartAxisItem::reload);
+    }
+    emit providerChanged();
+    reload();
+}
+
+void ChartAxisItem::reload()
+{
+    // 时间轴只需要时间列，和K线列共享数据不做拷贝
+    if (m_orientation == TimeAxis && m_provider) {
+        const KLineWindowSnapshotPtr window = m_provider->snapshot();
+        m_times = window->bars.time;
+        m_dataOffset = window->firstBar;
+    } else {
+        m_times.clear();
+        m_dataOffset = 0;
+    }
+    relayout();
+}
+
+void ChartAxisItem::setField(qreal &field, qreal value)
+{
+    if (qFuzzyCompare(field, value)) return;
+
+    field = value;
+    emit axisChanged();
+    relayout();
+}
+
+void ChartAxisItem::setViewStart(qreal viewStart) { setField(m_viewStart, viewStart); }
+
+void ChartAxisItem::setViewCount(qreal viewCount) { setField(m_viewCount, viewCount); }
+
+void ChartAxisItem::setMinValue(qreal minValue) { setField(m_minValue, minValue); }
+
+void ChartAxisItem::setMaxValue(qreal maxValue) { setField(m_maxValue, maxValue); }
+
+void ChartAxisItem::setTickSpacing(qreal spacing) { setField(m_tickSpacing, spacing); }
+
+void ChartAxisItem::setColor(const QColor &color)
+{
+    if (m_color == color) return;
+
+    m_color = color;
+    emit axisChanged();
+    invalidateAtlas();
+}
+
+void ChartAxisItem::setFontPixelSize(int size)
+{
+    if (m_fontPixelSize == size) return;
+
+    m_fontPixelSize = size;
+    emit axisChanged();
+    invalidateAtlas();
+}
+
+void ChartAxisItem::invalidateAtlas()
+{
+    delete m_atlas;
+    m_atlas = nullptr;
+    relayout();
+}
+
+QVariantList ChartAxisItem::tickPositions() const
+{
+    QVariantList positions;
+    positions.reserve(m_tickPositions.size());
+    for (qreal position : m_tickPositions) positions.append(position);
+    return positions;
+}
+
+void ChartAxisItem::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size()) relayout();
+}
+
+void ChartAxisItem::itemChange(ItemChange change, const ItemChangeData &value)
+{
+    QQuickItem::itemChange(change, value);
+    // 换到另一块屏幕或第一次进入窗口时按新的设备像素比重建图集
+    if (change == ItemDevicePixelRatioHasChanged || change == ItemSceneChange) invalidateAtlas();
+}
+
+void ChartAxisItem::relayout()
+{
+    KLINE_TRACE_SCOPE("model", "ChartAxisItem::relayout");
+    if (!m_atlas) {
+        QFont font;
+        font.setPixelSize(m_fontPixelSize);
+        const qreal ratio = window() ? window()->effectiveDevicePixelRatio() : 1;
+        m_atlas = new GlyphAtlas(font, m_color, ratio);
+        m_atlasChanged = true;
+    }
+
+    // clear()保留容量，视口变化时不重新分配
+    m_tickPositions.clear();
+    m_vertices.clear();
+    if (width() > 0 && height() > 0) {
+        if (m_orientation == ValueAxis) {
+            layoutValueTicks();
+        } else {
+            layoutTimeTicks();
+        }
+    }
+    emit ticksChanged();
+    update();
+}
+
+void ChartAxisItem::layoutValueTicks()
+{
+    const double range = m_maxValue - m_minValue;
+    if (range <= 0) return;
+
+    // 经典的"好看的刻度"算法：先把范围取整，再按期望刻度数取步长
+    const int maxTicks = qMax(2, int(height() / m_tickSpacing));
+    const double step = niceNumber(niceNumber(range, false) / (maxTicks - 1), true);
+    const int decimals = qMax(0, int(-std::floor(std::log10(step))));
+
+    const qreal halfLine = m_atlas->lineHeight() / 2;
+    const qint64 first = qint64(std::ceil(m_minValue / step));
+    const qint64 last = qint64(std::floor(m_maxValue / step));
+    for (qint64 k = first; k <= last; ++k) {
+        const double value = k * step;
+        const qreal y = (m_maxValue - value) / range * height();
+        m_tickPositions.append(y);
+        m_atlas->appendText(m_vertices, valueLabel(value, decimals), 5, y - halfLine);
+    }
+}
+
+void ChartAxisItem::layoutTimeTicks()
+{
+    if (m_viewCount <= 0 || m_times.isEmpty()) return;
+
+    // 刻度步长取好看的K线根数，刻度落在完整序列序号的整数倍上
+    const qreal barWidth = width() / m_viewCount;
+    const qint64 step =
+        qMax<qint64>(1, qint64(std::ceil(niceNumber(m_tickSpacing / barWidth, false))));
+    const qint64 viewFirst = qint64(std::floor(m_viewStart));
+    const qint64 viewEnd = qint64(std::ceil(m_viewStart + m_viewCount));
+
+    const qreal lineHeight = m_atlas->lineHeight();
+    qint64 previousDay = std::numeric_limits<qint64>::min();
+    for (qint64 index = KLineTime::floorDiv(viewFirst + step - 1, step) * step; index < viewEnd;
+         index += step) {
+        const qint64 local = index - m_dataOffset;
+        if (local < 0 || local >= m_times.size()) continue;
+
+        const qint64 time = m_times[local];
+        const qint64 day = KLineTime::floorDiv(time, KLineTime::kDayMs);
+        const bool dailyBar = time - day * KLineTime::kDayMs == 0;
+        const bool newDay = day != previousDay;
+        previousDay = day;
+
+        const qreal x = (index + 0.5 - m_viewStart) * barWidth;
+        m_tickPositions.append(x);
+        // 第一行为时分，跨日时第二行显示日期；日线及以上周期只显示日期
+        qreal y = 4;
+        if (!dailyBar) {
+            const QString &label = timeLabel(time, false);
+            m_atlas->appendText(m_vertices, label, x - m_atlas->textWidth(label) / 2, y);
+            y += lineHeight;
+        }
+        if (dailyBar || newDay) {
+            const QString &label = timeLabel(time, true);
+            m_atlas->appendText(m_vertices, label, x - m_atlas->textWidth(label) / 2, y);
+        }
+    }
+}
+
+const QString &ChartAxisItem::valueLabel(double value, int decimals)
+{
+    if (decimals != m_labelDecimals) {
+        m_labelCache.clear();
+        m_labelDecimals = decimals;
+    }
+    if (m_labelCache.size() > kLabelCacheLimit) m_labelCache.clear();
+
+    // 按显示精度取整后的数值作键，同一刻度只格式化一次
+    const qint64 key = qRound64(value * std::pow(10.0, decimals));
+    auto it = m_labelCache.find(key);
+    if (it == m_labelCache.end()) {
+        it = m_labelCache.insert(key, QString::number(value, 'f', decimals));
+    }
+    return *it;
+}
+
+const QString &ChartAxisItem::timeLabel(qint64 msecs, bool withDate)
+{
+    if (m_labelCache.size() > kLabelCacheLimit) m_labelCache.clear();
+
+    // 时间戳精确到分钟，最低位区分日期和时分
+    const qint64 key = KLineTime::floorDiv(msecs, KLineTime::kMinuteMs) * 2 + (withDate ? 1 : 0);
+    auto it = m_labelCache.find(key);
+    if (it != m_labelCache.end()) return *it;
+
+    const qint64 day = KLineTime::floorDiv(msecs, KLineTime::kDayMs);
+    QString label;
+    if (withDate) {
+        int year = 0, month = 0, dayOfMonth = 0;
+        KLineTime::civilFromDays(day, &year, &month, &dayOfMonth);
+        label = QString::asprintf("%02d-%02d", month, dayOfMonth);
+    } else {
+        const qint64 minutes = (msecs - day * KLineTime::kDayMs) / KLineTime::kMinuteMs;
+        label = QString::asprintf("%02d:%02d", int(minutes / 60), int(minutes % 60));
+    }
+    return *m_labelCache.insert(key, label);
+}
+
+QSGNode *ChartAxisItem::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+{
+    KLINE_TRACE_SCOPE("render", "ChartAxisItem::updatePaintNode");
+    static KLineMetrics::Histogram &paintTime = KLineMetrics::histogram("paint.ChartAxisItem");
+    KLineMetrics::ScopedTimer paintTimer(paintTime);
+    auto *node = static_cast<AxisLabelNode *>(oldNode);
+    if (!m_atlas || m_vertices.isEmpty()) {
+        delete node;
+        return nullptr;
+    }
+
+    if (!node) {
+        node = new AxisLabelNode;
+        m_atlasChanged = true;
+    }
+    if (m_atlasChanged) {
+        node->setTexture(window()->createTextureFromImage(m_atlas->image()));
+        m_atlasChanged = false;
+    }
+
+    QSGGeometry *geometry = node->geometry();
+    if (geometry->vertexCount() != m_vertices.size()) geometry->allocate(m_vertices.size());
+    std::memcpy(geometry->vertexDataAsTexturedPoint2D(), m_vertices.constData(),
+                m_vertices.size() * sizeof(QSGGeometry::TexturedPoint2D));
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
@@ -0,0 +1,113 @@
+#ifndef CHARTAXISITEM_H
+#define CHARTAXISITEM_H
+
+#include <QColor>
+#include <QHash>
+#include <QPointer>
+#include <QQuickItem>
+#include <QSGGeometry>
+#include <QVariantList>
+#include <QVector>
+
+#include "GlyphAtlas.h"
+
+class KLineDataProvider;
+
+// 场景图坐标轴标签
+//
+// 价格轴(ValueAxis)放在绘图区左侧、与绘图区等高，按minValue/maxValue用"好看的数"
+// (1、2、5乘以10的幂)选取刻度；时间轴(TimeAxis)放在绘图区下方、与绘图区等宽，
+// 刻度取完整序列序号中步长的整数倍，平移时刻度随K线移动而不跳动。
+//
+// 所有标签是同一张字形图集上的贴图四边形，只有一个几何节点。格式化后的字符串按数值缓存，
+// 刻度和顶点数组在成员中复用，视口变化时不做字符串格式化以外的堆分配。
+class ChartAxisItem : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(Orientation orientation READ orientation WRITE setOrientation NOTIFY axisChanged)
+    Q_PROPERTY(KLineDataProvider *provider READ provider WRITE setProvider NOTIFY providerChanged)
+    Q_PROPERTY(qreal viewStart READ viewStart WRITE setViewStart NOTIFY axisChanged)
+    Q_PROPERTY(qreal viewCount READ viewCount WRITE setViewCount NOTIFY axisChanged)
+    Q_PROPERTY(qreal minValue READ minValue WRITE setMinValue NOTIFY axisChanged)
+    Q_PROPERTY(qreal maxValue READ maxValue WRITE setMaxValue NOTIFY axisChanged)
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY axisChanged)
+    Q_PROPERTY(int fontPixelSize READ fontPixelSize WRITE setFontPixelSize NOTIFY axisChanged)
+    // 相邻刻度之间的最小像素间距
+    Q_PROPERTY(qreal tickSpacing READ tickSpacing WRITE setTickSpacing NOTIFY axisChanged)
+
+public:
+    enum Orientation { ValueAxis, TimeAxis };
+    Q_ENUM(Orientation)
+
+    explicit ChartAxisItem(QQuickItem *parent = nullptr);
+    ~ChartAxisItem() override;
+
+    Orientation orientation() const { return m_orientation; }
+    void setOrientation(Orientation orientation);
+    KLineDataProvider *provider() const { return m_provider; }
+    void setProvider(KLineDataProvider *provider);
+    qreal viewStart() const { return m_viewStart; }
+    void setViewStart(qreal viewStart);
+    qreal viewCount() const { return m_viewCount; }
+    void setViewCount(qreal viewCount);
+    qreal minValue() const { return m_minValue; }
+    void setMinValue(qreal minValue);
+    qreal maxValue() const { return m_maxValue; }
+    void setMaxValue(qreal maxValue);
+    QColor color() const { return m_color; }
+    void setColor(const QColor &color);
+    int fontPixelSize() const { return m_fontPixelSize; }
+    void setFontPixelSize(int size);
+    qreal tickSpacing() const { return m_tickSpacing; }
+    void setTickSpacing(qreal spacing);
+
+    // 当前刻度在组件内的位置(价格轴为y，时间轴为x)，网格层按它画线
+    Q_INVOKABLE QVariantList tickPositions() const;
+
+    // 不小于range的"好看的数"(round为false)或最接近range的"好看的数"(round为true)
+    static double niceNumber(double range, bool round);
+
+signals:
+    void axisChanged();
+    void providerChanged();
+    void ticksChanged();
+
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void itemChange(ItemChange change, const ItemChangeData &value) override;
+
+private:
+    static constexpr int kLabelCacheLimit = 4096;
+
+    void reload();
+    void setField(qreal &field, qreal value);
+    void invalidateAtlas();
+    void relayout();
+    void layoutValueTicks();
+    void layoutTimeTicks();
+    const QString &valueLabel(double value, int decimals);
+    const QString &timeLabel(qint64 msecs, bool withDate);
+
+    Orientation m_orientation = ValueAxis;
+    QPointer<KLineDataProvider> m_provider;
+    QVector<qint64> m_times;  // 当前窗口的K线时间，时间轴使用
+    qint64 m_dataOffset = 0;
+    qreal m_viewStart = 0;
+    qreal m_viewCount = 1;
+    qreal m_minValue = 0;
+    qreal m_maxValue = 1;
+    QColor m_color = Qt::white;
+    int m_fontPixelSize = 12;
+    qreal m_tickSpacing = 40;
+
+    QVector<qreal> m_tickPositions;
+    QVector<QSGGeometry::TexturedPoint2D> m_vertices;
+    int m_labelDecimals = -1;
+    QHash<qint64, QString> m_labelCache;
+
+    GlyphAtlas *m_atlas = nullptr;  // 在GUI线程上构建，渲染线程只在同步阶段读取
+    bool m_atlasChanged = true;  // 图集重建后渲染线程需要重新上传纹理
+};
+
+#endif  // CHARTAXISITEM_H
@@ -0,0 +1,112 @@
+#include "ChartExporter.h"
+
+#include <QAtomicInt>
+#include <QDebug>
+#include <QFileInfo>
+#include <QImage>
+#include <QPainter>
+#include <QSvgGenerator>
+#include <QThreadPool>
+#include <QtMath>
+
+#include "KLineChartRenderer.h"
+#include "core/KLineCsv.h"
+#include "core/KLineDataProvider.h"
+
+namespace ChartExporter {
+
+bool exportChart(const ChartExportJob &job, QString *error)
+{
+    const QString writeError = QStringLiteral("cannot write %1").arg(job.output);
+    auto fail = [error](const QString &message) {
+        if (error) *error = message;
+        return false;
+    };
+
+    // 与界面走同一个Worker，只是在当前线程同步调用：dataProcessed直接连接到局部变量
+    KLineDataWorker worker;
+    worker.setIndicators(job.indicators);
+    KLineColumns bars;
+    KLineSeriesMap series;
+    QObject::connect(&worker, &KLineDataWorker::dataProcessed,
+                     [&bars, &series](int, const KLineColumns &result,
+                                      const KLineSeriesMap &output) {
+                         bars = result;
+                         series = output;
+                     });
+
+    if (job.input.endsWith(".kla", Qt::CaseInsensitive)) {
+        auto reader = QSharedPointer<KLineArchiveReader>::create();
+        if (!reader->open(job.input)) return fail(reader->errorString());
+        worker.processArchive(KLineDataWorker::kNoGeneration, reader, job.period);
+    } else {
+        KLineColumns rawBars;
+        KLineTicks ticks;
+        QString readError;
+        if (!KLineCsv::readFile(job.input, rawBars, ticks, &readError)) return fail(readError);
+        if (!ticks.isEmpty()) {
+            worker.processTicks(KLineDataWorker::kNoGeneration, ticks, job.period);
+        } else {
+            worker.processData(KLineDataWorker::kNoGeneration, rawBars, job.period);
+        }
+    }
+    if (bars.isEmpty()) return fail(QStringLiteral("no bars for period %1").arg(job.period));
+
+    KLineChartRenderer renderer(bars, series);
+    renderer.setIndicators(job.indicators);
+    renderer.setTitle(QStringLiteral("%1  %2  %3 - %4")
+                          .arg(QFileInfo(job.input).completeBaseName(), job.period,
+                               KLineTime::format(bars.time.first()),
+                               KLineTime::format(bars.time.last())));
+    const int count = job.bars > 0 ? qMin(job.bars, bars.size()) : bars.size();
+    renderer.setView(bars.size() - count, count);
+
+    const QRectF rect(QPointF(0, 0), QSizeF(job.size));
+    if (job.format == ChartExportJob::Svg) {
+        QSvgGenerator generator;
+        generator.setFileName(job.output);
+        generator.setSize(job.size);
+        generator.setViewBox(rect);
+        generator.setTitle(QFileInfo(job.input).completeBaseName());
+        QPainter painter;
+        if (!painter.begin(&generator)) return fail(writeError);
+        renderer.render(&painter, rect);
+        painter.end();
+        return true;
+    }
+
+    // 软件光栅化：按设备像素比放大像素尺寸，布局仍以逻辑尺寸计算
+    const qreal scale = qMax<qreal>(0.1, job.scale);
+    QImage image(qCeil(job.size.width() * scale), qCeil(job.size.height() * scale),
+                 QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(scale);
+    {
+        QPainter painter(&image);
+        renderer.render(&painter, rect);
+    }
+    if (!image.save(job.output, "PNG")) return fail(writeError);
+    return true;
+}
+
+int exportAll(const QList<ChartExportJob> &jobs, int maxThreads)
+{
+    QThreadPool pool;
+    if (maxThreads > 0) pool.setMaxThreadCount(maxThreads);
+
+    QAtomicInt succeeded = 0;
+    for (const ChartExportJob &job : jobs) {
+        pool.start([job, &succeeded]() {
+            QString error;
+            if (exportChart(job, &error)) {
+                succeeded.ref();
+                qDebug() << "ChartExporter: 已导出" << job.output;
+            } else {
+                qDebug() << "ChartExporter: 导出失败" << job.input << error;
+            }
+        });
+    }
+    pool.waitForDone();
+    return succeeded.loadRelaxed();
+}
+
+}  // namespace ChartExporter
@@ -0,0 +1,36 @@
+#ifndef CHARTEXPORTER_H
+#define CHARTEXPORTER_H
+
+#include <QList>
+#include <QSize>
+#include <QString>
+#include <QStringList>
+
+// 一个导出任务：一个数据文件按指定周期、指标和视口画成一张图
+struct ChartExportJob
+{
+    enum Format { Png, Svg };
+
+    QString input;   // CSV或.kla归档
+    QString output;  // 输出文件，扩展名不决定格式
+    QString period = "1m";
+    QStringList indicators = {"MA"};
+    int bars = 120;  // 视口为最后bars根K线，<= 0表示全部
+    QSize size = QSize(1280, 720);
+    qreal scale = 1;  // PNG的设备像素比，布局按size计算，像素尺寸为size * scale
+    Format format = Png;
+};
+
+// 无界面的批量导出：每个任务在线程池中独立完成读取、合成、指标计算和绘制，
+// 不创建窗口也不需要QML，QT_QPA_PLATFORM=offscreen下即可运行。
+namespace ChartExporter {
+
+// 执行单个任务，失败时返回false并写入error
+bool exportChart(const ChartExportJob &job, QString *error = nullptr);
+
+// 并行执行全部任务并等待完成，返回成功的数量；maxThreads <= 0时按CPU核数并行
+int exportAll(const QList<ChartExportJob> &jobs, int maxThreads = 0);
+
+}  // namespace ChartExporter
+
+#endif  // CHARTEXPORTER_H
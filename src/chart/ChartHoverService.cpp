@@ -0,0 +1,161 @@
+#include "ChartHoverService.h"
+
+#include <QtMath>
+#include <algorithm>
+#include <cmath>
+
+#include "core/KLineDataProvider.h"
+#include "core/KLineMetrics.h"
+
+ChartHoverService::ChartHoverService(QObject *parent) : QObject(parent) {}
+
+void ChartHoverService::setProvider(KLineDataProvider *provider)
+{
+    if (m_provider == provider) return;
+
+    if (m_provider) disconnect(m_provider, nullptr, this, nullptr);
+    m_provider = provider;
+    if (m_provider) {
+        connect(m_provider, &KLineDataProvider::dataChanged, this, &ChartHoverService::reload);
+    }
+    emit providerChanged();
+    reload();
+}
+
+void ChartHoverService::reload()
+{
+    // 一次取出快照，K线和偏移来自同一个窗口
+    const KLineWindowSnapshotPtr window = m_provider ? m_provider->snapshot() : nullptr;
+    m_bars = window ? window->bars : KLineColumns();
+    m_dataOffset = window ? window->firstBar : 0;
+    m_totalCount = m_provider ? m_provider->totalCount() : 0;
+
+    // 实时行情可能改写了悬停的K线，重新生成快照
+    if (m_lastX >= 0) {
+        publish(indexAt(m_lastX));
+    } else if (m_snapshot.valid) {
+        publish(-1);
+    }
+}
+
+void ChartHoverService::setAxisMode(AxisMode mode)
+{
+    if (m_axisMode == mode) return;
+
+    m_axisMode = mode;
+    emit viewChanged();
+    if (m_lastX >= 0) publish(indexAt(m_lastX));
+}
+
+void ChartHoverService::setView(qreal &field, qreal value)
+{
+    if (qFuzzyCompare(field, value)) return;
+
+    field = value;
+    emit viewChanged();
+    // 拖动时鼠标不动而K线移动，悬停的K线随之变化
+    if (m_lastX >= 0) publish(indexAt(m_lastX));
+}
+
+void ChartHoverService::setViewStart(qreal viewStart) { setView(m_viewStart, viewStart); }
+
+void ChartHoverService::setViewCount(qreal viewCount) { setView(m_viewCount, viewCount); }
+
+void ChartHoverService::setPlotLeft(qreal left) { setView(m_plotLeft, left); }
+
+void ChartHoverService::setPlotWidth(qreal width) { setView(m_plotWidth, width); }
+
+int ChartHoverService::indexAt(qreal x) const
+{
+    if (m_bars.isEmpty() || m_plotWidth <= 0 || m_viewCount <= 0) return -1;
+
+    const qreal ratio = (x - m_plotLeft) / m_plotWidth;
+    if (ratio < 0 || ratio > 1) return -1;
+
+    qint64 index;
+    if (m_axisMode == TimeAxis) {
+        index = timeIndexAt(ratio);
+        if (index < 0) return -1;
+    } else {
+        index = qint64(std::floor(m_viewStart + ratio * m_viewCount));
+    }
+
+    // 限制在可见且已加载的范围内
+    const qint64 first = qMax<qint64>(m_dataOffset, qint64(std::floor(m_viewStart)));
+    const qint64 last = qMin<qint64>(m_dataOffset + m_bars.size(), m_totalCount) - 1;
+    if (last < first) return -1;
+    return int(qBound(first, index, last));
+}
+
+int ChartHoverService::timeIndexAt(qreal ratio) const
+{
+    // 横轴从第一根可见K线的时间线性排到最后一根，在时间列上找最近的K线
+    const int from = int(qBound<qint64>(0, qint64(std::floor(m_viewStart)) - m_dataOffset,
+                                        m_bars.size() - 1));
+    const int to = int(qBound<qint64>(
+        0, qint64(std::ceil(m_viewStart + m_viewCount)) - m_dataOffset - 1, m_bars.size() - 1));
+    if (to < from) return -1;
+
+    const qint64 startTime = m_bars.time[from];
+    const qint64 endTime = m_bars.time[to];
+    const qint64 target = startTime + qint64(std::llround((endTime - startTime) * ratio));
+
+    const auto begin = m_bars.time.cbegin() + from;
+    const auto end = m_bars.time.cbegin() + to + 1;
+    auto it = std::lower_bound(begin, end, target);
+    if (it == end) {
+        --it;
+    } else if (it != begin && target - *(it - 1) < *it - target) {
+        --it;
+    }
+    return int(m_dataOffset + (it - m_bars.time.cbegin()));
+}
+
+int ChartHoverService::hover(qreal x)
+{
+    // 十字光标随鼠标移动，输入到屏幕的延迟从这里开始计时
+    KLineMetrics::inputProbe().mark();
+    m_lastX = x;
+    publish(indexAt(x));
+    return m_snapshot.index;
+}
+
+void ChartHoverService::clear()
+{
+    m_lastX = -1;
+    publish(-1);
+}
+
+void ChartHoverService::publish(int index)
+{
+    const qint64 local = index - m_dataOffset;
+    if (index < 0 || local < 0 || local >= m_bars.size()) {
+        if (!m_snapshot.valid) return;
+        m_snapshot = KLineHoverSnapshot();
+        emit snapshotChanged();
+        return;
+    }
+
+    // 同一根K线且数值未变时不重新发布，QML绑定不会重新求值
+    const int i = int(local);
+    if (m_snapshot.valid && m_snapshot.index == index && m_snapshot.close == m_bars.close[i] &&
+        m_snapshot.high == m_bars.high[i] && m_snapshot.low == m_bars.low[i] &&
+        m_snapshot.volume == m_bars.volume[i]) {
+        return;
+    }
+
+    KLineHoverSnapshot snapshot;
+    snapshot.valid = true;
+    snapshot.index = index;
+    snapshot.time = KLineTime::format(m_bars.time[i]);
+    snapshot.open = m_bars.open[i];
+    snapshot.high = m_bars.high[i];
+    snapshot.low = m_bars.low[i];
+    snapshot.close = m_bars.close[i];
+    snapshot.volume = m_bars.volume[i];
+    snapshot.change = snapshot.close - snapshot.open;
+    snapshot.changePercent = snapshot.open > 0 ? snapshot.change / snapshot.open * 100 : 0;
+    snapshot.rising = snapshot.close >= snapshot.open;
+    m_snapshot = snapshot;
+    emit snapshotChanged();
+}
@@ -0,0 +1,117 @@
+#ifndef CHARTHOVERSERVICE_H
+#define CHARTHOVERSERVICE_H
+
+#include <QMetaType>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+
+#include "core/KLineColumns.h"
+
+class KLineDataProvider;
+
+// 鼠标悬停的K线快照：构造后不再修改，QML整体读取，工具提示的各行都绑定到同一个值
+struct KLineHoverSnapshot
+{
+    Q_GADGET
+    Q_PROPERTY(bool valid MEMBER valid CONSTANT)
+    Q_PROPERTY(int index MEMBER index CONSTANT)
+    Q_PROPERTY(QString time MEMBER time CONSTANT)
+    Q_PROPERTY(double open MEMBER open CONSTANT)
+    Q_PROPERTY(double high MEMBER high CONSTANT)
+    Q_PROPERTY(double low MEMBER low CONSTANT)
+    Q_PROPERTY(double close MEMBER close CONSTANT)
+    Q_PROPERTY(double volume MEMBER volume CONSTANT)
+    Q_PROPERTY(double change MEMBER change CONSTANT)
+    Q_PROPERTY(double changePercent MEMBER changePercent CONSTANT)
+    Q_PROPERTY(bool rising MEMBER rising CONSTANT)
+
+public:
+    bool valid = false;
+    int index = -1;  // 完整序列序号
+    QString time;
+    double open = 0;
+    double high = 0;
+    double low = 0;
+    double close = 0;
+    double volume = 0;
+    double change = 0;
+    double changePercent = 0;
+    bool rising = false;
+};
+
+Q_DECLARE_METATYPE(KLineHoverSnapshot)
+
+// 悬停服务：把鼠标横坐标映射为K线序号，并发布该K线的快照
+//
+// BarAxis下K线等间距，序号由算术直接得到；TimeAxis下横轴按时间线性分布，
+// 在窗口的时间列上二分查找最近的K线。数据直接取自provider的列式窗口，
+// 悬停过程中不切片数组；只有悬停的K线变化时才更新快照、发出一次snapshotChanged。
+class ChartHoverService : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(KLineDataProvider *provider READ provider WRITE setProvider NOTIFY providerChanged)
+    Q_PROPERTY(AxisMode axisMode READ axisMode WRITE setAxisMode NOTIFY viewChanged)
+    Q_PROPERTY(qreal viewStart READ viewStart WRITE setViewStart NOTIFY viewChanged)
+    Q_PROPERTY(qreal viewCount READ viewCount WRITE setViewCount NOTIFY viewChanged)
+    // 绘图区在鼠标坐标系中的左边界和宽度
+    Q_PROPERTY(qreal plotLeft READ plotLeft WRITE setPlotLeft NOTIFY viewChanged)
+    Q_PROPERTY(qreal plotWidth READ plotWidth WRITE setPlotWidth NOTIFY viewChanged)
+    Q_PROPERTY(int index READ index NOTIFY snapshotChanged)
+    Q_PROPERTY(KLineHoverSnapshot snapshot READ snapshot NOTIFY snapshotChanged)
+
+public:
+    enum AxisMode { BarAxis, TimeAxis };
+    Q_ENUM(AxisMode)
+
+    explicit ChartHoverService(QObject *parent = nullptr);
+
+    KLineDataProvider *provider() const { return m_provider; }
+    void setProvider(KLineDataProvider *provider);
+    AxisMode axisMode() const { return m_axisMode; }
+    void setAxisMode(AxisMode mode);
+    qreal viewStart() const { return m_viewStart; }
+    void setViewStart(qreal viewStart);
+    qreal viewCount() const { return m_viewCount; }
+    void setViewCount(qreal viewCount);
+    qreal plotLeft() const { return m_plotLeft; }
+    void setPlotLeft(qreal left);
+    qreal plotWidth() const { return m_plotWidth; }
+    void setPlotWidth(qreal width);
+
+    int index() const { return m_snapshot.index; }
+    KLineHoverSnapshot snapshot() const { return m_snapshot; }
+
+    // 横坐标x处的K线序号，不在绘图区或没有数据时返回-1
+    Q_INVOKABLE int indexAt(qreal x) const;
+    // 鼠标移动到x：更新快照并返回悬停的K线序号
+    Q_INVOKABLE int hover(qreal x);
+    Q_INVOKABLE void clear();
+
+signals:
+    void providerChanged();
+    void viewChanged();
+    void snapshotChanged();
+
+private:
+    void reload();
+    void setView(qreal &field, qreal value);
+    void publish(int index);
+    int timeIndexAt(qreal ratio) const;
+
+    QPointer<KLineDataProvider> m_provider;
+    KLineColumns m_bars;  // provider当前窗口，与provider共享数据
+    qint64 m_dataOffset = 0;
+    qint64 m_totalCount = 0;
+
+    AxisMode m_axisMode = BarAxis;
+    qreal m_viewStart = 0;
+    qreal m_viewCount = 1;
+    qreal m_plotLeft = 0;
+    qreal m_plotWidth = 0;
+    qreal m_lastX = -1;  // 最后一次悬停的横坐标，数据或视口变化时据此刷新快照
+
+    KLineHoverSnapshot m_snapshot;
+};
+
+#endif  // CHARTHOVERSERVICE_H
@@ -0,0 +1,165 @@
+#include "ChartMetrics.h"
+
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QJsonObject>
+#include <QQuickWindow>
+#include <QStandardPaths>
+
+#include "core/KLineMetrics.h"
+
+namespace {
+
+// 场景图按需渲染，空闲后恢复的第一帧间隔不是帧时间，不计入
+constexpr qint64 kIdleGapNs = 250 * 1000 * 1000;
+
+}  // namespace
+
+ChartMetrics::ChartMetrics(QQuickItem *parent) : QQuickItem(parent)
+{
+    m_timer.setInterval(500);
+    connect(&m_timer, &QTimer::timeout, this, &ChartMetrics::refresh);
+}
+
+ChartMetrics::~ChartMetrics()
+{
+    attach(nullptr);
+    if (m_active) KLineMetrics::release();
+}
+
+void ChartMetrics::setActive(bool active)
+{
+    if (m_active == active) return;
+
+    m_active = active;
+    if (m_active) {
+        KLineMetrics::retain();
+        m_timer.start();
+        refresh();
+    } else {
+        KLineMetrics::release();
+        m_timer.stop();
+    }
+    emit activeChanged();
+}
+
+void ChartMetrics::setInterval(int interval)
+{
+    interval = qMax(50, interval);
+    if (m_timer.interval() == interval) return;
+
+    m_timer.setInterval(interval);
+    emit intervalChanged();
+}
+
+void ChartMetrics::markTick() { KLineMetrics::tickProbe().mark(); }
+
+QString ChartMetrics::exportJson(const QString &path)
+{
+    QString target = path;
+    if (target.isEmpty()) {
+        const QDir dir(QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation));
+        if (!dir.exists() && !QDir().mkpath(dir.path())) {
+            qDebug() << "ChartMetrics: 无法创建目录:" << dir.path();
+            return QString();
+        }
+        const QString stamp = QDateTime::currentDateTime().toString("yyyyMMdd-hhmmss");
+        target = dir.filePath(QString("metrics-%1.json").arg(stamp));
+    }
+
+    QString error;
+    if (!KLineMetrics::exportJson(target, &error)) {
+        qDebug() << "ChartMetrics: 指标写出失败:" << target << error;
+        return QString();
+    }
+    qDebug() << "ChartMetrics: 指标已写出:" << target;
+    return target;
+}
+
+void ChartMetrics::reset()
+{
+    KLineMetrics::reset();
+    m_lastSwap = -1;
+    refresh();
+}
+
+void ChartMetrics::itemChange(ItemChange change, const ItemChangeData &value)
+{
+    QQuickItem::itemChange(change, value);
+    if (change == ItemSceneChange) attach(value.window);
+}
+
+void ChartMetrics::attach(QQuickWindow *window)
+{
+    for (const QMetaObject::Connection &connection : m_connections) disconnect(connection);
+    m_connections.clear();
+    m_window = window;
+    m_lastSwap = -1;
+    if (!window) return;
+
+    static KLineMetrics::Histogram &frameInterval = KLineMetrics::histogram("frame.interval");
+    static KLineMetrics::Histogram &syncTime = KLineMetrics::histogram("frame.sync");
+    static KLineMetrics::Histogram &renderTime = KLineMetrics::histogram("frame.render");
+
+    // 回调运行在发出信号的线程上（多线程渲染循环中为渲染线程）
+    m_connections << connect(
+        window, &QQuickWindow::beforeSynchronizing, this,
+        [this]() { m_syncStart = KLineMetrics::isEnabled() ? KLineMetrics::now() : -1; },
+        Qt::DirectConnection);
+    m_connections << connect(
+        window, &QQuickWindow::afterSynchronizing, this,
+        [this]() {
+            const qint64 start = m_syncStart.exchange(-1);
+            if (start >= 0) syncTime.record(KLineMetrics::now() - start);
+        },
+        Qt::DirectConnection);
+    m_connections << connect(
+        window, &QQuickWindow::beforeRendering, this,
+        [this]() { m_renderStart = KLineMetrics::isEnabled() ? KLineMetrics::now() : -1; },
+        Qt::DirectConnection);
+    m_connections << connect(
+        window, &QQuickWindow::afterRendering, this,
+        [this]() {
+            const qint64 start = m_renderStart.exchange(-1);
+            if (start >= 0) renderTime.record(KLineMetrics::now() - start);
+        },
+        Qt::DirectConnection);
+    m_connections << connect(
+        window, &QQuickWindow::frameSwapped, this,
+        [this]() {
+            KLineMetrics::completeStartup(KLineMetrics::now());
+            if (!KLineMetrics::isEnabled()) {
+                m_lastSwap = -1;
+                return;
+            }
+            const qint64 now = KLineMetrics::now();
+            const qint64 last = m_lastSwap.exchange(now);
+            if (last >= 0 && now - last < kIdleGapNs) frameInterval.record(now - last);
+            KLineMetrics::inputProbe().complete(now);
+            KLineMetrics::tickProbe().complete(now);
+        },
+        Qt::DirectConnection);
+}
+
+void ChartMetrics::refresh()
+{
+    const QJsonObject histograms = KLineMetrics::snapshot().value("histograms").toObject();
+    QVariantList rows;
+    for (auto it = histograms.begin(); it != histograms.end(); ++it) {
+        const QJsonObject histogram = it.value().toObject();
+        const bool isTime = histogram.contains("p50_ms");
+        const QString suffix = isTime ? "_ms" : "";
+
+        QVariantMap row;
+        row["name"] = it.key();
+        row["unit"] = isTime ? "ms" : "";
+        row["count"] = histogram.value("count").toDouble();
+        row["p50"] = histogram.value("p50" + suffix).toDouble();
+        row["p99"] = histogram.value("p99" + suffix).toDouble();
+        row["max"] = histogram.value("max" + suffix).toDouble();
+        rows.append(row);
+    }
+    m_rows = rows;
+    emit rowsChanged();
+}
@@ -0,0 +1,69 @@
+#ifndef CHARTMETRICS_H
+#define CHARTMETRICS_H
+
+#include <QList>
+#include <QMetaObject>
+#include <QPointer>
+#include <QQuickItem>
+#include <QTimer>
+#include <QVariantList>
+#include <atomic>
+
+class QQuickWindow;
+
+// 帧时间和延迟HUD的数据源
+//
+// 挂到所在窗口的场景图信号上：帧交换的间隔记为frame.interval，同步阶段(各组件的
+// updatePaintNode)和渲染阶段的耗时记为frame.sync和frame.render，帧交换时完成输入和行情
+// 的延迟探针。这些信号在多线程渲染循环中运行于渲染线程，回调里只做原子操作。
+// 只在KLineMetrics开始记录后(active或命令行--metrics)才取时间戳。
+class ChartMetrics : public QQuickItem
+{
+    Q_OBJECT
+    // 为true时开始记录并定时刷新rows
+    Q_PROPERTY(bool active READ active WRITE setActive NOTIFY activeChanged)
+    Q_PROPERTY(int interval READ interval WRITE setInterval NOTIFY intervalChanged)
+    // 每个直方图一行: {name, unit, count, p50, p99, max}，时间单位为毫秒
+    Q_PROPERTY(QVariantList rows READ rows NOTIFY rowsChanged)
+
+public:
+    explicit ChartMetrics(QQuickItem *parent = nullptr);
+    ~ChartMetrics() override;
+
+    bool active() const { return m_active; }
+    void setActive(bool active);
+    int interval() const { return m_timer.interval(); }
+    void setInterval(int interval);
+    QVariantList rows() const { return m_rows; }
+
+    // 行情更新只重绘一根K线时由QML调用，开始计时行情到屏幕的延迟
+    Q_INVOKABLE void markTick();
+    // 写出全部直方图，path为空时写到应用数据目录；返回写出的路径，失败时为空
+    Q_INVOKABLE QString exportJson(const QString &path = QString());
+    Q_INVOKABLE void reset();
+
+signals:
+    void activeChanged();
+    void intervalChanged();
+    void rowsChanged();
+
+protected:
+    void itemChange(ItemChange change, const ItemChangeData &value) override;
+
+private:
+    void attach(QQuickWindow *window);
+    void refresh();
+
+    bool m_active = false;
+    QTimer m_timer;
+    QVariantList m_rows;
+    QPointer<QQuickWindow> m_window;
+    QList<QMetaObject::Connection> m_connections;
+
+    // 以下由渲染线程读写
+    std::atomic<qint64> m_lastSwap{-1};
+    std::atomic<qint64> m_syncStart{-1};
+    std::atomic<qint64> m_renderStart{-1};
+};
+
+#endif  // CHARTMETRICS_H
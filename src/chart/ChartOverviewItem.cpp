@@ -0,0 +1,140 @@
+#include "ChartOverviewItem.h"
+
+#include <QSGGeometryNode>
+#include <QtMath>
+#include <cmath>
+#include <limits>
+
+#include "core/KLineDataProvider.h"
+#include "core/KLineMetrics.h"
+#include "core/KLineOverview.h"
+#include "core/KLineTrace.h"
+
+ChartOverviewItem::ChartOverviewItem(QQuickItem *parent) : QQuickItem(parent)
+{
+    setFlag(ItemHasContents, true);
+}
+
+void ChartOverviewItem::setProvider(KLineDataProvider *provider)
+{
+    if (m_provider == provider) return;
+
+    if (m_provider) disconnect(m_provider, nullptr, this, nullptr);
+    m_provider = provider;
+    if (m_provider) {
+        connect(m_provider, &KLineDataProvider::overviewChanged, this, &ChartOverviewItem::rebuild);
+    }
+    emit providerChanged();
+    rebuild();
+}
+
+void ChartOverviewItem::setMode(Mode mode)
+{
+    if (m_mode == mode) return;
+
+    m_mode = mode;
+    emit appearanceChanged();
+    rebuild();
+}
+
+void ChartOverviewItem::setColor(const QColor &color)
+{
+    if (m_color == color) return;
+
+    m_color = color;
+    emit appearanceChanged();
+    rebuild();
+}
+
+void ChartOverviewItem::setFillColor(const QColor &color)
+{
+    if (m_fillColor == color) return;
+
+    m_fillColor = color;
+    emit appearanceChanged();
+    rebuild();
+}
+
+void ChartOverviewItem::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size()) rebuild();
+}
+
+void ChartOverviewItem::rebuild()
+{
+    KLINE_TRACE_SCOPE("model", "ChartOverviewItem::rebuild");
+    const KLineOverview overview = m_provider ? m_provider->overview() : KLineOverview();
+    if (m_barCount != overview.barCount()) {
+        m_barCount = overview.barCount();
+        emit overviewChanged();
+    }
+
+    m_vertices.clear();
+    const int columns = qCeil(width());
+    if (overview.isEmpty() || columns <= 0 || height() <= 2) {
+        update();
+        return;
+    }
+
+    QVector<double> low, high, close;
+    overview.summarize(columns, low, high, close);
+
+    double minValue = std::numeric_limits<double>::max();
+    double maxValue = std::numeric_limits<double>::lowest();
+    for (int column = 0; column < columns; ++column) {
+        if (std::isnan(low[column])) continue;
+        minValue = qMin(minValue, low[column]);
+        maxValue = qMax(maxValue, high[column]);
+    }
+    const double range = maxValue > minValue ? maxValue - minValue : 1;
+    // 上下各留1像素，包络的边缘不贴边
+    const qreal scale = (height() - 2) / range;
+    auto yOf = [&](double value) { return 1 + (maxValue - value) * scale; };
+
+    // 像素坐标下逐列取点，NaN列断开
+    QPolygonF upper, lower, line;
+    auto flush = [&]() {
+        if (m_mode == Envelope && upper.size() > 1) {
+            SeriesGeometry::appendBand(m_vertices, upper, lower, m_fillColor);
+        }
+        if (line.size() > 1) SeriesGeometry::appendPolyline(m_vertices, line, 1, 1, 1, m_color);
+        upper.clear();
+        lower.clear();
+        line.clear();
+    };
+    for (int column = 0; column < columns; ++column) {
+        if (std::isnan(low[column])) {
+            flush();
+            continue;
+        }
+        const qreal x = column + 0.5;
+        if (m_mode == Envelope) {
+            // 每列至少1像素高，平盘的区间也可见
+            const qreal top = yOf(high[column]);
+            upper.append(QPointF(x, top));
+            lower.append(QPointF(x, qMax(top + 1, yOf(low[column]))));
+        }
+        line.append(QPointF(x, yOf(close[column])));
+    }
+    flush();
+    update();
+}
+
+QSGNode *ChartOverviewItem::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+{
+    KLINE_TRACE_SCOPE("render", "ChartOverviewItem::updatePaintNode");
+    static KLineMetrics::Histogram &paintTime =
+        KLineMetrics::histogram("paint.ChartOverviewItem");
+    KLineMetrics::ScopedTimer paintTimer(paintTime);
+    auto *node = static_cast<QSGGeometryNode *>(oldNode);
+    if (m_vertices.isEmpty()) {
+        delete node;
+        return nullptr;
+    }
+
+    if (!node) node = SeriesGeometry::createColoredNode(QSGGeometry::DrawTriangleStrip);
+    SeriesGeometry::upload(node->geometry(), m_vertices);
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
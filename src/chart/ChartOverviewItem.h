@@ -0,0 +1,61 @@
+#ifndef CHARTOVERVIEWITEM_H
+#define CHARTOVERVIEWITEM_H
+
+#include <QColor>
+#include <QPointer>
+#include <QQuickItem>
+
+#include "SeriesGeometry.h"
+
+class KLineDataProvider;
+
+// 导航条缩略图：把provider的整个历史画成收盘价折线或最高/最低包络。
+// 数据取自KLineOverview的桶汇总，每个像素列一个点，绘制耗时O(宽度)，与K线总数无关；
+// 汇总或尺寸变化时在GUI线程重建顶点，渲染线程只做一次拷贝。
+class ChartOverviewItem : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(KLineDataProvider *provider READ provider WRITE setProvider NOTIFY providerChanged)
+    Q_PROPERTY(Mode mode READ mode WRITE setMode NOTIFY appearanceChanged)
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY appearanceChanged)
+    Q_PROPERTY(QColor fillColor READ fillColor WRITE setFillColor NOTIFY appearanceChanged)
+    // 汇总覆盖的K线总数，导航窗口按它换算位置
+    Q_PROPERTY(qreal barCount READ barCount NOTIFY overviewChanged)
+
+public:
+    enum Mode { CloseLine, Envelope };
+    Q_ENUM(Mode)
+
+    explicit ChartOverviewItem(QQuickItem *parent = nullptr);
+
+    KLineDataProvider *provider() const { return m_provider; }
+    void setProvider(KLineDataProvider *provider);
+    Mode mode() const { return m_mode; }
+    void setMode(Mode mode);
+    QColor color() const { return m_color; }
+    void setColor(const QColor &color);
+    QColor fillColor() const { return m_fillColor; }
+    void setFillColor(const QColor &color);
+    qreal barCount() const { return qreal(m_barCount); }
+
+signals:
+    void providerChanged();
+    void appearanceChanged();
+    void overviewChanged();
+
+protected:
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *) override;
+
+private:
+    void rebuild();
+
+    QPointer<KLineDataProvider> m_provider;
+    Mode m_mode = Envelope;
+    QColor m_color = QColor(0x46, 0x82, 0xB4);
+    QColor m_fillColor = QColor(0x46, 0x82, 0xB4, 0x60);
+    qint64 m_barCount = 0;
+    SeriesGeometry::StripVertices m_vertices;
+};
+
+#endif  // CHARTOVERVIEWITEM_H
@@ -0,0 +1,52 @@
+#include "ChartRepaintScheduler.h"
+
+ChartRepaintScheduler::ChartRepaintScheduler(QQuickItem *parent) : QQuickItem(parent) {}
+
+void ChartRepaintScheduler::invalidate(int layers)
+{
+    layers &= AllLayers;
+    if (layers == 0) return;
+
+    ++m_requestCount;
+    m_fullLayers |= layers;
+    polish();
+}
+
+void ChartRepaintScheduler::invalidateRect(int layer, const QRectF &rect)
+{
+    if ((layer & AllLayers) == 0 || rect.isEmpty()) return;
+
+    ++m_requestCount;
+    for (int i = 0; i < kLayerCount; ++i) {
+        if (!(layer & (1 << i))) continue;
+        m_dirtyRects[i] = m_dirtyRects[i].isEmpty() ? rect : m_dirtyRects[i].united(rect);
+        m_partialLayers |= 1 << i;
+    }
+    polish();
+}
+
+void ChartRepaintScheduler::updatePolish()
+{
+    const int fullLayers = m_fullLayers;
+    const int partialLayers = m_partialLayers & ~fullLayers;
+    QRectF rects[kLayerCount];
+    for (int i = 0; i < kLayerCount; ++i) {
+        rects[i] = m_dirtyRects[i];
+        m_dirtyRects[i] = QRectF();
+    }
+    m_fullLayers = 0;
+    m_partialLayers = 0;
+    if (fullLayers == 0 && partialLayers == 0) return;
+
+    ++m_frameCount;
+    emit aboutToRepaint(fullLayers);
+    for (int i = 0; i < kLayerCount; ++i) {
+        const int layer = 1 << i;
+        if (fullLayers & layer) {
+            emit repaintLayer(layer, QRectF());
+        } else if (partialLayers & layer) {
+            emit repaintLayer(layer, rects[i]);
+        }
+    }
+    emit statisticsChanged();
+}
@@ -0,0 +1,62 @@
+#ifndef CHARTREPAINTSCHEDULER_H
+#define CHARTREPAINTSCHEDULER_H
+
+#include <QQuickItem>
+#include <QRectF>
+
+// 图表重绘调度器
+//
+// 鼠标移动、滚轮和数据更新在一帧内可能多次请求重绘，这里只记录失效的层和区域，
+// 每帧统一发出一次repaintLayer。局部失效的区域在同一层内合并为外接矩形，
+// 同一帧内整层失效会覆盖该层的局部失效。
+//
+// 刷新放在场景的polish阶段：它在GUI线程上、紧挨着beforeSynchronizing之前执行，
+// 而beforeSynchronizing在多线程渲染循环中运行于渲染线程，不能直接驱动QML Canvas。
+class ChartRepaintScheduler : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(int requestCount READ requestCount NOTIFY statisticsChanged)
+    Q_PROPERTY(int frameCount READ frameCount NOTIFY statisticsChanged)
+
+public:
+    enum Layer {
+        GridLayer = 0x01,
+        SeriesLayer = 0x02,
+        AxisLayer = 0x04,
+        OverlayLayer = 0x08,
+        AllLayers = 0x0f,
+    };
+    Q_ENUM(Layer)
+
+    explicit ChartRepaintScheduler(QQuickItem *parent = nullptr);
+
+    // 整层失效，layers为Layer的按位或
+    Q_INVOKABLE void invalidate(int layers);
+    // 单层的局部失效，rect为该层坐标
+    Q_INVOKABLE void invalidateRect(int layer, const QRectF &rect);
+
+    // 累计的失效请求数和实际刷新的帧数，两者之比即合并率
+    int requestCount() const { return m_requestCount; }
+    int frameCount() const { return m_frameCount; }
+
+signals:
+    // 每帧先发出一次，fullLayers为整层失效的层，之后逐层发出repaintLayer
+    void aboutToRepaint(int fullLayers);
+    // rect为空表示整层重绘
+    void repaintLayer(int layer, const QRectF &rect);
+    void statisticsChanged();
+
+protected:
+    void updatePolish() override;
+
+private:
+    static constexpr int kLayerCount = 4;
+
+    int m_fullLayers = 0;
+    int m_partialLayers = 0;
+    QRectF m_dirtyRects[kLayerCount];
+    int m_requestCount = 0;
+    int m_frameCount = 0;
+};
+
+#endif  // CHARTREPAINTSCHEDULER_H
@@ -0,0 +1,257 @@
+#include "ChartSeriesItem.h"
+
+#include <QSGTransformNode>
+#include <QtMath>
+#include <cmath>
+
+#include "core/KLineDataProvider.h"
+#include "core/KLineMetrics.h"
+#include "core/KLineTrace.h"
+
+ChartSeriesItem::ChartSeriesItem(QQuickItem *parent) : QQuickItem(parent)
+{
+    setFlag(ItemHasContents, true);
+    setClip(true);
+}
+
+void ChartSeriesItem::setProvider(KLineDataProvider *provider)
+{
+    if (m_provider == provider) return;
+
+    if (m_provider) disconnect(m_provider, nullptr, this, nullptr);
+    m_provider = provider;
+    if (m_provider) {
+        connect(m_provider, &KLineDataProvider::dataChanged, this, &ChartSeriesItem::reload);
+    }
+    emit providerChanged();
+    reload();
+}
+
+void ChartSeriesItem::reload()
+{
+    KLINE_TRACE_SCOPE_DETAIL("model", "ChartSeriesItem::reload", metaObject()->className());
+    // 偏移和数据取自同一个快照
+    const KLineWindowSnapshotPtr window = m_provider ? m_provider->snapshot() : nullptr;
+    m_dataOffset = window ? window->firstBar : 0;
+    loadData(window.get());
+    updateAutoRange();
+    markContentDirty();
+}
+
+void ChartSeriesItem::markContentDirty()
+{
+    m_contentDirty = true;
+    update();
+}
+
+void ChartSeriesItem::setView(qreal &field, qreal value)
+{
+    if (qFuzzyCompare(field, value)) return;
+
+    field = value;
+    emit viewChanged();
+    updateLod();
+    updateAutoRange();
+    // 只需更新变换矩阵
+    update();
+}
+
+void ChartSeriesItem::setViewStart(qreal viewStart) { setView(m_viewStart, viewStart); }
+
+void ChartSeriesItem::setViewCount(qreal viewCount) { setView(m_viewCount, viewCount); }
+
+void ChartSeriesItem::setMinValue(qreal minValue)
+{
+    if (qFuzzyCompare(m_minValue, minValue)) return;
+
+    m_minValue = minValue;
+    emit valueRangeChanged();
+    update();
+}
+
+void ChartSeriesItem::setMaxValue(qreal maxValue)
+{
+    if (qFuzzyCompare(m_maxValue, maxValue)) return;
+
+    m_maxValue = maxValue;
+    emit valueRangeChanged();
+    update();
+}
+
+void ChartSeriesItem::setAutoRange(bool autoRange)
+{
+    if (m_autoRange == autoRange) return;
+
+    m_autoRange = autoRange;
+    emit autoRangeChanged();
+    updateAutoRange();
+}
+
+qreal ChartSeriesItem::valueAt(qreal y) const
+{
+    if (height() <= 0) return m_minValue;
+    return m_maxValue - y / height() * (m_maxValue - m_minValue);
+}
+
+qreal ChartSeriesItem::yForValue(qreal value) const
+{
+    if (m_maxValue <= m_minValue) return height();
+    return (m_maxValue - value) / (m_maxValue - m_minValue) * height();
+}
+
+void ChartSeriesItem::geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    updateLod();
+    update();
+}
+
+void ChartSeriesItem::updateLod()
+{
+    int level = 0;
+    if (width() > 0 && m_viewCount > 0) {
+        const qreal spacing = width() / m_viewCount;
+        if (spacing < kMinBarSpacing) level = qCeil(std::log2(kMinBarSpacing / spacing));
+    }
+
+    if (level != m_lodLevel) {
+        m_lodLevel = level;
+        emit lodLevelChanged();
+        markContentDirty();
+    }
+}
+
+void ChartSeriesItem::updateAutoRange()
+{
+    if (!m_autoRange) return;
+
+    const int count = dataCount();
+    const int from = int(qBound<qint64>(0, qint64(std::floor(m_viewStart)) - m_dataOffset, count));
+    const int to = int(
+        qBound<qint64>(0, qint64(std::ceil(m_viewStart + m_viewCount)) - m_dataOffset, count));
+
+    double min = 0;
+    double max = 0;
+    if (from >= to || !dataRange(from, to, &min, &max)) return;
+    if (max <= min) max = min + 1;
+
+    if (!qFuzzyCompare(m_minValue, min) || !qFuzzyCompare(m_maxValue, max)) {
+        m_minValue = min;
+        m_maxValue = max;
+        emit valueRangeChanged();
+    }
+}
+
+qint64 ChartSeriesItem::firstGroup() const { return KLineTime::floorDiv(m_dataOffset, lodSpan()); }
+
+int ChartSeriesItem::groupCount() const
+{
+    const int count = dataCount();
+    if (count == 0) return 0;
+    return int(KLineTime::floorDiv(m_dataOffset + count - 1, lodSpan()) - firstGroup() + 1);
+}
+
+double ChartSeriesItem::groupBounds(qint64 first, int slot, int *from, int *to) const
+{
+    const qint64 span = lodSpan();
+    const qint64 groupStart = (first + slot) * span - m_dataOffset;
+    *from = int(qMax<qint64>(0, groupStart));
+    *to = int(qMin<qint64>(dataCount(), groupStart + span));
+    return double(groupStart);
+}
+
+QVector<QPolygonF> ChartSeriesItem::decimate(const QVector<double> &values, Decimation mode) const
+{
+    QVector<QPolygonF> runs;
+    QPolygonF run;
+    const qint64 first = firstGroup();
+    const int slots = groupCount();
+    const double span = double(lodSpan());
+    for (int slot = 0; slot < slots; ++slot) {
+        int from = 0, to = 0;
+        const double x = groupBounds(first, slot, &from, &to) + span * 0.5;
+        to = qMin(to, values.size());
+
+        int minIndex = -1, maxIndex = -1;
+        for (int i = from; i < to; ++i) {
+            const double value = values[i];
+            if (qIsNaN(value)) continue;
+            if (minIndex < 0 || value < values[minIndex]) minIndex = i;
+            if (maxIndex < 0 || value > values[maxIndex]) maxIndex = i;
+        }
+        if (minIndex < 0) {
+            if (!run.isEmpty()) runs.append(run);
+            run.clear();
+            continue;
+        }
+
+        const double low = values[minIndex] - m_valueOrigin;
+        const double high = values[maxIndex] - m_valueOrigin;
+        if (mode == Decimation::Min) {
+            run.append(QPointF(x, low));
+        } else if (mode == Decimation::Max || minIndex == maxIndex) {
+            run.append(QPointF(x, high));
+        } else if (minIndex < maxIndex) {
+            run.append(QPointF(x, low));
+            run.append(QPointF(x, high));
+        } else {
+            run.append(QPointF(x, high));
+            run.append(QPointF(x, low));
+        }
+    }
+    if (!run.isEmpty()) runs.append(run);
+    return runs;
+}
+
+qreal ChartSeriesItem::pixelsPerBar() const
+{
+    return m_viewCount > 0 ? width() / m_viewCount : 0;
+}
+
+qreal ChartSeriesItem::pixelsPerValue() const
+{
+    const qreal valueRange = m_maxValue - m_minValue;
+    return valueRange > 0 ? height() / valueRange : 0;
+}
+
+QMatrix4x4 ChartSeriesItem::dataToItem() const
+{
+    QMatrix4x4 matrix;
+    const qreal valueRange = m_maxValue - m_minValue;
+    if (m_viewCount <= 0 || valueRange <= 0) {
+        matrix.scale(0, 0);
+        return matrix;
+    }
+
+    // item_x = (x + 窗口偏移 - viewStart) * sx
+    // item_y = (maxValue - (y + 基准值)) * sy
+    const qreal sx = pixelsPerBar();
+    const qreal sy = pixelsPerValue();
+    matrix.translate(0, float(sy * (m_maxValue - m_valueOrigin)));
+    matrix.scale(float(sx), float(-sy));
+    matrix.translate(float(m_dataOffset - m_viewStart), 0);
+    return matrix;
+}
+
+QSGNode *ChartSeriesItem::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+{
+    // 在渲染线程上执行，detail为具体的序列类型
+    KLINE_TRACE_SCOPE_DETAIL("render", "ChartSeriesItem::updatePaintNode",
+                             metaObject()->className());
+    if (!m_paintTime) {
+        m_paintTime = &KLineMetrics::histogram(QString("paint.") + metaObject()->className());
+    }
+    KLineMetrics::ScopedTimer paintTimer(*m_paintTime);
+    auto *root = static_cast<QSGTransformNode *>(oldNode);
+    if (!root) {
+        root = new QSGTransformNode;
+        root->appendChildNode(createContentNode());
+        m_contentDirty = true;
+    }
+
+    updateContentNode(root->firstChild());
+    m_contentDirty = false;
+
+    root->setMatrix(dataToItem());
+    return root;
+}
@@ -0,0 +1,130 @@
+#ifndef CHARTSERIESITEM_H
+#define CHARTSERIESITEM_H
+
+#include <QMatrix4x4>
+#include <QPointer>
+#include <QPolygonF>
+#include <QQuickItem>
+#include <QVector>
+
+class KLineDataProvider;
+struct KLineWindowSnapshot;
+
+namespace KLineMetrics {
+class Histogram;
+}
+
+// 场景图序列组件的基类
+//
+// 子类的顶点使用数据坐标：x为窗口内的K线序号，y为相对valueOrigin的数值。
+// 几何只在数据或细节层级(LOD)变化时由子类重建，视口平移、缩放和纵轴范围变化
+// 只更新根变换节点的矩阵，因此拖动的开销与K线数量无关。
+//
+// 当K线间距小于kMinBarSpacing像素时，每2^lodLevel根按全局序号对齐合并为一组绘制，
+// 对齐到全局序号保证平移时合并边界不跳动。
+//
+// 同一个图表的各个窗格共享viewStart/viewCount，纵轴各自独立：
+// autoRange为true时按可见范围自动计算minValue/maxValue。
+class ChartSeriesItem : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(KLineDataProvider *provider READ provider WRITE setProvider NOTIFY providerChanged)
+    // 视口：第一根可见K线在完整序列中的序号(可以是小数)和可见K线数
+    Q_PROPERTY(qreal viewStart READ viewStart WRITE setViewStart NOTIFY viewChanged)
+    Q_PROPERTY(qreal viewCount READ viewCount WRITE setViewCount NOTIFY viewChanged)
+    Q_PROPERTY(qreal minValue READ minValue WRITE setMinValue NOTIFY valueRangeChanged)
+    Q_PROPERTY(qreal maxValue READ maxValue WRITE setMaxValue NOTIFY valueRangeChanged)
+    Q_PROPERTY(bool autoRange READ autoRange WRITE setAutoRange NOTIFY autoRangeChanged)
+    Q_PROPERTY(int lodLevel READ lodLevel NOTIFY lodLevelChanged)
+
+public:
+    explicit ChartSeriesItem(QQuickItem *parent = nullptr);
+
+    KLineDataProvider *provider() const { return m_provider; }
+    void setProvider(KLineDataProvider *provider);
+
+    qreal viewStart() const { return m_viewStart; }
+    void setViewStart(qreal viewStart);
+    qreal viewCount() const { return m_viewCount; }
+    void setViewCount(qreal viewCount);
+    qreal minValue() const { return m_minValue; }
+    void setMinValue(qreal minValue);
+    qreal maxValue() const { return m_maxValue; }
+    void setMaxValue(qreal maxValue);
+    bool autoRange() const { return m_autoRange; }
+    void setAutoRange(bool autoRange);
+
+    int lodLevel() const { return m_lodLevel; }
+
+    // 组件内纵坐标与数值互转，十字光标和坐标轴标签使用
+    Q_INVOKABLE qreal valueAt(qreal y) const;
+    Q_INVOKABLE qreal yForValue(qreal value) const;
+
+signals:
+    void providerChanged();
+    void viewChanged();
+    void valueRangeChanged();
+    void autoRangeChanged();
+    void lodLevelChanged();
+
+protected:
+    // 从窗口快照读取数据，没有provider时window为空，此时清空。
+    // 列数据与快照共享，保存下来不拷贝
+    virtual void loadData(const KLineWindowSnapshot *window) = 0;
+    virtual int dataCount() const = 0;
+    // 窗口内[from, to)的数值范围，没有有效数值时返回false
+    virtual bool dataRange(int from, int to, double *min, double *max) const = 0;
+    // 以下两个函数在渲染线程的同步阶段调用，此时GUI线程阻塞，可以读取成员
+    virtual QSGNode *createContentNode() = 0;
+    virtual void updateContentNode(QSGNode *node) = 0;
+
+    // 重新加载provider的数据并重建几何
+    void reload();
+    void markContentDirty();
+    bool isContentDirty() const { return m_contentDirty; }
+
+    qint64 dataOffset() const { return m_dataOffset; }
+    double valueOrigin() const { return m_valueOrigin; }
+    void setValueOrigin(double origin) { m_valueOrigin = origin; }
+    qint64 lodSpan() const { return qint64(1) << m_lodLevel; }
+    // 第slot个合并组在窗口内的K线范围[*from, *to)，以及它在数据坐标中的左边界
+    double groupBounds(qint64 first, int slot, int *from, int *to) const;
+    qint64 firstGroup() const;
+    int groupCount() const;
+    // 按当前LOD抽稀与K线对齐的数值序列，得到数据坐标中的折线(y相对valueOrigin)。
+    // 每个合并组放在组中心：MinMax按出现顺序输出组内最小值和最大值两个点，与K线的合并方式一致，
+    // 折线不会漏掉任何尖峰；Min/Max只输出一个极值，用于填充带的下边界和上边界。
+    // 组内全为NaN时折线断开，返回的每一段都是连续的
+    enum class Decimation { MinMax, Min, Max };
+    QVector<QPolygonF> decimate(const QVector<double> &values,
+                                Decimation mode = Decimation::MinMax) const;
+    // 当前视口下每根K线、每单位数值对应的像素数，按像素宽度构建几何的子类使用
+    qreal pixelsPerBar() const;
+    qreal pixelsPerValue() const;
+
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) final;
+    void geometryChange(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+
+private:
+    static constexpr qreal kMinBarSpacing = 2.0;
+
+    void setView(qreal &field, qreal value);
+    void updateLod();
+    void updateAutoRange();
+    QMatrix4x4 dataToItem() const;
+
+    QPointer<KLineDataProvider> m_provider;
+    qint64 m_dataOffset = 0;
+    double m_valueOrigin = 0;  // 顶点数值相对此基准存储，避免float精度不足
+
+    qreal m_viewStart = 0;
+    qreal m_viewCount = 1;
+    qreal m_minValue = 0;
+    qreal m_maxValue = 1;
+    bool m_autoRange = false;
+    int m_lodLevel = 0;
+    bool m_contentDirty = true;
+    KLineMetrics::Histogram *m_paintTime = nullptr;  // 渲染线程上首次绘制时按子类名取得
+};
+
+#endif  // CHARTSERIESITEM_H
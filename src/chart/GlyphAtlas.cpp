@@ -0,0 +1,94 @@
+#include "GlyphAtlas.h"
+
+#include <QFontMetricsF>
+#include <QPainter>
+#include <QtMath>
+
+namespace {
+
+constexpr int kGlyphPadding = 1;  // 相邻字形之间留空，避免线性采样时串色
+
+}  // namespace
+
+const QString &GlyphAtlas::charset()
+{
+    // 价格、时间和成交量标签用到的全部字符
+    static const QString chars = QStringLiteral("0123456789.-+:/ %万亿");
+    return chars;
+}
+
+GlyphAtlas::GlyphAtlas(const QFont &font, const QColor &color, qreal devicePixelRatio)
+    : m_font(font), m_color(color), m_devicePixelRatio(qMax<qreal>(1, devicePixelRatio))
+{
+    const QFontMetricsF metrics(m_font);
+    m_lineHeight = qCeil(metrics.height());
+
+    const QString &chars = charset();
+    qreal totalWidth = 0;
+    for (const QChar ch : chars) {
+        totalWidth += qCeil(metrics.horizontalAdvance(ch)) + 2 * kGlyphPadding;
+    }
+
+    m_image = QImage(qCeil(totalWidth * m_devicePixelRatio),
+                     qCeil(m_lineHeight * m_devicePixelRatio), QImage::Format_ARGB32_Premultiplied);
+    m_image.setDevicePixelRatio(m_devicePixelRatio);
+    m_image.fill(Qt::transparent);
+
+    QPainter painter(&m_image);
+    painter.setFont(m_font);
+    painter.setPen(m_color);
+    qreal x = 0;
+    for (const QChar ch : chars) {
+        const qreal advance = metrics.horizontalAdvance(ch);
+        const qreal cellWidth = qCeil(advance) + 2 * kGlyphPadding;
+        painter.drawText(QPointF(x + kGlyphPadding, metrics.ascent()), QString(ch));
+
+        Glyph glyph;
+        glyph.texture = QRectF((x + kGlyphPadding) / totalWidth, 0, qCeil(advance) / totalWidth, 1);
+        glyph.width = qCeil(advance);
+        glyph.advance = advance;
+        m_glyphs.insert(ch, glyph);
+        x += cellWidth;
+    }
+}
+
+qreal GlyphAtlas::textWidth(const QString &text) const
+{
+    qreal width = 0;
+    for (const QChar ch : text) {
+        const auto it = m_glyphs.constFind(ch);
+        if (it != m_glyphs.cend()) width += it->advance;
+    }
+    return width;
+}
+
+void GlyphAtlas::appendText(QVector<QSGGeometry::TexturedPoint2D> &vertices, const QString &text,
+                            qreal x, qreal y) const
+{
+    // 起点对齐到设备像素，字形与图集中的像素一一对应，不会被采样模糊
+    qreal penX = qRound(x * m_devicePixelRatio) / m_devicePixelRatio;
+    const float top = float(qRound(y * m_devicePixelRatio) / m_devicePixelRatio);
+    const float bottom = top + float(m_lineHeight);
+    for (const QChar ch : text) {
+        const auto it = m_glyphs.constFind(ch);
+        if (it == m_glyphs.cend()) continue;
+
+        const Glyph &glyph = *it;
+        const float left = float(qRound(penX * m_devicePixelRatio) / m_devicePixelRatio);
+        const float right = left + float(glyph.width);
+        const float u0 = float(glyph.texture.left());
+        const float u1 = float(glyph.texture.right());
+        const float v0 = float(glyph.texture.top());
+        const float v1 = float(glyph.texture.bottom());
+
+        QSGGeometry::TexturedPoint2D quad[6];
+        quad[0].set(left, top, u0, v0);
+        quad[1].set(right, top, u1, v0);
+        quad[2].set(left, bottom, u0, v1);
+        quad[3].set(right, top, u1, v0);
+        quad[4].set(right, bottom, u1, v1);
+        quad[5].set(left, bottom, u0, v1);
+        for (const QSGGeometry::TexturedPoint2D &vertex : quad) vertices.append(vertex);
+        penX += glyph.advance;
+    }
+}
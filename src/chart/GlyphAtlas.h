@@ -0,0 +1,51 @@
+#ifndef GLYPHATLAS_H
+#define GLYPHATLAS_H
+
+#include <QColor>
+#include <QFont>
+#include <QHash>
+#include <QImage>
+#include <QRectF>
+#include <QSGGeometry>
+#include <QString>
+#include <QVector>
+
+// 坐标轴文字的字形图集：把坐标轴会用到的少量字符按指定字体和颜色预先画进一张图，
+// 之后每个字符只是一个贴图四边形，全部标签共用一张纹理，一次绘制完成。
+// 图集按设备像素比绘制，四边形使用逻辑像素坐标。
+class GlyphAtlas
+{
+public:
+    GlyphAtlas(const QFont &font, const QColor &color, qreal devicePixelRatio);
+
+    const QImage &image() const { return m_image; }
+    const QFont &font() const { return m_font; }
+    const QColor &color() const { return m_color; }
+    qreal devicePixelRatio() const { return m_devicePixelRatio; }
+
+    qreal lineHeight() const { return m_lineHeight; }
+    // 单行文本的宽度，不在图集中的字符不计
+    qreal textWidth(const QString &text) const;
+    // 追加text的字形四边形(每个字符两个三角形)，(x, y)为文本左上角，不在图集中的字符跳过
+    void appendText(QVector<QSGGeometry::TexturedPoint2D> &vertices, const QString &text, qreal x,
+                    qreal y) const;
+
+private:
+    struct Glyph
+    {
+        QRectF texture;  // 归一化纹理坐标
+        qreal width = 0;
+        qreal advance = 0;
+    };
+
+    static const QString &charset();
+
+    QFont m_font;
+    QColor m_color;
+    qreal m_devicePixelRatio = 1;
+    qreal m_lineHeight = 0;
+    QImage m_image;
+    QHash<QChar, Glyph> m_glyphs;
+};
+
+#endif  // GLYPHATLAS_H
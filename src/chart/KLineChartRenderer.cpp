@@ -0,0 +1,343 @@
+#include "KLineChartRenderer.h"
+
+#include <QFontMetricsF>
+#include <QPainter>
+#include <QPainterPath>
+#include <QtMath>
+#include <cmath>
+#include <limits>
+
+#include "ChartAxisItem.h"
+#include "core/KLineTrace.h"
+
+namespace {
+
+// 与界面中ChartBase/CanvasKLineChart的布局保持一致
+constexpr qreal kLeftMargin = 60;
+constexpr qreal kRightMargin = 20;
+constexpr qreal kTitleHeight = 24;
+constexpr qreal kTimeAxisHeight = 36;
+constexpr qreal kSubPaneRatio = 0.2;  // 每个副图占图表高度的比例
+constexpr qreal kMinMainRatio = 0.4;  // 副图较多时主图至少保留的比例
+constexpr qreal kValueTickSpacing = 40;
+constexpr qreal kTimeTickSpacing = 70;
+constexpr int kFontPixelSize = 11;
+
+const QColor kGridColor(0x44, 0x44, 0x44);
+const QColor kTextColor(0xFF, 0xFF, 0xFF);
+const QColor kRisingColor(0xFF, 0x00, 0x00);
+const QColor kFallingColor(0x00, 0xFF, 0x00);
+const QColor kBandColor(0x46, 0x82, 0xB4);
+const QColor kLineColors[] = {QColor(0xFF, 0xD7, 0x00), QColor(0xDA, 0x70, 0xD6),
+                              QColor(0x87, 0xCE, 0xEB)};
+
+}  // namespace
+
+qreal KLineChartRenderer::Pane::yOf(double value) const
+{
+    const double range = maxValue - minValue;
+    if (range <= 0) return rect.center().y();
+    return rect.bottom() - (value - minValue) / range * rect.height();
+}
+
+KLineChartRenderer::KLineChartRenderer(const KLineColumns &bars, const KLineSeriesMap &series)
+    : m_bars(bars), m_series(series)
+{
+    setView(0, 0);
+}
+
+bool KLineChartRenderer::isOverlay(const QString &indicator)
+{
+    return indicator == "MA" || indicator == "BBANDS";
+}
+
+void KLineChartRenderer::setView(int start, int count)
+{
+    const int total = m_bars.size();
+    if (count <= 0 || count > total) count = total;
+    m_viewStart = qBound(0, start, qMax(0, total - count));
+    m_viewCount = count;
+}
+
+int KLineChartRenderer::groupSize(qreal barWidth) const
+{
+    // 每根K线不足1像素时按2^level根合并，与场景图组件的LOD级别相同
+    int group = 1;
+    while (barWidth * group < 1 && group < m_viewCount) group *= 2;
+    return group;
+}
+
+void KLineChartRenderer::seriesRange(const QVector<double> &values, double *minValue,
+                                     double *maxValue) const
+{
+    const int end = qMin(values.size(), m_viewStart + m_viewCount);
+    for (int i = m_viewStart; i < end; ++i) {
+        if (std::isnan(values[i])) continue;
+        *minValue = qMin(*minValue, values[i]);
+        *maxValue = qMax(*maxValue, values[i]);
+    }
+}
+
+void KLineChartRenderer::render(QPainter *painter, const QRectF &rect) const
+{
+    KLINE_TRACE_SCOPE("render", "KLineChartRenderer::render");
+    painter->save();
+    painter->fillRect(rect, m_background);
+
+    QFont font = painter->font();
+    font.setPixelSize(kFontPixelSize);
+    painter->setFont(font);
+
+    if (!m_title.isEmpty()) {
+        painter->setPen(kTextColor);
+        painter->drawText(QRectF(rect.left() + kLeftMargin, rect.top(), rect.width(), kTitleHeight),
+                          Qt::AlignLeft | Qt::AlignVCenter, m_title);
+    }
+
+    if (m_viewCount <= 0) {
+        painter->restore();
+        return;
+    }
+
+    // 副图：成交量和每个非叠加指标
+    QStringList subpanes;
+    for (const QString &name : m_indicators) {
+        if (!isOverlay(name) && m_series.contains(name)) subpanes.append(name);
+    }
+
+    const QRectF plot(rect.left() + kLeftMargin, rect.top() + kTitleHeight,
+                      rect.width() - kLeftMargin - kRightMargin,
+                      rect.height() - kTitleHeight - kTimeAxisHeight);
+    if (plot.width() <= 0 || plot.height() <= 0) {
+        painter->restore();
+        return;
+    }
+
+    const int subpaneCount = subpanes.size() + 1;
+    const qreal subHeight =
+        qMin(plot.height() * kSubPaneRatio, plot.height() * (1 - kMinMainRatio) / subpaneCount);
+    const qreal barWidth = plot.width() / m_viewCount;
+
+    Pane main;
+    main.rect = QRectF(plot.left(), plot.top(), plot.width(),
+                       plot.height() - subHeight * subpaneCount);
+    main.minValue = std::numeric_limits<double>::max();
+    main.maxValue = std::numeric_limits<double>::lowest();
+    seriesRange(m_bars.low, &main.minValue, &main.maxValue);
+    seriesRange(m_bars.high, &main.minValue, &main.maxValue);
+    for (const QString &name : m_indicators) {
+        if (!isOverlay(name)) continue;
+        for (auto it = m_series.cbegin(); it != m_series.cend(); ++it) {
+            if (it.key() == name || it.key().startsWith(name + '.')) {
+                seriesRange(it.value(), &main.minValue, &main.maxValue);
+            }
+        }
+    }
+    // 上下各留5%空白，与界面的价格范围一致
+    const double padding = (main.maxValue - main.minValue) * 0.05;
+    main.minValue -= padding;
+    main.maxValue += padding;
+
+    drawValueAxis(painter, main, rect.left());
+    painter->setClipRect(main.rect);
+    drawCandles(painter, main, barWidth);
+    int colorIndex = 0;
+    for (const QString &name : m_indicators) {
+        if (!isOverlay(name)) continue;
+        if (name == "BBANDS") {
+            drawLine(painter, main, m_series.value("BBANDS.upper"), kBandColor);
+            drawLine(painter, main, m_series.value("BBANDS.middle"), kTextColor);
+            drawLine(painter, main, m_series.value("BBANDS.lower"), kBandColor);
+        } else {
+            drawLine(painter, main, m_series.value(name), kLineColors[colorIndex++ % 3]);
+        }
+    }
+    painter->setClipping(false);
+
+    qreal top = main.rect.bottom();
+    Pane volume;
+    volume.rect = QRectF(plot.left(), top, plot.width(), subHeight);
+    volume.minValue = 0;
+    volume.maxValue = 0;
+    seriesRange(m_bars.volume, &volume.minValue, &volume.maxValue);
+    painter->setPen(kGridColor);
+    painter->drawLine(QPointF(rect.left(), top), QPointF(plot.right(), top));
+    drawVolume(painter, volume, barWidth);
+    top += subHeight;
+
+    for (const QString &name : subpanes) {
+        Pane pane;
+        pane.rect = QRectF(plot.left(), top, plot.width(), subHeight);
+        pane.minValue = std::numeric_limits<double>::max();
+        pane.maxValue = std::numeric_limits<double>::lowest();
+        const QVector<double> values = m_series.value(name);
+        seriesRange(values, &pane.minValue, &pane.maxValue);
+        if (pane.minValue > pane.maxValue) pane.minValue = pane.maxValue = 0;
+
+        painter->setPen(kGridColor);
+        painter->drawLine(QPointF(rect.left(), top), QPointF(plot.right(), top));
+        drawValueAxis(painter, pane, rect.left());
+        painter->setClipRect(pane.rect);
+        drawLine(painter, pane, values, kLineColors[0]);
+        painter->setClipping(false);
+        painter->setPen(kTextColor);
+        painter->drawText(pane.rect.adjusted(4, 2, 0, 0), Qt::AlignLeft | Qt::AlignTop, name);
+        top += subHeight;
+    }
+
+    drawTimeAxis(painter, plot, top, barWidth);
+    painter->restore();
+}
+
+void KLineChartRenderer::drawCandles(QPainter *painter, const Pane &pane, qreal barWidth) const
+{
+    const int group = groupSize(barWidth);
+    const qreal bodyWidth = qMax<qreal>(1, barWidth * group * 0.7);
+    painter->setRenderHint(QPainter::Antialiasing, false);
+
+    // 分组对齐到完整序号，平移时同一组K线的合并结果不变
+    const int end = m_viewStart + m_viewCount;
+    for (int first = m_viewStart / group * group; first < end; first += group) {
+        const int from = qMax(first, m_viewStart);
+        const int to = qMin(first + group, end);
+        double high = m_bars.high[from];
+        double low = m_bars.low[from];
+        for (int i = from + 1; i < to; ++i) {
+            high = qMax(high, m_bars.high[i]);
+            low = qMin(low, m_bars.low[i]);
+        }
+        const double open = m_bars.open[from];
+        const double close = m_bars.close[to - 1];
+        const QColor &color = close >= open ? kRisingColor : kFallingColor;
+
+        const qreal x = pane.rect.left() + (first + group * 0.5 - m_viewStart) * barWidth;
+        painter->setPen(color);
+        painter->drawLine(QPointF(x, pane.yOf(high)), QPointF(x, pane.yOf(low)));
+        const qreal top = pane.yOf(qMax(open, close));
+        const qreal bottom = pane.yOf(qMin(open, close));
+        painter->fillRect(QRectF(x - bodyWidth / 2, top, bodyWidth, qMax<qreal>(1, bottom - top)),
+                          color);
+    }
+}
+
+void KLineChartRenderer::drawVolume(QPainter *painter, const Pane &pane, qreal barWidth) const
+{
+    const int group = groupSize(barWidth);
+    const qreal columnWidth = qMax<qreal>(1, barWidth * group * 0.7);
+    painter->setRenderHint(QPainter::Antialiasing, false);
+
+    // 合并组内取最大成交量，避免缩小后量柱整体变矮
+    const int end = m_viewStart + m_viewCount;
+    for (int first = m_viewStart / group * group; first < end; first += group) {
+        const int from = qMax(first, m_viewStart);
+        const int to = qMin(first + group, end);
+        double volume = 0;
+        for (int i = from; i < to; ++i) volume = qMax(volume, m_bars.volume[i]);
+        const QColor &color = m_bars.close[to - 1] >= m_bars.open[from] ? kRisingColor
+                                                                         : kFallingColor;
+
+        const qreal x = pane.rect.left() + (first + group * 0.5 - m_viewStart) * barWidth;
+        const qreal top = pane.yOf(volume);
+        painter->fillRect(QRectF(x - columnWidth / 2, top, columnWidth, pane.rect.bottom() - top),
+                          color);
+    }
+}
+
+void KLineChartRenderer::drawLine(QPainter *painter, const Pane &pane,
+                                  const QVector<double> &values, const QColor &color) const
+{
+    const int end = qMin(values.size(), m_viewStart + m_viewCount);
+    if (end <= m_viewStart) return;
+
+    const qreal barWidth = pane.rect.width() / m_viewCount;
+    const int group = groupSize(barWidth);
+
+    // NaN处断开；K线多于像素时每组取一个点，路径点数与像素宽度同级
+    QPainterPath path;
+    bool penDown = false;
+    for (int i = m_viewStart; i < end; i += group) {
+        const double value = values[i];
+        if (std::isnan(value)) {
+            penDown = false;
+            continue;
+        }
+        const QPointF point(pane.rect.left() + (i + 0.5 - m_viewStart) * barWidth,
+                            pane.yOf(value));
+        if (penDown) {
+            path.lineTo(point);
+        } else {
+            path.moveTo(point);
+            penDown = true;
+        }
+    }
+
+    painter->setRenderHint(QPainter::Antialiasing, true);
+    painter->setPen(QPen(color, 1.5));
+    painter->setBrush(Qt::NoBrush);
+    painter->drawPath(path);
+}
+
+void KLineChartRenderer::drawValueAxis(QPainter *painter, const Pane &pane, qreal labelLeft) const
+{
+    const double range = pane.maxValue - pane.minValue;
+    if (range <= 0) return;
+
+    const int maxTicks = qMax(2, int(pane.rect.height() / kValueTickSpacing));
+    const double step = ChartAxisItem::niceNumber(
+        ChartAxisItem::niceNumber(range, false) / (maxTicks - 1), true);
+    const int decimals = qMax(0, int(-std::floor(std::log10(step))));
+
+    painter->setRenderHint(QPainter::Antialiasing, false);
+    const qreal labelHeight = QFontMetricsF(painter->font()).height();
+    for (qint64 k = qint64(std::ceil(pane.minValue / step));
+         k <= qint64(std::floor(pane.maxValue / step)); ++k) {
+        const double value = k * step;
+        const qreal y = std::round(pane.yOf(value)) + 0.5;
+        painter->setPen(QPen(kGridColor, 1, Qt::DashLine));
+        painter->drawLine(QPointF(pane.rect.left(), y), QPointF(pane.rect.right(), y));
+        painter->setPen(kTextColor);
+        painter->drawText(QRectF(labelLeft + 5, y - labelHeight / 2, kLeftMargin - 10, labelHeight),
+                          Qt::AlignLeft | Qt::AlignVCenter, QString::number(value, 'f', decimals));
+    }
+}
+
+void KLineChartRenderer::drawTimeAxis(QPainter *painter, const QRectF &plot, qreal top,
+                                      qreal barWidth) const
+{
+    const qint64 step = qMax<qint64>(
+        1, qint64(std::ceil(ChartAxisItem::niceNumber(kTimeTickSpacing / barWidth, false))));
+    const int end = m_viewStart + m_viewCount;
+
+    painter->setRenderHint(QPainter::Antialiasing, false);
+    const qreal lineHeight = QFontMetricsF(painter->font()).height();
+    qint64 previousDay = std::numeric_limits<qint64>::min();
+    for (qint64 index = KLineTime::floorDiv(m_viewStart + step - 1, step) * step; index < end;
+         index += step) {
+        const qint64 time = m_bars.time[int(index)];
+        const qint64 day = KLineTime::floorDiv(time, KLineTime::kDayMs);
+        const bool dailyBar = time - day * KLineTime::kDayMs == 0;
+        const bool newDay = day != previousDay;
+        previousDay = day;
+
+        const qreal x = std::round(plot.left() + (index + 0.5 - m_viewStart) * barWidth) + 0.5;
+        painter->setPen(QPen(kGridColor, 1, Qt::DashLine));
+        painter->drawLine(QPointF(x, plot.top()), QPointF(x, top));
+
+        // 第一行为时分，跨日时第二行显示日期；日线及以上周期只显示日期
+        painter->setPen(kTextColor);
+        qreal y = top + 4;
+        const QRectF cell(x - kTimeTickSpacing / 2, y, kTimeTickSpacing, lineHeight);
+        if (!dailyBar) {
+            const qint64 minutes = (time - day * KLineTime::kDayMs) / KLineTime::kMinuteMs;
+            painter->drawText(cell, Qt::AlignCenter,
+                              QString::asprintf("%02d:%02d", int(minutes / 60), int(minutes % 60)));
+            y += lineHeight;
+        }
+        if (dailyBar || newDay) {
+            int year = 0, month = 0, dayOfMonth = 0;
+            KLineTime::civilFromDays(day, &year, &month, &dayOfMonth);
+            painter->drawText(cell.translated(0, y - cell.top()), Qt::AlignCenter,
+                              QString::asprintf("%02d-%02d", month, dayOfMonth));
+        }
+    }
+}
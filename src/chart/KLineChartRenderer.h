@@ -0,0 +1,64 @@
+#ifndef KLINECHARTRENDERER_H
+#define KLINECHARTRENDERER_H
+
+#include <QColor>
+#include <QRectF>
+#include <QString>
+#include <QStringList>
+
+#include "core/KLineColumns.h"
+#include "core/KLineIndicators.h"
+
+class QPainter;
+
+// 不依赖窗口的K线图绘制：同一套布局（主图、成交量、指标副图、坐标轴）画到任意QPainter上，
+// 可以是QImage、QSvgGenerator或打印设备。只读取传入的列式数据，可在工作线程中使用，
+// 每个线程各自持有一个实例。
+//
+// 刻度和LOD与界面组件一致：刻度取ChartAxisItem::niceNumber，K线多于像素时
+// 按2^level根对齐到完整序号分组、每组画一根合并后的K线。
+class KLineChartRenderer
+{
+public:
+    KLineChartRenderer(const KLineColumns &bars, const KLineSeriesMap &series);
+
+    // 叠加在主图上的指标（MA、BBANDS），其余指标各占一个副图
+    static bool isOverlay(const QString &indicator);
+
+    void setIndicators(const QStringList &indicators) { m_indicators = indicators; }
+    void setTitle(const QString &title) { m_title = title; }
+    // 可见范围[start, start + count)，count <= 0表示全部K线
+    void setView(int start, int count);
+    void setBackground(const QColor &color) { m_background = color; }
+
+    void render(QPainter *painter, const QRectF &rect) const;
+
+private:
+    struct Pane
+    {
+        QRectF rect;
+        double minValue = 0;
+        double maxValue = 1;
+
+        qreal yOf(double value) const;
+    };
+
+    void drawCandles(QPainter *painter, const Pane &pane, qreal barWidth) const;
+    void drawVolume(QPainter *painter, const Pane &pane, qreal barWidth) const;
+    void drawLine(QPainter *painter, const Pane &pane, const QVector<double> &values,
+                  const QColor &color) const;
+    void drawValueAxis(QPainter *painter, const Pane &pane, qreal labelLeft) const;
+    void drawTimeAxis(QPainter *painter, const QRectF &plot, qreal top, qreal barWidth) const;
+    void seriesRange(const QVector<double> &values, double *minValue, double *maxValue) const;
+    int groupSize(qreal barWidth) const;
+
+    KLineColumns m_bars;
+    KLineSeriesMap m_series;
+    QStringList m_indicators;
+    QString m_title;
+    int m_viewStart = 0;
+    int m_viewCount = 0;
+    QColor m_background = QColor(0x2b, 0x2b, 0x2b);
+};
+
+#endif  // KLINECHARTRENDERER_H
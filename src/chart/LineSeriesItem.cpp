@@ -0,0 +1,160 @@
+#include "LineSeriesItem.h"
+
+#include <QSGGeometryNode>
+#include <limits>
+
+#include "SeriesGeometry.h"
+#include "core/KLineDataProvider.h"
+
+LineSeriesItem::LineSeriesItem(QQuickItem *parent) : ChartSeriesItem(parent)
+{
+    setAutoRange(true);
+}
+
+void LineSeriesItem::setSeries(const QStringList &series)
+{
+    if (m_series == series) return;
+
+    m_series = series;
+    emit seriesChanged();
+    reload();
+}
+
+void LineSeriesItem::setColors(const QVariantList &colors)
+{
+    if (m_colors == colors) return;
+
+    m_colors = colors;
+    emit colorChanged();
+    markContentDirty();
+}
+
+void LineSeriesItem::setColor(const QColor &color)
+{
+    if (m_color == color) return;
+
+    m_color = color;
+    emit colorChanged();
+    markContentDirty();
+}
+
+void LineSeriesItem::setLineWidth(qreal lineWidth)
+{
+    if (qFuzzyCompare(m_lineWidth, lineWidth)) return;
+
+    m_lineWidth = lineWidth;
+    emit lineWidthChanged();
+    markContentDirty();
+}
+
+qreal LineSeriesItem::valueAtBar(int index, int line) const
+{
+    const qint64 local = index - dataOffset();
+    if (line < 0 || line >= m_values.size()) return std::numeric_limits<qreal>::quiet_NaN();
+
+    const QVector<double> &values = m_values[line];
+    if (local < 0 || local >= values.size()) return std::numeric_limits<qreal>::quiet_NaN();
+    return values[local];
+}
+
+QColor LineSeriesItem::lineColor(int line) const
+{
+    if (line < m_colors.size()) {
+        const QColor color = m_colors[line].value<QColor>();
+        if (color.isValid()) return color;
+    }
+    return m_color;
+}
+
+void LineSeriesItem::loadData(const KLineWindowSnapshot *window)
+{
+    m_values.clear();
+    if (window) {
+        for (const QString &name : m_series) m_values.append(window->series.value(name));
+    }
+
+    double origin = 0;
+    bool found = false;
+    for (const QVector<double> &values : m_values) {
+        for (double value : values) {
+            if (!qIsNaN(value)) {
+                origin = value;
+                found = true;
+                break;
+            }
+        }
+        if (found) break;
+    }
+    setValueOrigin(origin);
+}
+
+int LineSeriesItem::dataCount() const
+{
+    int count = 0;
+    for (const QVector<double> &values : m_values) count = qMax(count, values.size());
+    return count;
+}
+
+bool LineSeriesItem::dataRange(int from, int to, double *min, double *max) const
+{
+    bool found = false;
+    for (const QVector<double> &values : m_values) {
+        const int end = qMin(to, values.size());
+        for (int i = from; i < end; ++i) {
+            const double value = values[i];
+            if (qIsNaN(value)) continue;
+            if (!found) {
+                *min = *max = value;
+                found = true;
+            } else {
+                *min = qMin(*min, value);
+                *max = qMax(*max, value);
+            }
+        }
+    }
+    if (!found) return false;
+
+    const double margin = (*max - *min) * 0.1;
+    *min -= margin;
+    *max += margin;
+    return true;
+}
+
+bool LineSeriesItem::scaleDrifted() const
+{
+    const qreal xScale = pixelsPerBar();
+    const qreal yScale = pixelsPerValue();
+    if (xScale <= 0 || yScale <= 0) return false;
+    if (m_builtXScale <= 0 || m_builtYScale <= 0) return true;
+
+    const qreal xRatio = xScale / m_builtXScale;
+    const qreal yRatio = yScale / m_builtYScale;
+    return xRatio > kRebuildScale || xRatio < 1 / kRebuildScale || yRatio > kRebuildScale ||
+           yRatio < 1 / kRebuildScale;
+}
+
+QSGNode *LineSeriesItem::createContentNode()
+{
+    return SeriesGeometry::createColoredNode(QSGGeometry::DrawTriangleStrip);
+}
+
+void LineSeriesItem::updateContentNode(QSGNode *node)
+{
+    if (!isContentDirty() && !scaleDrifted()) return;
+
+    m_builtXScale = pixelsPerBar();
+    m_builtYScale = pixelsPerValue();
+
+    SeriesGeometry::StripVertices strip;
+    for (int line = 0; line < m_values.size(); ++line) {
+        const QColor color = lineColor(line);
+        for (const QPolygonF &run : decimate(m_values[line])) {
+            SeriesGeometry::appendPolyline(strip, run, m_builtXScale, m_builtYScale,
+                                           m_lineWidth, color);
+        }
+    }
+
+    auto *geometryNode = static_cast<QSGGeometryNode *>(node);
+    SeriesGeometry::upload(geometryNode->geometry(), strip);
+    geometryNode->markDirty(QSGNode::DirtyGeometry);
+}
@@ -0,0 +1,71 @@
+#ifndef LINESERIESITEM_H
+#define LINESERIESITEM_H
+
+#include <QColor>
+#include <QStringList>
+#include <QVariantList>
+#include <QVector>
+
+#include "ChartSeriesItem.h"
+
+// 场景图指标线：读取provider窗口中series列出的指标输出，NaN位置断开。
+// 所有线合并为一条带退化三角形的三角形带，无论几条线都只有一个几何节点、一次绘制；
+// 每条线按当前LOD做min/max抽稀，顶点数与可见像素宽度成正比，与K线数量无关。
+//
+// 线宽以像素计，三角形带在构建时按当时的缩放比例扩展。视口变化只更新变换矩阵，
+// 缩放比例偏离构建时超过kRebuildScale倍才重建，在此之前线宽的误差不超过这个比例。
+class LineSeriesItem : public ChartSeriesItem
+{
+    Q_OBJECT
+    // 单个名称也可以直接赋值，QML会转换为只有一个元素的列表
+    Q_PROPERTY(QStringList series READ series WRITE setSeries NOTIFY seriesChanged)
+    // 与series一一对应的颜色，缺少的使用color
+    Q_PROPERTY(QVariantList colors READ colors WRITE setColors NOTIFY colorChanged)
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
+    Q_PROPERTY(qreal lineWidth READ lineWidth WRITE setLineWidth NOTIFY lineWidthChanged)
+
+public:
+    explicit LineSeriesItem(QQuickItem *parent = nullptr);
+
+    QStringList series() const { return m_series; }
+    void setSeries(const QStringList &series);
+    QVariantList colors() const { return m_colors; }
+    void setColors(const QVariantList &colors);
+    QColor color() const { return m_color; }
+    void setColor(const QColor &color);
+    qreal lineWidth() const { return m_lineWidth; }
+    void setLineWidth(qreal lineWidth);
+
+    // 第line条线在第index根(完整序列序号)的数值，不在窗口内或为NaN时返回NaN
+    Q_INVOKABLE qreal valueAtBar(int index, int line = 0) const;
+
+signals:
+    void seriesChanged();
+    void colorChanged();
+    void lineWidthChanged();
+
+protected:
+    void loadData(const KLineWindowSnapshot *window) override;
+    int dataCount() const override;
+    bool dataRange(int from, int to, double *min, double *max) const override;
+    QSGNode *createContentNode() override;
+    void updateContentNode(QSGNode *node) override;
+
+private:
+    static constexpr qreal kRebuildScale = 1.25;
+
+    QColor lineColor(int line) const;
+    bool scaleDrifted() const;
+
+    QStringList m_series;
+    QVariantList m_colors;
+    QColor m_color = QColor(0xFF, 0xD7, 0x00);
+    qreal m_lineWidth = 1.5;
+    QVector<QVector<double>> m_values;  // 与m_series一一对应
+
+    // 上次构建几何时的缩放比例，只在渲染线程的同步阶段读写
+    qreal m_builtXScale = 0;
+    qreal m_builtYScale = 0;
+};
+
+#endif  // LINESERIESITEM_H
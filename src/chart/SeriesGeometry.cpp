@@ -0,0 +1,132 @@
+#include "SeriesGeometry.h"
+
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+#include <QtMath>
+#include <cstring>
+
+namespace {
+
+struct PremultipliedColor
+{
+    uchar r, g, b, a;
+};
+
+// 顶点颜色按预乘alpha传给QSGVertexColorMaterial
+PremultipliedColor premultiplied(const QColor &color)
+{
+    const int alpha = color.alpha();
+    return {uchar(color.red() * alpha / 255), uchar(color.green() * alpha / 255),
+            uchar(color.blue() * alpha / 255), uchar(alpha)};
+}
+
+// 像素空间中线段(a, b)的单位法线，长度为0时返回false
+bool segmentNormal(const QPointF &a, const QPointF &b, QPointF *normal)
+{
+    const QPointF d = b - a;
+    const qreal length = qSqrt(d.x() * d.x() + d.y() * d.y());
+    if (length < 1e-9) return false;
+    *normal = QPointF(-d.y() / length, d.x() / length);
+    return true;
+}
+
+}  // namespace
+
+namespace SeriesGeometry {
+
+QSGGeometryNode *createColoredNode(QSGGeometry::DrawingMode mode)
+{
+    auto *geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), 0);
+    geometry->setDrawingMode(mode);
+    geometry->setLineWidth(1);
+
+    auto *node = new QSGGeometryNode;
+    node->setGeometry(geometry);
+    node->setMaterial(new QSGVertexColorMaterial);
+    node->setFlags(QSGNode::OwnsGeometry | QSGNode::OwnsMaterial);
+    return node;
+}
+
+void writeRect(QSGGeometry::ColoredPoint2D *v, float x0, float y0, float x1, float y1,
+               const QColor &color)
+{
+    const PremultipliedColor c = premultiplied(color);
+    v[0].set(x0, y0, c.r, c.g, c.b, c.a);
+    v[1].set(x1, y0, c.r, c.g, c.b, c.a);
+    v[2].set(x0, y1, c.r, c.g, c.b, c.a);
+    v[3].set(x1, y0, c.r, c.g, c.b, c.a);
+    v[4].set(x1, y1, c.r, c.g, c.b, c.a);
+    v[5].set(x0, y1, c.r, c.g, c.b, c.a);
+}
+
+void appendStrip(StripVertices &strip, const QSGGeometry::ColoredPoint2D *run, int count)
+{
+    if (count <= 0) return;
+    if (!strip.isEmpty()) {
+        const QSGGeometry::ColoredPoint2D last = strip.last();
+        strip.append(last);
+        strip.append(run[0]);
+    }
+    const int offset = strip.size();
+    strip.resize(offset + count);
+    std::memcpy(strip.data() + offset, run, count * sizeof(QSGGeometry::ColoredPoint2D));
+}
+
+void appendPolyline(StripVertices &strip, const QPolygonF &points, qreal xScale, qreal yScale,
+                    qreal width, const QColor &color)
+{
+    const int count = points.size();
+    if (count < 2 || xScale <= 0 || yScale <= 0) return;
+
+    QPolygonF pixels(count);
+    for (int i = 0; i < count; ++i) {
+        pixels[i] = QPointF(points[i].x() * xScale, points[i].y() * yScale);
+    }
+
+    const PremultipliedColor c = premultiplied(color);
+    const qreal halfWidth = width / 2;
+    StripVertices run(count * 2);
+    QPointF previous(0, 1);
+    for (int i = 0; i < count; ++i) {
+        // 拐点处取相邻两条线段法线的平均方向，长度为0的线段沿用上一个法线
+        QPointF normal(0, 0), n;
+        if (i > 0 && segmentNormal(pixels[i - 1], pixels[i], &n)) normal += n;
+        if (i + 1 < count && segmentNormal(pixels[i], pixels[i + 1], &n)) normal += n;
+        const qreal length = qSqrt(normal.x() * normal.x() + normal.y() * normal.y());
+        normal = length < 1e-9 ? previous : normal / length;
+        previous = normal;
+
+        const qreal dx = normal.x() * halfWidth / xScale;
+        const qreal dy = normal.y() * halfWidth / yScale;
+        const QPointF &p = points[i];
+        run[2 * i].set(float(p.x() + dx), float(p.y() + dy), c.r, c.g, c.b, c.a);
+        run[2 * i + 1].set(float(p.x() - dx), float(p.y() - dy), c.r, c.g, c.b, c.a);
+    }
+    appendStrip(strip, run.constData(), run.size());
+}
+
+void appendBand(StripVertices &strip, const QPolygonF &upper, const QPolygonF &lower,
+                const QColor &color)
+{
+    const int count = qMin(upper.size(), lower.size());
+    if (count < 2) return;
+
+    const PremultipliedColor c = premultiplied(color);
+    StripVertices run(count * 2);
+    for (int i = 0; i < count; ++i) {
+        run[2 * i].set(float(upper[i].x()), float(upper[i].y()), c.r, c.g, c.b, c.a);
+        run[2 * i + 1].set(float(lower[i].x()), float(lower[i].y()), c.r, c.g, c.b, c.a);
+    }
+    appendStrip(strip, run.constData(), run.size());
+}
+
+void upload(QSGGeometry *geometry, const StripVertices &vertices)
+{
+    geometry->allocate(vertices.size());
+    if (!vertices.isEmpty()) {
+        std::memcpy(geometry->vertexDataAsColoredPoint2D(), vertices.constData(),
+                    vertices.size() * sizeof(QSGGeometry::ColoredPoint2D));
+    }
+}
+
+}  // namespace SeriesGeometry
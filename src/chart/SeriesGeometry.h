@@ -0,0 +1,41 @@
+#ifndef SERIESGEOMETRY_H
+#define SERIESGEOMETRY_H
+
+#include <QColor>
+#include <QPolygonF>
+#include <QSGGeometry>
+#include <QVector>
+
+class QSGGeometryNode;
+
+// 序列组件共用的几何辅助函数
+namespace SeriesGeometry {
+
+// 顶点带颜色的几何节点，节点拥有几何和材质
+QSGGeometryNode *createColoredNode(QSGGeometry::DrawingMode mode);
+
+// 写入一个轴对齐矩形(两个三角形，6个顶点)
+void writeRect(QSGGeometry::ColoredPoint2D *v, float x0, float y0, float x1, float y1,
+               const QColor &color);
+
+using StripVertices = QVector<QSGGeometry::ColoredPoint2D>;
+
+// 把一段三角形带追加到strip末尾。多段之间插入两个重复顶点构成退化三角形，
+// 这样任意多条折线(包括NaN断开的各段)都在同一个DrawTriangleStrip节点中一次绘制
+void appendStrip(StripVertices &strip, const QSGGeometry::ColoredPoint2D *run, int count);
+
+// 把数据坐标中的折线扩展为宽度为width像素的三角形带。
+// xScale/yScale是构建时每单位数据对应的像素数，法线在像素空间中计算后再换回数据坐标
+void appendPolyline(StripVertices &strip, const QPolygonF &points, qreal xScale, qreal yScale,
+                    qreal width, const QColor &color);
+
+// 上下两条边界之间的填充带：upper和lower的点一一对应，x相同
+void appendBand(StripVertices &strip, const QPolygonF &upper, const QPolygonF &lower,
+                const QColor &color);
+
+// 把顶点整体写入几何
+void upload(QSGGeometry *geometry, const StripVertices &vertices);
+
+}  // namespace SeriesGeometry
+
+#endif  // SERIESGEOMETRY_H
@@ -0,0 +1,73 @@
+#include "VolumeSeriesItem.h"
+
+#include <QSGGeometryNode>
+
+#include "SeriesGeometry.h"
+#include "core/KLineDataProvider.h"
+
+VolumeSeriesItem::VolumeSeriesItem(QQuickItem *parent) : ChartSeriesItem(parent)
+{
+    setAutoRange(true);
+}
+
+void VolumeSeriesItem::setRisingColor(const QColor &color)
+{
+    if (m_risingColor == color) return;
+
+    m_risingColor = color;
+    emit colorsChanged();
+    markContentDirty();
+}
+
+void VolumeSeriesItem::setFallingColor(const QColor &color)
+{
+    if (m_fallingColor == color) return;
+
+    m_fallingColor = color;
+    emit colorsChanged();
+    markContentDirty();
+}
+
+void VolumeSeriesItem::loadData(const KLineWindowSnapshot *window)
+{
+    m_bars = window ? window->bars : KLineColumns();
+}
+
+bool VolumeSeriesItem::dataRange(int from, int to, double *min, double *max) const
+{
+    *min = 0;
+    *max = 0;
+    for (int i = from; i < to; ++i) *max = qMax(*max, m_bars.volume[i]);
+    return *max > 0;
+}
+
+QSGNode *VolumeSeriesItem::createContentNode()
+{
+    return SeriesGeometry::createColoredNode(QSGGeometry::DrawTriangles);
+}
+
+void VolumeSeriesItem::updateContentNode(QSGNode *node)
+{
+    if (!isContentDirty()) return;
+
+    auto *geometryNode = static_cast<QSGGeometryNode *>(node);
+    QSGGeometry *geometry = geometryNode->geometry();
+    const qint64 first = firstGroup();
+    const int slots = groupCount();
+    const double span = double(lodSpan());
+    geometry->allocate(slots * 6);
+
+    QSGGeometry::ColoredPoint2D *vertices = geometry->vertexDataAsColoredPoint2D();
+    for (int slot = 0; slot < slots; ++slot) {
+        int from = 0, to = 0;
+        const double left = groupBounds(first, slot, &from, &to);
+        double volume = 0;
+        for (int i = from; i < to; ++i) volume = qMax(volume, m_bars.volume[i]);
+
+        const bool rising = m_bars.close[to - 1] >= m_bars.open[from];
+        SeriesGeometry::writeRect(vertices + slot * 6, float(left + span * 0.2), 0,
+                                  float(left + span * 0.8), float(volume),
+                                  rising ? m_risingColor : m_fallingColor);
+    }
+    geometryNode->markDirty(QSGNode::DirtyGeometry);
+}
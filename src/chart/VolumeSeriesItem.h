@@ -0,0 +1,41 @@
+#ifndef VOLUMESERIESITEM_H
+#define VOLUMESERIESITEM_H
+
+#include <QColor>
+
+#include "ChartSeriesItem.h"
+#include "core/KLineColumns.h"
+
+// 场景图成交量柱：按K线涨跌着色，全部柱子在一个三角形几何节点中。
+// 合并组取组内最大成交量，与K线的极值合并方式一致。
+class VolumeSeriesItem : public ChartSeriesItem
+{
+    Q_OBJECT
+    Q_PROPERTY(QColor risingColor READ risingColor WRITE setRisingColor NOTIFY colorsChanged)
+    Q_PROPERTY(QColor fallingColor READ fallingColor WRITE setFallingColor NOTIFY colorsChanged)
+
+public:
+    explicit VolumeSeriesItem(QQuickItem *parent = nullptr);
+
+    QColor risingColor() const { return m_risingColor; }
+    void setRisingColor(const QColor &color);
+    QColor fallingColor() const { return m_fallingColor; }
+    void setFallingColor(const QColor &color);
+
+signals:
+    void colorsChanged();
+
+protected:
+    void loadData(const KLineWindowSnapshot *window) override;
+    int dataCount() const override { return m_bars.size(); }
+    bool dataRange(int from, int to, double *min, double *max) const override;
+    QSGNode *createContentNode() override;
+    void updateContentNode(QSGNode *node) override;
+
+private:
+    KLineColumns m_bars;
+    QColor m_risingColor = QColor(0xFF, 0x00, 0x00);
+    QColor m_fallingColor = QColor(0x00, 0xFF, 0x00);
+};
+
+#endif  // VOLUMESERIESITEM_H
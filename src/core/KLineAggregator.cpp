@@ -0,0 +1,71 @@
+#include "KLineAggregator.h"
+
+KLineAggregator::KLineAggregator(int periodMinutes, const TradingCalendar &calendar)
+    : m_periodMinutes(periodMinutes), m_calendar(calendar)
+{
+}
+
+void KLineAggregator::push(const KLineColumns &bars) { push(bars, 0, bars.size()); }
+
+void KLineAggregator::push(const KLineColumns &bars, int from, int count)
+{
+    if (!isValid()) return;
+
+    const qint64 *time = bars.time.constData() + from;
+    const double *open = bars.open.constData() + from;
+    const double *high = bars.high.constData() + from;
+    const double *low = bars.low.constData() + from;
+    const double *close = bars.close.constData() + from;
+    const double *volume = bars.volume.constData() + from;
+    const double *turnover = bars.turnover.constData() + from;
+    const double *openInterest = bars.openInterest.constData() + from;
+
+    // 先一次性算出整批的桶ID，主循环只比较整数
+    m_bucketIds.resize(count);
+    m_calendar.computeBucketIds(time, count, m_periodMinutes, m_bucketIds.data());
+    const qint64 *bucketIds = m_bucketIds.constData();
+
+    for (int i = 0; i < count; ++i) {
+        const qint64 bucket = bucketIds[i];
+        if (!m_hasCurrent || bucket != m_currentBucket) {
+            if (m_hasCurrent) flushCurrent();
+            m_hasCurrent = true;
+            m_currentBucket = bucket;
+            m_time = time[i];
+            m_open = open[i];
+            m_high = high[i];
+            m_low = low[i];
+            m_close = close[i];
+            m_volume = volume[i];
+            m_turnover = turnover[i];
+            m_openInterest = openInterest[i];
+            continue;
+        }
+
+        if (high[i] > m_high) m_high = high[i];
+        if (low[i] < m_low) m_low = low[i];
+        m_close = close[i];
+        m_volume += volume[i];
+        m_turnover += turnover[i];
+        m_openInterest = openInterest[i];
+    }
+}
+
+void KLineAggregator::finish()
+{
+    if (m_hasCurrent) flushCurrent();
+    m_hasCurrent = false;
+}
+
+KLineColumns KLineAggregator::takeResult()
+{
+    KLineColumns result = std::move(m_result);
+    m_result.clear();
+    return result;
+}
+
+void KLineAggregator::flushCurrent()
+{
+    m_result.append(m_time, m_open, m_high, m_low, m_close, m_volume, m_turnover,
+                    m_openInterest);
+}
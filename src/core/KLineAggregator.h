@@ -0,0 +1,48 @@
+#ifndef KLINEAGGREGATOR_H
+#define KLINEAGGREGATOR_H
+
+#include "KLineColumns.h"
+#include "TradingCalendar.h"
+
+// 流式K线周期合成
+//
+// 输入可以分多次push（例如逐个解码归档Block），跨批次的未完成周期会保留到下一批，
+// finish()时输出最后一个周期。每个周期的时间取该周期第一根输入K线的时间，
+// 成交量和成交额求和，持仓量取最后一根。
+// 分桶由交易日历决定，默认日历为全天24小时。
+class KLineAggregator
+{
+public:
+    explicit KLineAggregator(int periodMinutes,
+                             const TradingCalendar &calendar = TradingCalendar());
+
+    bool isValid() const { return m_periodMinutes > 0; }
+
+    void push(const KLineColumns &bars);
+    // 只push [from, from + count)，大批输入可以分段push以便在段之间检查取消
+    void push(const KLineColumns &bars, int from, int count);
+    void finish();
+
+    const KLineColumns &result() const { return m_result; }
+    KLineColumns takeResult();
+
+private:
+    void flushCurrent();
+
+    int m_periodMinutes;
+    TradingCalendar m_calendar;
+    QVector<qint64> m_bucketIds;  // 每批输入复用
+    bool m_hasCurrent = false;
+    qint64 m_currentBucket = 0;
+    qint64 m_time = 0;
+    double m_open = 0;
+    double m_high = 0;
+    double m_low = 0;
+    double m_close = 0;
+    double m_volume = 0;
+    double m_turnover = 0;
+    double m_openInterest = 0;
+    KLineColumns m_result;
+};
+
+#endif  // KLINEAGGREGATOR_H
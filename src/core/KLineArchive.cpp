@@ -0,0 +1,659 @@
+#include "KLineArchive.h"
+
+#include <QDebug>
+#include <QtEndian>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "KLineTrace.h"
+
+namespace {
+
+// ---- varint / zigzag 编码 ----
+
+inline quint64 zigzag(qint64 value) { return (quint64(value) << 1) ^ quint64(value >> 63); }
+
+inline qint64 unzigzag(quint64 value) { return qint64(value >> 1) ^ -qint64(value & 1); }
+
+inline void putVarint(QByteArray &out, quint64 value)
+{
+    while (value >= 0x80) {
+        out.append(char(value | 0x80));
+        value >>= 7;
+    }
+    out.append(char(value));
+}
+
+inline void putSigned(QByteArray &out, qint64 value) { putVarint(out, zigzag(value)); }
+
+// 顺序读取一段内存，越界时置failed而不是崩溃
+struct ByteReader
+{
+    const uchar *cur;
+    const uchar *end;
+    bool failed = false;
+
+    quint64 varint()
+    {
+        quint64 result = 0;
+        int shift = 0;
+        while (cur < end && shift < 64) {
+            const uchar byte = *cur++;
+            result |= quint64(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) return result;
+            shift += 7;
+        }
+        failed = true;
+        return 0;
+    }
+
+    qint64 svarint() { return unzigzag(varint()); }
+};
+
+template <typename T>
+void putLE(QByteArray &out, T value)
+{
+    char buffer[sizeof(T)];
+    qToLittleEndian(value, buffer);
+    out.append(buffer, sizeof(T));
+}
+
+template <typename T>
+T getLE(const uchar *data)
+{
+    return qFromLittleEndian<T>(data);
+}
+
+}  // namespace
+
+// KLineArchiveWriter 实现
+KLineArchiveWriter::KLineArchiveWriter(int priceDecimals, int blockSize)
+    : m_priceDecimals(qBound(0, priceDecimals, 8)),
+      m_blockSize(qMax(16, blockSize)),
+      m_priceScale(std::pow(10.0, m_priceDecimals))
+{
+}
+
+KLineArchiveWriter::~KLineArchiveWriter()
+{
+    if (m_file.isOpen()) close();
+}
+
+bool KLineArchiveWriter::open(const QString &path)
+{
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        m_error = m_file.errorString();
+        return false;
+    }
+
+    m_index.clear();
+    m_pending.clear();
+    m_barCount = 0;
+    m_lossyPrices = 0;
+    m_lossyValues = 0;
+
+    // 先写占位Header，close()时再回填Block数量和Index位置
+    return writeHeader();
+}
+
+bool KLineArchiveWriter::append(const KLineColumns &bars)
+{
+    if (!m_file.isOpen()) {
+        m_error = QStringLiteral("archive is not open");
+        return false;
+    }
+
+    int from = 0;
+    while (from < bars.size()) {
+        const int take = qMin(m_blockSize - m_pending.size(), bars.size() - from);
+        m_pending.appendRange(bars, from, take);
+        from += take;
+        if (m_pending.size() >= m_blockSize && !flushBlock()) return false;
+    }
+    return true;
+}
+
+bool KLineArchiveWriter::close()
+{
+    if (!m_file.isOpen()) return false;
+
+    bool ok = m_pending.isEmpty() || flushBlock();
+
+    const quint64 indexOffset = quint64(m_file.pos());
+    QByteArray index;
+    index.reserve(m_index.size() * KLineArchiveFormat::kIndexEntrySize);
+    for (const KLineArchiveBlockInfo &info : m_index) {
+        putLE<qint64>(index, info.minTime);
+        putLE<qint64>(index, info.maxTime);
+        putLE<quint64>(index, info.offset);
+        putLE<quint32>(index, info.byteSize);
+        putLE<quint32>(index, info.barCount);
+        putLE<qint64>(index, info.firstBar);
+    }
+    ok = ok && m_file.write(index) == index.size();
+
+    // 回填Header
+    ok = ok && m_file.seek(0) && writeHeader();
+    ok = ok && m_file.seek(KLineArchiveFormat::kHeaderSize - 8);
+    QByteArray offset;
+    putLE<quint64>(offset, indexOffset);
+    ok = ok && m_file.write(offset) == offset.size();
+
+    if (!ok) m_error = m_file.errorString();
+    m_file.close();
+
+    if (m_lossyPrices > 0) {
+        qDebug() << "KLineArchiveWriter:" << m_lossyPrices << "个价格超出" << m_priceDecimals
+                 << "位小数精度，已四舍五入";
+    }
+    if (m_lossyValues > 0) {
+        qDebug() << "KLineArchiveWriter:" << m_lossyValues
+                 << "个成交量、成交额或持仓量超出可存储的精度，已四舍五入";
+    }
+    return ok;
+}
+
+quint16 KLineArchiveWriter::presentColumns(const KLineColumns &bars)
+{
+    const auto nonZero = [](const QVector<double> &column) {
+        return std::any_of(column.cbegin(), column.cend(), [](double v) { return v != 0; });
+    };
+    quint16 flags = 0;
+    if (nonZero(bars.volume)) flags |= KLineArchiveFormat::HasVolume;
+    if (nonZero(bars.turnover)) flags |= KLineArchiveFormat::HasTurnover;
+    if (nonZero(bars.openInterest)) flags |= KLineArchiveFormat::HasOpenInterest;
+    return flags;
+}
+
+int KLineArchiveWriter::requiredDecimals(const KLineColumns &bars)
+{
+    int decimals = 0;
+    double scale = 1;
+    const auto exact = [&](double price) {
+        return std::abs(std::round(price * scale) / scale - price) <=
+               1e-9 * qMax(1.0, std::abs(price));
+    };
+    for (const QVector<double> *column : {&bars.open, &bars.high, &bars.low, &bars.close}) {
+        for (const double price : *column) {
+            while (!exact(price)) {
+                if (++decimals > 8) return -1;
+                scale *= 10;
+            }
+        }
+    }
+    return decimals;
+}
+
+bool KLineArchiveWriter::writeLossless(const QString &path, const KLineColumns &bars,
+                                       QString *error)
+{
+    if (bars.isEmpty()) {
+        if (error) *error = QStringLiteral("no bars to write");
+        return false;
+    }
+    const int decimals = requiredDecimals(bars);
+    if (decimals < 0) {
+        if (error) *error = QStringLiteral("prices need more than 8 decimals");
+        return false;
+    }
+
+    const QString temporary = path + ".part";
+    KLineArchiveWriter writer(decimals);
+    writer.setColumnFlags(presentColumns(bars));
+    if (!writer.open(temporary) || !writer.append(bars) || !writer.close()) {
+        if (error) *error = writer.errorString();
+        QFile::remove(temporary);
+        return false;
+    }
+    if (writer.lossyPriceCount() > 0 || writer.lossyValueCount() > 0) {
+        if (error) {
+            *error = QStringLiteral("%1 prices and %2 volumes cannot be stored losslessly")
+                         .arg(writer.lossyPriceCount())
+                         .arg(writer.lossyValueCount());
+        }
+        QFile::remove(temporary);
+        return false;
+    }
+
+    QFile::remove(path);
+    if (!QFile::rename(temporary, path)) {
+        if (error) *error = QStringLiteral("cannot rename %1").arg(temporary);
+        QFile::remove(temporary);
+        return false;
+    }
+    return true;
+}
+
+bool KLineArchiveWriter::writeHeader()
+{
+    QByteArray header;
+    header.reserve(KLineArchiveFormat::kHeaderSize);
+    header.append(KLineArchiveFormat::kMagic, 4);
+    putLE<quint16>(header, KLineArchiveFormat::kVersion);
+    putLE<quint16>(header, m_columnFlags);
+    putLE<quint32>(header, quint32(m_priceDecimals));
+    putLE<quint32>(header, quint32(m_blockSize));
+    putLE<quint32>(header, quint32(m_index.size()));
+    putLE<quint64>(header, quint64(m_barCount));
+    putLE<quint64>(header, 0);  // Index位置，close()时回填
+
+    if (m_file.write(header) != header.size()) {
+        m_error = m_file.errorString();
+        return false;
+    }
+    return true;
+}
+
+qint64 KLineArchiveWriter::toFixed(double price)
+{
+    const qint64 fixed = std::llround(price * m_priceScale);
+    if (std::abs(fixed / m_priceScale - price) > 1e-9 * qMax(1.0, std::abs(price))) {
+        ++m_lossyPrices;
+    }
+    return fixed;
+}
+
+qint64 KLineArchiveWriter::toInteger(double value)
+{
+    const qint64 integer = std::llround(value);
+    if (value < 0 || std::abs(double(integer) - value) > 1e-9 * qMax(1.0, std::abs(value))) {
+        ++m_lossyValues;
+    }
+    return integer;
+}
+
+bool KLineArchiveWriter::flushBlock()
+{
+    const KLineColumns &bars = m_pending;
+    const int count = bars.size();
+    if (count == 0) return true;
+
+    QByteArray block;
+    block.reserve(count * 8);
+    putVarint(block, quint64(count));
+
+    // 时间列: 首值 + 首个差分 + 二阶差分
+    qint64 prevTime = bars.time[0];
+    qint64 prevDelta = 0;
+    putSigned(block, prevTime);
+    for (int i = 1; i < count; ++i) {
+        const qint64 delta = bars.time[i] - prevTime;
+        putSigned(block, delta - prevDelta);
+        prevDelta = delta;
+        prevTime = bars.time[i];
+    }
+
+    // 价格列统一转为定点整数
+    QVector<qint64> open(count), high(count), low(count), close(count);
+    for (int i = 0; i < count; ++i) {
+        open[i] = toFixed(bars.open[i]);
+        high[i] = toFixed(bars.high[i]);
+        low[i] = toFixed(bars.low[i]);
+        close[i] = toFixed(bars.close[i]);
+    }
+
+    qint64 prevClose = 0;
+    for (int i = 0; i < count; ++i) {
+        putSigned(block, close[i] - prevClose);
+        prevClose = close[i];
+    }
+    // 开盘价通常等于前收盘价，差分几乎全为0
+    for (int i = 0; i < count; ++i) {
+        putSigned(block, open[i] - (i > 0 ? close[i - 1] : close[0]));
+    }
+    for (int i = 0; i < count; ++i) {
+        putSigned(block, high[i] - qMax(open[i], close[i]));
+    }
+    for (int i = 0; i < count; ++i) {
+        putSigned(block, qMin(open[i], close[i]) - low[i]);
+    }
+    // 没有的可选列不编码，其中的非0值计为有损
+    const bool hasVolume = m_columnFlags & KLineArchiveFormat::HasVolume;
+    for (int i = 0; i < count; ++i) {
+        if (!hasVolume) {
+            if (bars.volume[i] != 0) ++m_lossyValues;
+            continue;
+        }
+        putVarint(block, quint64(qMax<qint64>(0, toInteger(bars.volume[i]))));
+    }
+    const bool hasTurnover = m_columnFlags & KLineArchiveFormat::HasTurnover;
+    for (int i = 0; i < count; ++i) {
+        if (!hasTurnover) {
+            if (bars.turnover[i] != 0) ++m_lossyValues;
+            continue;
+        }
+        const double turnover = bars.turnover[i] * KLineArchiveFormat::kTurnoverScale;
+        putVarint(block, quint64(qMax<qint64>(0, toInteger(turnover))));
+    }
+    const bool hasOpenInterest = m_columnFlags & KLineArchiveFormat::HasOpenInterest;
+    qint64 prevInterest = 0;
+    for (int i = 0; i < count; ++i) {
+        if (!hasOpenInterest) {
+            if (bars.openInterest[i] != 0) ++m_lossyValues;
+            continue;
+        }
+        const qint64 interest = toInteger(bars.openInterest[i]);
+        putSigned(block, interest - prevInterest);
+        prevInterest = interest;
+    }
+
+    KLineArchiveBlockInfo info;
+    info.minTime = *std::min_element(bars.time.cbegin(), bars.time.cend());
+    info.maxTime = *std::max_element(bars.time.cbegin(), bars.time.cend());
+    info.offset = quint64(m_file.pos());
+    info.byteSize = quint32(block.size());
+    info.barCount = quint32(count);
+    info.firstBar = m_barCount;
+
+    if (m_file.write(block) != block.size()) {
+        m_error = m_file.errorString();
+        return false;
+    }
+
+    m_index.append(info);
+    m_barCount += count;
+    m_pending.clear();
+    return true;
+}
+
+// KLineArchiveReader 实现
+KLineArchiveReader::~KLineArchiveReader() { close(); }
+
+bool KLineArchiveReader::open(const QString &path)
+{
+    close();
+    m_path = path;
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        m_error = m_file.errorString();
+        return false;
+    }
+
+    const QByteArray header = m_file.read(KLineArchiveFormat::kHeaderSize);
+    if (header.size() != KLineArchiveFormat::kHeaderSize ||
+        std::memcmp(header.constData(), KLineArchiveFormat::kMagic, 4) != 0) {
+        m_error = QStringLiteral("not a kline archive");
+        m_file.close();
+        return false;
+    }
+
+    const uchar *h = reinterpret_cast<const uchar *>(header.constData());
+    const quint16 version = getLE<quint16>(h + 4);
+    if (version > KLineArchiveFormat::kVersion) {
+        m_error = QStringLiteral("unsupported archive version %1").arg(version);
+        m_file.close();
+        return false;
+    }
+    m_flags = getLE<quint16>(h + 6);
+    m_priceDecimals = int(getLE<quint32>(h + 8));
+    const quint32 blockCount = getLE<quint32>(h + 16);
+    m_barCount = qint64(getLE<quint64>(h + 20));
+    const quint64 indexOffset = getLE<quint64>(h + 28);
+
+    const qint64 indexSize = qint64(blockCount) * KLineArchiveFormat::kIndexEntrySize;
+    if (indexOffset == 0 || qint64(indexOffset) + indexSize > m_file.size() ||
+        !m_file.seek(qint64(indexOffset))) {
+        m_error = QStringLiteral("corrupt archive index");
+        m_file.close();
+        return false;
+    }
+
+    const QByteArray index = m_file.read(indexSize);
+    if (index.size() != indexSize) {
+        m_error = QStringLiteral("corrupt archive index");
+        m_file.close();
+        return false;
+    }
+
+    // 每个Block必须完整落在Header和Index之间，并且首K线序号连续、总数与Header一致，
+    // 否则映射读取会越界（缓存目录里的快照在启动时自动加载，不能信任文件内容）
+    const uchar *p = reinterpret_cast<const uchar *>(index.constData());
+    m_index.resize(int(blockCount));
+    qint64 bars = 0;
+    for (quint32 i = 0; i < blockCount; ++i, p += KLineArchiveFormat::kIndexEntrySize) {
+        KLineArchiveBlockInfo &info = m_index[int(i)];
+        info.minTime = getLE<qint64>(p);
+        info.maxTime = getLE<qint64>(p + 8);
+        info.offset = getLE<quint64>(p + 16);
+        info.byteSize = getLE<quint32>(p + 24);
+        info.barCount = getLE<quint32>(p + 28);
+        info.firstBar = getLE<qint64>(p + 32);
+
+        // 每根K线至少占一个字节，barCount不超过byteSize，解码前的列分配因此受文件大小约束
+        if (info.offset < quint64(KLineArchiveFormat::kHeaderSize) ||
+            info.offset > indexOffset || info.byteSize > indexOffset - info.offset ||
+            info.firstBar != bars || info.barCount > info.byteSize ||
+            (info.barCount == 0 && info.byteSize != 0) ||
+            info.barCount > quint32(std::numeric_limits<int>::max())) {
+            m_error = QStringLiteral("corrupt archive block %1").arg(i);
+            close();
+            return false;
+        }
+        bars += info.barCount;
+    }
+    if (bars != m_barCount) {
+        m_error = QStringLiteral("archive bar count mismatch");
+        close();
+        return false;
+    }
+
+    // 映射失败时（如32位进程的超大文件）退回到按Block读取
+    m_map = m_file.map(0, m_file.size());
+    m_open = true;
+    return true;
+}
+
+void KLineArchiveReader::close()
+{
+    if (m_map) {
+        m_file.unmap(const_cast<uchar *>(m_map));
+        m_map = nullptr;
+    }
+    if (m_file.isOpen()) m_file.close();
+    m_open = false;
+    m_index.clear();
+    m_barCount = 0;
+}
+
+qint64 KLineArchiveReader::firstTime() const
+{
+    return m_index.isEmpty() ? 0 : m_index.first().minTime;
+}
+
+qint64 KLineArchiveReader::lastTime() const
+{
+    return m_index.isEmpty() ? 0 : m_index.last().maxTime;
+}
+
+int KLineArchiveReader::blockForBar(qint64 barIndex) const
+{
+    if (barIndex < 0 || barIndex >= m_barCount) return -1;
+
+    auto it = std::upper_bound(
+        m_index.cbegin(), m_index.cend(), barIndex,
+        [](qint64 bar, const KLineArchiveBlockInfo &info) { return bar < info.firstBar; });
+    return int(it - m_index.cbegin()) - 1;
+}
+
+int KLineArchiveReader::blockForTime(qint64 time) const
+{
+    auto it = std::lower_bound(
+        m_index.cbegin(), m_index.cend(), time,
+        [](const KLineArchiveBlockInfo &info, qint64 t) { return info.maxTime < t; });
+    return it == m_index.cend() ? -1 : int(it - m_index.cbegin());
+}
+
+bool KLineArchiveReader::blockBytes(const KLineArchiveBlockInfo &info, QByteArray *storage,
+                                    const uchar **data, QString *error) const
+{
+    if (m_map) {
+        *data = m_map + info.offset;
+        return true;
+    }
+
+    // 每次读取使用独立的QFile，保证多线程调用安全
+    QFile file(m_path);
+    if (!file.open(QIODevice::ReadOnly) || !file.seek(qint64(info.offset))) {
+        if (error) *error = file.errorString();
+        return false;
+    }
+    *storage = file.read(info.byteSize);
+    if (storage->size() != int(info.byteSize)) {
+        if (error) *error = QStringLiteral("short read");
+        return false;
+    }
+    *data = reinterpret_cast<const uchar *>(storage->constData());
+    return true;
+}
+
+bool KLineArchiveReader::readBlock(int block, KLineColumns &out, QString *error) const
+{
+    KLINE_TRACE_SCOPE("io", "KLineArchiveReader::readBlock");
+    if (!m_open || block < 0 || block >= m_index.size()) {
+        if (error) *error = QStringLiteral("block %1 out of range").arg(block);
+        return false;
+    }
+
+    const KLineArchiveBlockInfo &info = m_index[block];
+    if (info.barCount == 0) return true;
+    QByteArray storage;
+    const uchar *data = nullptr;
+    if (!blockBytes(info, &storage, &data, error)) return false;
+
+    // 先按quint64比较再转换，Block头部损坏时不会得到负数或巨大的分配
+    ByteReader reader{data, data + info.byteSize};
+    const quint64 encoded = reader.varint();
+    if (reader.failed || encoded != info.barCount ||
+        encoded > quint64(std::numeric_limits<int>::max() - out.size())) {
+        if (error) *error = QStringLiteral("block %1 bar count mismatch").arg(block);
+        return false;
+    }
+    const int count = int(encoded);
+    const int base = out.size();
+    const int total = base + count;
+    out.time.resize(total);
+    out.open.resize(total);
+    out.high.resize(total);
+    out.low.resize(total);
+    out.close.resize(total);
+    out.volume.resize(total);
+    out.turnover.resize(total);
+    out.openInterest.resize(total);
+
+    qint64 *time = out.time.data() + base;
+    qint64 t = reader.svarint();
+    qint64 delta = 0;
+    time[0] = t;
+    for (int i = 1; i < count; ++i) {
+        delta += reader.svarint();
+        t += delta;
+        time[i] = t;
+    }
+
+    // 先解出定点收盘价，其余价格列都以它为参照
+    QVector<qint64> closeFixed(count);
+    qint64 c = 0;
+    for (int i = 0; i < count; ++i) {
+        c += reader.svarint();
+        closeFixed[i] = c;
+    }
+    QVector<qint64> openFixed(count);
+    for (int i = 0; i < count; ++i) {
+        openFixed[i] = (i > 0 ? closeFixed[i - 1] : closeFixed[0]) + reader.svarint();
+    }
+
+    const double scale = std::pow(10.0, m_priceDecimals);
+    double *open = out.open.data() + base;
+    double *high = out.high.data() + base;
+    double *low = out.low.data() + base;
+    double *close = out.close.data() + base;
+    double *volume = out.volume.data() + base;
+    for (int i = 0; i < count; ++i) {
+        open[i] = openFixed[i] / scale;
+        close[i] = closeFixed[i] / scale;
+    }
+    for (int i = 0; i < count; ++i) {
+        high[i] = (qMax(openFixed[i], closeFixed[i]) + reader.svarint()) / scale;
+    }
+    for (int i = 0; i < count; ++i) {
+        low[i] = (qMin(openFixed[i], closeFixed[i]) - reader.svarint()) / scale;
+    }
+    for (int i = 0; i < count; ++i) {
+        volume[i] = (m_flags & KLineArchiveFormat::HasVolume) ? double(reader.varint()) : 0.0;
+    }
+    double *turnover = out.turnover.data() + base;
+    for (int i = 0; i < count; ++i) {
+        turnover[i] = (m_flags & KLineArchiveFormat::HasTurnover)
+                          ? reader.varint() / KLineArchiveFormat::kTurnoverScale
+                          : 0.0;
+    }
+    double *openInterest = out.openInterest.data() + base;
+    qint64 interest = 0;
+    for (int i = 0; i < count; ++i) {
+        if (m_flags & KLineArchiveFormat::HasOpenInterest) interest += reader.svarint();
+        openInterest[i] = double(interest);
+    }
+
+    if (reader.failed) {
+        out.time.resize(base);
+        out.open.resize(base);
+        out.high.resize(base);
+        out.low.resize(base);
+        out.close.resize(base);
+        out.volume.resize(base);
+        out.turnover.resize(base);
+        out.openInterest.resize(base);
+        if (error) *error = QStringLiteral("block %1 is truncated").arg(block);
+        return false;
+    }
+    return true;
+}
+
+bool KLineArchiveReader::readBars(qint64 firstBar, int count, KLineColumns &out,
+                                  QString *error) const
+{
+    if (count <= 0) return true;
+
+    firstBar = qMax<qint64>(0, firstBar);
+    const qint64 lastBar = qMin(m_barCount, firstBar + count);  // 不含
+    int block = blockForBar(firstBar);
+    if (block < 0) {
+        if (error) *error = QStringLiteral("bar %1 out of range").arg(firstBar);
+        return false;
+    }
+
+    out.reserve(out.size() + int(lastBar - firstBar));
+    KLineColumns decoded;
+    for (; block < m_index.size() && m_index[block].firstBar < lastBar; ++block) {
+        decoded.clear();
+        if (!readBlock(block, decoded, error)) return false;
+
+        const KLineArchiveBlockInfo &info = m_index[block];
+        const int from = int(qMax<qint64>(0, firstBar - info.firstBar));
+        const int to = int(qMin<qint64>(info.barCount, lastBar - info.firstBar));
+        out.appendRange(decoded, from, to - from);
+    }
+    return true;
+}
+
+bool KLineArchiveReader::readTimeRange(qint64 from, qint64 to, KLineColumns &out,
+                                      QString *error) const
+{
+    int block = blockForTime(from);
+    if (block < 0) return true;
+
+    KLineColumns decoded;
+    for (; block < m_index.size() && m_index[block].minTime <= to; ++block) {
+        decoded.clear();
+        if (!readBlock(block, decoded, error)) return false;
+
+        // Block内时间有序，二分定位区间边界
+        const auto begin = std::lower_bound(decoded.time.cbegin(), decoded.time.cend(), from);
+        const auto end = std::upper_bound(begin, decoded.time.cend(), to);
+        out.appendRange(decoded, int(begin - decoded.time.cbegin()), int(end - begin));
+    }
+    return true;
+}
@@ -0,0 +1,152 @@
+#ifndef KLINEARCHIVE_H
+#define KLINEARCHIVE_H
+
+#include <QFile>
+#include <QString>
+#include <QVector>
+
+#include "KLineColumns.h"
+
+// 压缩列式K线归档 (.kla)
+//
+// 文件布局: [Header][Block 0][Block 1]...[Block N-1][Index]
+// 每个Block独立可解码，Index记录每个Block的时间范围和在文件中的位置，
+// 因此只需读取Header和Index就能定位任意时间窗口，无需触碰其余数据。
+//
+// Block内部按列存储:
+//   时间   - delta-of-delta + zigzag varint
+//   收盘价 - 定点数相邻差分
+//   开盘价 - 相对前一根收盘价的定点差分
+//   最高价 - 相对max(开,收)的定点差分
+//   最低价 - 相对min(开,收)的定点差分
+//   成交量 - varint
+//   成交额 - 两位小数定点varint
+//   持仓量 - 相邻差分 zigzag varint
+// 成交量、成交额和持仓量是可选列，Header的列标志不含时Block里没有该列，读出为0
+namespace KLineArchiveFormat {
+
+constexpr char kMagic[4] = {'K', 'L', 'A', '1'};
+constexpr quint16 kVersion = 1;
+constexpr int kHeaderSize = 36;
+constexpr int kIndexEntrySize = 40;
+constexpr int kDefaultBlockSize = 4096;
+
+enum ColumnFlag : quint16 {
+    HasVolume = 0x0001,
+    HasTurnover = 0x0002,
+    HasOpenInterest = 0x0004,
+};
+
+constexpr quint16 kAllColumns = HasVolume | HasTurnover | HasOpenInterest;
+constexpr double kTurnoverScale = 100.0;
+
+}  // namespace KLineArchiveFormat
+
+struct KLineArchiveBlockInfo
+{
+    qint64 minTime = 0;
+    qint64 maxTime = 0;
+    quint64 offset = 0;
+    quint32 byteSize = 0;
+    quint32 barCount = 0;
+    qint64 firstBar = 0;  // 该Block第一根K线在整个归档中的序号
+};
+
+class KLineArchiveWriter
+{
+public:
+    explicit KLineArchiveWriter(int priceDecimals = 2,
+                                int blockSize = KLineArchiveFormat::kDefaultBlockSize);
+    ~KLineArchiveWriter();
+
+    // 归档包含的可选列（KLineArchiveFormat::ColumnFlag），缺少的列不编码，读出为0；open()前设置
+    void setColumnFlags(quint16 flags) { m_columnFlags = flags; }
+    quint16 columnFlags() const { return m_columnFlags; }
+
+    bool open(const QString &path);
+    bool append(const KLineColumns &bars);
+    bool close();
+
+    // bars中不全为0的可选列
+    static quint16 presentColumns(const KLineColumns &bars);
+    // 所有价格都能精确表示所需的最少小数位数，超过归档支持的8位时返回-1
+    static int requiredDecimals(const KLineColumns &bars);
+    // 把bars原样写成归档：小数位数和可选列按数据确定，先写path.part再改名。
+    // 价格超过8位小数或成交量、持仓量不能原样保存时不写入，失败原因写入error
+    static bool writeLossless(const QString &path, const KLineColumns &bars,
+                              QString *error = nullptr);
+
+    qint64 barCount() const { return m_barCount; }
+    int lossyPriceCount() const { return m_lossyPrices; }
+    // 成交量、持仓量不是非负整数，或成交额超出两位小数的个数
+    int lossyValueCount() const { return m_lossyValues; }
+    QString errorString() const { return m_error; }
+
+private:
+    bool flushBlock();
+    bool writeHeader();
+    qint64 toFixed(double price);
+    qint64 toInteger(double value);
+
+    QFile m_file;
+    KLineColumns m_pending;
+    QVector<KLineArchiveBlockInfo> m_index;
+    int m_priceDecimals;
+    int m_blockSize;
+    quint16 m_columnFlags = KLineArchiveFormat::kAllColumns;
+    double m_priceScale;
+    qint64 m_barCount = 0;
+    int m_lossyPrices = 0;
+    int m_lossyValues = 0;
+    QString m_error;
+};
+
+class KLineArchiveReader
+{
+public:
+    KLineArchiveReader() = default;
+    ~KLineArchiveReader();
+
+    bool open(const QString &path);
+    void close();
+    bool isOpen() const { return m_open; }
+
+    QString path() const { return m_path; }
+    qint64 barCount() const { return m_barCount; }
+    qint64 firstTime() const;
+    qint64 lastTime() const;
+    int priceDecimals() const { return m_priceDecimals; }
+    quint16 columnFlags() const { return m_flags; }
+    const QVector<KLineArchiveBlockInfo> &blocks() const { return m_index; }
+
+    // 二分查找包含第barIndex根K线的Block
+    int blockForBar(qint64 barIndex) const;
+    // 二分查找第一个maxTime >= time的Block
+    int blockForTime(qint64 time) const;
+
+    // 以下读取函数只访问只读映射，可在多个线程中同时调用；失败原因写入error，
+    // 不修改读取器的状态
+    bool readBlock(int block, KLineColumns &out, QString *error = nullptr) const;
+    bool readBars(qint64 firstBar, int count, KLineColumns &out, QString *error = nullptr) const;
+    bool readTimeRange(qint64 from, qint64 to, KLineColumns &out,
+                       QString *error = nullptr) const;
+
+    // open()的失败原因
+    QString errorString() const { return m_error; }
+
+private:
+    bool blockBytes(const KLineArchiveBlockInfo &info, QByteArray *storage, const uchar **data,
+                    QString *error) const;
+
+    QString m_path;
+    QFile m_file;
+    const uchar *m_map = nullptr;
+    bool m_open = false;
+    quint16 m_flags = 0;
+    int m_priceDecimals = 2;
+    qint64 m_barCount = 0;
+    QVector<KLineArchiveBlockInfo> m_index;
+    QString m_error;
+};
+
+#endif  // KLINEARCHIVE_H
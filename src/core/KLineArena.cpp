@@ -0,0 +1,113 @@
+#include "KLineArena.h"
+
+#include <ta_libc.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "KLineMetrics.h"
+
+namespace {
+
+void *taAlloc(std::size_t size, void *opaque)
+{
+    return static_cast<KLineArena *>(opaque)->allocate(size);
+}
+
+std::size_t alignUp(std::uintptr_t value)
+{
+    return (value + KLineArena::kAlignment - 1) & ~std::uintptr_t(KLineArena::kAlignment - 1);
+}
+
+}  // namespace
+
+KLineArena &KLineArena::local()
+{
+    thread_local KLineArena arena;
+    return arena;
+}
+
+void *KLineArena::allocate(std::size_t size)
+{
+    if (size == 0) size = 1;
+    while (m_current < m_blocks.size()) {
+        Block &block = m_blocks[m_current];
+        const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.data.get());
+        const std::size_t begin = alignUp(base + m_offset) - base;
+        if (begin + size <= block.size) {
+            m_offset = begin + size;
+            m_roundPeak = std::max(m_roundPeak, used());
+            m_peak = std::max(m_peak, m_roundPeak);
+            return block.data.get() + begin;
+        }
+        ++m_current;
+        m_offset = 0;
+    }
+
+    addBlock(size);
+    return allocate(size);
+}
+
+void KLineArena::reset()
+{
+    const std::size_t total = capacity();
+    if (total > kBlockSize && m_roundPeak * kShrinkRatio < total) {
+        m_recentPeak = std::max(m_recentPeak, m_roundPeak);
+        ++m_lowRounds;
+    } else {
+        m_recentPeak = 0;
+        m_lowRounds = 0;
+    }
+
+    if (m_lowRounds >= kRetainRounds) {
+        m_blocks.clear();
+        addBlock(m_recentPeak);
+        m_recentPeak = 0;
+        m_lowRounds = 0;
+    } else if (m_blocks.size() > 1) {
+        m_blocks.clear();
+        addBlock(total);
+    }
+    m_current = 0;
+    m_offset = 0;
+    m_roundPeak = 0;
+}
+
+std::size_t KLineArena::used() const
+{
+    std::size_t total = m_offset;
+    for (std::size_t i = 0; i < m_current && i < m_blocks.size(); ++i) total += m_blocks[i].size;
+    return total;
+}
+
+std::size_t KLineArena::capacity() const
+{
+    std::size_t total = 0;
+    for (const Block &block : m_blocks) total += block.size;
+    return total;
+}
+
+void KLineArena::addBlock(std::size_t minimum)
+{
+    // new[]只保证基本对齐，多留一个kAlignment用于对齐首地址
+    Block block;
+    block.size = std::max(kBlockSize, minimum + kAlignment);
+    block.data.reset(new unsigned char[block.size]);
+    m_blocks.push_back(std::move(block));
+}
+
+KLineArena::Scope::Scope() : m_arena(KLineArena::local())
+{
+    if (m_arena.m_depth++ == 0) TA_SetScratchAllocator(taAlloc, nullptr, &m_arena);
+}
+
+KLineArena::Scope::~Scope()
+{
+    if (--m_arena.m_depth > 0) return;
+
+    TA_SetScratchAllocator(nullptr, nullptr, nullptr);
+    if (KLineMetrics::isEnabled()) {
+        KLineMetrics::setGauge("indicators.arena_bytes", qint64(m_arena.capacity()));
+    }
+    m_arena.reset();
+}
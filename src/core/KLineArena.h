@@ -0,0 +1,75 @@
+#ifndef KLINEARENA_H
+#define KLINEARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// 线程内的线性分配器，用于一次指标重算期间的临时缓冲区
+//
+// 分配只是在预留的大块内移动偏移，重算结束时整体回收；大块保留给下一次重算，
+// 稳定状态下不再调用malloc/free。每个线程一个实例（local），不加锁，不能跨线程使用。
+class KLineArena
+{
+public:
+    static constexpr std::size_t kAlignment = 64;           // 缓存行对齐
+    static constexpr std::size_t kBlockSize = 1024 * 1024;  // 默认大块，超过时按需求单独分配
+    // 连续kRetainRounds轮的用量都不到容量的1/kShrinkRatio时，释放到这几轮的最高用量（至少kBlockSize），
+    // 一次超大的重算不会让峰值内存一直留在每个线程的arena里
+    static constexpr int kRetainRounds = 16;
+    static constexpr std::size_t kShrinkRatio = 4;
+
+    static KLineArena &local();
+
+    // 返回kAlignment对齐、至少size字节的内存，有效期到下一次reset
+    void *allocate(std::size_t size);
+    template <typename T>
+    T *allocate(std::size_t count)
+    {
+        return static_cast<T *>(allocate(count * sizeof(T)));
+    }
+
+    // 回收全部分配；上一轮用到多个大块时合并成一块，下一轮一次放下；
+    // 最近几轮的用量远小于容量时缩回
+    void reset();
+
+    std::size_t used() const;
+    std::size_t capacity() const;
+    std::size_t peak() const { return m_peak; }
+
+    // 作用域内把本线程的arena安装为TA-Lib的临时数组分配器，离开时恢复malloc/free。
+    // 可以嵌套，最外层离开时回收arena
+    class Scope
+    {
+    public:
+        Scope();
+        ~Scope();
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        KLineArena &m_arena;
+    };
+
+private:
+    KLineArena() = default;
+
+    struct Block
+    {
+        std::unique_ptr<unsigned char[]> data;
+        std::size_t size = 0;
+    };
+
+    void addBlock(std::size_t minimum);
+
+    std::vector<Block> m_blocks;
+    std::size_t m_current = 0;  // 正在分配的块
+    std::size_t m_offset = 0;   // 当前块内已用字节
+    std::size_t m_peak = 0;
+    std::size_t m_roundPeak = 0;   // 本轮（上次reset以来）的最高用量
+    std::size_t m_recentPeak = 0;  // 连续低用量各轮中的最高用量
+    int m_lowRounds = 0;           // 用量不到容量1/kShrinkRatio的连续轮数
+    int m_depth = 0;  // Scope嵌套层数
+};
+
+#endif  // KLINEARENA_H
@@ -0,0 +1,198 @@
+#include "KLineBarBuilder.h"
+
+#include <QDebug>
+
+KLineBarBuilder::KLineBarBuilder(Kind kind, double threshold)
+    : m_kind(kind), m_threshold(threshold)
+{
+}
+
+KLineBarBuilder KLineBarBuilder::fromSpec(const QString &spec)
+{
+    static const struct
+    {
+        const char *prefix;
+        Kind kind;
+    } kPrefixes[] = {
+        {"tick", TickBars},   {"vol", VolumeBars},  {"dollar", DollarBars},
+        {"range", RangeBars}, {"renko", RenkoBars},
+    };
+
+    const int colon = spec.indexOf(':');
+    if (colon > 0) {
+        const QString prefix = spec.left(colon);
+        bool ok = false;
+        const double threshold = spec.mid(colon + 1).toDouble(&ok);
+        for (const auto &entry : kPrefixes) {
+            if (prefix == QLatin1String(entry.prefix) && ok) {
+                return KLineBarBuilder(entry.kind, threshold);
+            }
+        }
+    }
+
+    qDebug() << "KLineBarBuilder: 无效的K线类型:" << spec;
+    return KLineBarBuilder(Invalid, 0);
+}
+
+bool KLineBarBuilder::isBarSpec(const QString &spec) { return spec.contains(':'); }
+
+void KLineBarBuilder::push(const KLineTicks &ticks) { push(ticks, 0, ticks.count()); }
+
+void KLineBarBuilder::push(const KLineTicks &ticks, int from, int count)
+{
+    switch (m_kind) {
+    case TimeBars:
+        pushTime(ticks, from, count);
+        break;
+    case TickBars:
+        pushAccumulated(ticks, from, count, [](double, double) { return 1.0; });
+        break;
+    case VolumeBars:
+        pushAccumulated(ticks, from, count, [](double, double size) { return size; });
+        break;
+    case DollarBars:
+        pushAccumulated(ticks, from, count,
+                        [](double price, double size) { return price * size; });
+        break;
+    case RangeBars:
+        pushRange(ticks, from, count);
+        break;
+    case RenkoBars:
+        pushRenko(ticks, from, count);
+        break;
+    case Invalid:
+        break;
+    }
+}
+
+template <typename Measure>
+void KLineBarBuilder::pushAccumulated(const KLineTicks &ticks, int from, int count,
+                                      Measure measure)
+{
+    const qint64 *time = ticks.time.constData() + from;
+    const double *price = ticks.price.constData() + from;
+    const double *size = ticks.size.constData() + from;
+    const double threshold = m_threshold;
+    PendingBar bar = m_bar;
+
+    for (int i = 0; i < count; ++i) {
+        const double p = price[i];
+        if (!bar.active) {
+            bar.start(time[i], p);
+        } else {
+            bar.update(p);
+        }
+        bar.volume += size[i];
+        bar.turnover += p * size[i];
+        // 触发阈值的那一笔归入当前K线，不拆分
+        bar.accumulated += measure(p, size[i]);
+        if (bar.accumulated >= threshold) emitBar(bar);
+    }
+    m_bar = bar;
+}
+
+void KLineBarBuilder::pushTime(const KLineTicks &ticks, int from, int count)
+{
+    const qint64 *time = ticks.time.constData() + from;
+    const double *price = ticks.price.constData() + from;
+    const double *size = ticks.size.constData() + from;
+    const qint64 bucketMs = qint64(m_threshold) * KLineTime::kMinuteMs;
+    PendingBar bar = m_bar;
+
+    for (int i = 0; i < count; ++i) {
+        const double p = price[i];
+        const qint64 bucket = KLineTime::floorDiv(time[i], bucketMs);
+        if (!bar.active || bucket != bar.bucket) {
+            if (bar.active) emitBar(bar);
+            // 时间K线的时间取周期起点，与分钟K线数据源保持一致
+            bar.start(bucket * bucketMs, p);
+            bar.bucket = bucket;
+        } else {
+            bar.update(p);
+        }
+        bar.volume += size[i];
+        bar.turnover += p * size[i];
+    }
+    m_bar = bar;
+}
+
+void KLineBarBuilder::pushRange(const KLineTicks &ticks, int from, int count)
+{
+    const qint64 *time = ticks.time.constData() + from;
+    const double *price = ticks.price.constData() + from;
+    const double *size = ticks.size.constData() + from;
+    const double threshold = m_threshold;
+    PendingBar bar = m_bar;
+
+    for (int i = 0; i < count; ++i) {
+        const double p = price[i];
+        if (!bar.active) {
+            bar.start(time[i], p);
+        } else {
+            bar.update(p);
+        }
+        bar.volume += size[i];
+        bar.turnover += p * size[i];
+        if (bar.high - bar.low >= threshold) emitBar(bar);
+    }
+    m_bar = bar;
+}
+
+void KLineBarBuilder::pushRenko(const KLineTicks &ticks, int from, int count)
+{
+    const qint64 *time = ticks.time.constData() + from;
+    const double *price = ticks.price.constData() + from;
+    const double *size = ticks.size.constData() + from;
+    const double brick = m_threshold;
+    PendingBar bar = m_bar;
+
+    for (int i = 0; i < count; ++i) {
+        const double p = price[i];
+        if (!bar.active) {
+            // 第一笔成交价作为砖块基准
+            bar.start(time[i], p);
+            m_renkoBase = p;
+            m_renkoTop = m_renkoBottom = 0;
+        }
+        bar.volume += size[i];
+        bar.turnover += p * size[i];
+
+        // 一笔跳空可能生成多块砖，之前累计的成交量计入第一块
+        while (p >= m_renkoBase + (m_renkoTop + 1) * brick) {
+            const double open = m_renkoBase + m_renkoTop * brick;
+            m_result.append(time[i], open, open + brick, open, open + brick, bar.volume,
+                            bar.turnover);
+            bar.volume = bar.turnover = 0;
+            m_renkoBottom = m_renkoTop;
+            ++m_renkoTop;
+        }
+        while (p <= m_renkoBase + (m_renkoBottom - 1) * brick) {
+            const double open = m_renkoBase + m_renkoBottom * brick;
+            m_result.append(time[i], open, open, open - brick, open - brick, bar.volume,
+                            bar.turnover);
+            bar.volume = bar.turnover = 0;
+            m_renkoTop = m_renkoBottom;
+            --m_renkoBottom;
+        }
+    }
+    m_bar = bar;
+}
+
+void KLineBarBuilder::finish()
+{
+    if (m_kind != RenkoBars && m_bar.active) emitBar(m_bar);
+    m_bar = PendingBar();
+}
+
+KLineColumns KLineBarBuilder::takeResult()
+{
+    KLineColumns result = std::move(m_result);
+    m_result.clear();
+    return result;
+}
+
+void KLineBarBuilder::emitBar(PendingBar &bar)
+{
+    m_result.append(bar.time, bar.open, bar.high, bar.low, bar.close, bar.volume, bar.turnover);
+    bar.active = false;
+}
@@ -0,0 +1,97 @@
+#ifndef KLINEBARBUILDER_H
+#define KLINEBARBUILDER_H
+
+#include <QString>
+
+#include "KLineColumns.h"
+#include "KLineTicks.h"
+
+// 从逐笔数据流式构建K线
+//
+// 支持按时间、固定笔数、固定成交量、固定成交额、价格跨度(Range)和砖块(Renko)切分，
+// 输出与KLineAggregator相同的列式K线，绘图和指标不需要区分K线的来源。
+// 与KLineAggregator一样可以分批push，跨批次的未完成K线保留到下一批。
+// 每种切分方式各有一个内层循环，循环内只有指针访问和浮点比较，不做分配。
+class KLineBarBuilder
+{
+public:
+    enum Kind {
+        Invalid,
+        TimeBars,    // threshold为分钟数，按自然分钟对齐
+        TickBars,    // threshold笔成交合成一根
+        VolumeBars,  // 累计成交量达到threshold
+        DollarBars,  // 累计成交额达到threshold
+        RangeBars,   // 最高最低价差达到threshold
+        RenkoBars,   // 价格每移动threshold生成一块砖，反转需要移动两倍
+    };
+
+    KLineBarBuilder(Kind kind, double threshold);
+
+    // 周期字符串: "tick:100" "vol:5000" "dollar:1e6" "range:1" "renko:0.5"
+    static KLineBarBuilder fromSpec(const QString &spec);
+    static bool isBarSpec(const QString &spec);
+
+    bool isValid() const { return m_kind != Invalid && m_threshold > 0; }
+    Kind kind() const { return m_kind; }
+    double threshold() const { return m_threshold; }
+
+    void push(const KLineTicks &ticks);
+    // 只push [from, from + count)，大批输入可以分段push以便在段之间检查取消
+    void push(const KLineTicks &ticks, int from, int count);
+    // 输出最后一根未完成的K线；Renko未成形的砖块不输出
+    void finish();
+
+    const KLineColumns &result() const { return m_result; }
+    KLineColumns takeResult();
+
+private:
+    // 正在构建的K线。内层循环把它复制到局部变量中更新，
+    // 避免编译器因为与输入指针可能别名而每笔都回写成员
+    struct PendingBar
+    {
+        bool active = false;
+        qint64 bucket = 0;
+        double accumulated = 0;
+        qint64 time = 0;
+        double open = 0;
+        double high = 0;
+        double low = 0;
+        double close = 0;
+        double volume = 0;
+        double turnover = 0;
+
+        void start(qint64 t, double price)
+        {
+            active = true;
+            time = t;
+            open = high = low = close = price;
+            volume = turnover = accumulated = 0;
+        }
+
+        void update(double price)
+        {
+            if (price > high) high = price;
+            if (price < low) low = price;
+            close = price;
+        }
+    };
+
+    template <typename Measure>
+    void pushAccumulated(const KLineTicks &ticks, int from, int count, Measure measure);
+    void pushTime(const KLineTicks &ticks, int from, int count);
+    void pushRange(const KLineTicks &ticks, int from, int count);
+    void pushRenko(const KLineTicks &ticks, int from, int count);
+
+    void emitBar(PendingBar &bar);
+
+    Kind m_kind;
+    double m_threshold;
+    PendingBar m_bar;
+    // Renko: 最近一块砖的上下沿 = m_renkoBase + 序号 * threshold，用整数序号避免累积误差
+    double m_renkoBase = 0;
+    qint64 m_renkoTop = 0;
+    qint64 m_renkoBottom = 0;
+    KLineColumns m_result;
+};
+
+#endif  // KLINEBARBUILDER_H
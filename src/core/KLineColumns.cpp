@@ -0,0 +1,203 @@
+#include "KLineColumns.h"
+
+void KLineColumns::reserve(int count)
+{
+    time.reserve(count);
+    open.reserve(count);
+    high.reserve(count);
+    low.reserve(count);
+    close.reserve(count);
+    volume.reserve(count);
+    turnover.reserve(count);
+    openInterest.reserve(count);
+}
+
+void KLineColumns::clear()
+{
+    time.clear();
+    open.clear();
+    high.clear();
+    low.clear();
+    close.clear();
+    volume.clear();
+    turnover.clear();
+    openInterest.clear();
+    single = Single();
+}
+
+void KLineColumns::append(qint64 t, double o, double h, double l, double c, double v,
+                          double amount, double oi)
+{
+    if (hasSingle()) {
+        single.high.append(float(h));
+        single.low.append(float(l));
+        single.close.append(float(c));
+        single.volume.append(float(v));
+    }
+    time.append(t);
+    open.append(o);
+    high.append(h);
+    low.append(l);
+    close.append(c);
+    volume.append(v);
+    turnover.append(amount);
+    openInterest.append(oi);
+}
+
+void KLineColumns::appendRange(const KLineColumns &other, int from, int count)
+{
+    if (from < 0 || count <= 0 || from + count > other.size()) return;
+
+    if (other.hasSingle() && (isEmpty() || hasSingle())) {
+        single.high.append(other.single.high.mid(from, count));
+        single.low.append(other.single.low.mid(from, count));
+        single.close.append(other.single.close.mid(from, count));
+        single.volume.append(other.single.volume.mid(from, count));
+    } else {
+        single = Single();
+    }
+    time.append(other.time.mid(from, count));
+    open.append(other.open.mid(from, count));
+    high.append(other.high.mid(from, count));
+    low.append(other.low.mid(from, count));
+    close.append(other.close.mid(from, count));
+    volume.append(other.volume.mid(from, count));
+    turnover.append(other.turnover.mid(from, count));
+    openInterest.append(other.openInterest.mid(from, count));
+}
+
+void KLineColumns::buildSingle()
+{
+    const auto toFloat = [](const QVector<double> &column, QVector<float> &out) {
+        out.resize(column.size());
+        for (int i = 0; i < column.size(); ++i) out[i] = float(column[i]);
+    };
+    toFloat(high, single.high);
+    toFloat(low, single.low);
+    toFloat(close, single.close);
+    toFloat(volume, single.volume);
+}
+
+namespace KLineTime {
+
+// 公历日期与1970-01-01起的天数互转 (Howard Hinnant 算法)
+qint64 daysFromCivil(int year, int month, int day)
+{
+    year -= month <= 2;
+    const qint64 era = (year >= 0 ? year : year - 399) / 400;
+    const int yoe = static_cast<int>(year - era * 400);
+    const int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+void civilFromDays(qint64 days, int *year, int *month, int *day)
+{
+    days += 719468;
+    const qint64 era = (days >= 0 ? days : days - 146096) / 146097;
+    const int doe = static_cast<int>(days - era * 146097);
+    const int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const int mp = (5 * doy + 2) / 153;
+    const int d = doy - (153 * mp + 2) / 5 + 1;
+    const int m = mp + (mp < 10 ? 3 : -9);
+    *year = static_cast<int>(yoe + era * 400 + (m <= 2));
+    *month = m;
+    *day = d;
+}
+
+static int daysInMonth(int year, int month)
+{
+    static const int kDays[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    return month == 2 && leap ? 29 : kDays[month - 1];
+}
+
+static bool readNumber(QStringView text, int &pos, int digits, int *value)
+{
+    int result = 0;
+    for (int i = 0; i < digits; ++i, ++pos) {
+        if (pos >= text.size()) return false;
+        const QChar ch = text[pos];
+        if (ch < u'0' || ch > u'9') return false;
+        result = result * 10 + (ch.unicode() - u'0');
+    }
+    *value = result;
+    return true;
+}
+
+static bool expect(QStringView text, int &pos, char16_t a, char16_t b = 0)
+{
+    if (pos >= text.size()) return false;
+    const char16_t ch = text[pos].unicode();
+    if (ch != a && (b == 0 || ch != b)) return false;
+    ++pos;
+    return true;
+}
+
+qint64 parse(QStringView text, bool *ok)
+{
+    text = text.trimmed();
+    int pos = 0;
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+
+    bool valid = readNumber(text, pos, 4, &year) && expect(text, pos, u'-', u'/') &&
+                 readNumber(text, pos, 2, &month) && expect(text, pos, u'-', u'/') &&
+                 readNumber(text, pos, 2, &day) && expect(text, pos, u' ', u'T') &&
+                 readNumber(text, pos, 2, &hour) && expect(text, pos, u':') &&
+                 readNumber(text, pos, 2, &minute);
+    // 秒是可选的，逐笔数据还可以带毫秒 ".fff"
+    int msec = 0;
+    if (valid && pos < text.size()) {
+        valid = expect(text, pos, u':') && readNumber(text, pos, 2, &second);
+    }
+    if (valid && pos < text.size()) {
+        valid = expect(text, pos, u'.') && pos < text.size();
+        for (int scale = 100; valid && pos < text.size(); scale /= 10, ++pos) {
+            const QChar ch = text[pos];
+            if (ch < u'0' || ch > u'9') {
+                valid = false;
+                break;
+            }
+            msec += (ch.unicode() - u'0') * scale;  // 超过3位的部分scale为0，直接截断
+        }
+    }
+    // 2024-02-31这类不存在的日期不能顺延成下个月的某天
+    valid = valid && month >= 1 && month <= 12 && day >= 1 && day <= daysInMonth(year, month) &&
+            hour < 24 && minute < 60 && second < 60;
+
+    if (ok) *ok = valid;
+    if (!valid) return 0;
+
+    const qint64 days = daysFromCivil(year, month, day);
+    return ((days * 24 + hour) * 60 + minute) * kMinuteMs + second * 1000 + msec;
+}
+
+QString format(qint64 msecs)
+{
+    const qint64 days = floorDiv(msecs, kDayMs);
+    const qint64 rest = msecs - days * kDayMs;
+
+    int year, month, day;
+    civilFromDays(days, &year, &month, &day);
+    const int seconds = static_cast<int>(rest / 1000);
+
+    char buffer[20];
+    const int parts[6] = {year, month, day, seconds / 3600, seconds / 60 % 60, seconds % 60};
+    // yyyy-MM-dd hh:mm:ss，逐字符写入比QString::asprintf快得多
+    int yearDigits = parts[0];
+    for (int i = 3; i >= 0; --i) {
+        buffer[i] = char('0' + yearDigits % 10);
+        yearDigits /= 10;
+    }
+    int pos = 4;
+    const char separators[5] = {'-', '-', ' ', ':', ':'};
+    for (int i = 1; i < 6; ++i) {
+        buffer[pos++] = separators[i - 1];
+        buffer[pos++] = char('0' + parts[i] / 10);
+        buffer[pos++] = char('0' + parts[i] % 10);
+    }
+    return QString::fromLatin1(buffer, pos);
+}
+
+}  // namespace KLineTime
@@ -0,0 +1,71 @@
+#ifndef KLINECOLUMNS_H
+#define KLINECOLUMNS_H
+
+#include <QMetaType>
+#include <QString>
+#include <QStringView>
+#include <QVector>
+#include <QtGlobal>
+
+// 列式K线数据：每个字段一个连续数组，便于压缩编码和直接传给TA-Lib
+struct KLineColumns
+{
+    QVector<qint64> time;  // 毫秒时间戳（把交易所本地时间按UTC解释，不做时区换算）
+    QVector<double> open;
+    QVector<double> high;
+    QVector<double> low;
+    QVector<double> close;
+    QVector<double> volume;        // 成交量，合成时求和
+    QVector<double> turnover;      // 成交额，合成时求和
+    QVector<double> openInterest;  // 持仓量，合成时取最后一根
+
+    // 指标输入列的单精度镜像，只在单精度指标模式下由buildSingle()在数据集生成时建立一次，
+    // 之后由append/appendRange随双精度列一起维护，TA-Lib的TA_S_*直接读取；平时为空
+    struct Single
+    {
+        QVector<float> high;
+        QVector<float> low;
+        QVector<float> close;
+        QVector<float> volume;
+    };
+    Single single;
+
+    int size() const { return time.size(); }
+    bool isEmpty() const { return time.isEmpty(); }
+    bool hasSingle() const { return !isEmpty() && single.close.size() == size(); }
+
+    void reserve(int count);
+    void clear();
+    void append(qint64 t, double o, double h, double l, double c, double v = 0,
+                double amount = 0, double oi = 0);
+    // 源数据带单精度镜像且本身为空或也带镜像时，镜像一并追加；否则丢弃镜像
+    void appendRange(const KLineColumns &other, int from, int count);
+    // 由high/low/close/volume生成单精度镜像
+    void buildSingle();
+};
+
+Q_DECLARE_METATYPE(KLineColumns)
+
+// K线时间戳与文本互转，避免在热路径上使用QDateTime::fromString
+namespace KLineTime {
+
+// 解析 "yyyy-MM-dd hh:mm[:ss[.fff]]" 或 "yyyy/MM/dd hh:mm[:ss[.fff]]"
+qint64 parse(QStringView text, bool *ok = nullptr);
+// 格式化为 "yyyy-MM-dd hh:mm:ss"
+QString format(qint64 msecs);
+
+qint64 daysFromCivil(int year, int month, int day);
+void civilFromDays(qint64 days, int *year, int *month, int *day);
+
+constexpr qint64 kMinuteMs = 60 * 1000;
+constexpr qint64 kDayMs = 24 * 60 * kMinuteMs;
+
+// 向负无穷取整的整数除法：1970年以前的时间戳和视口左侧的负序号也按整格分组
+constexpr qint64 floorDiv(qint64 value, qint64 divisor)
+{
+    return value / divisor - ((value % divisor != 0 && (value < 0) != (divisor < 0)) ? 1 : 0);
+}
+
+}  // namespace KLineTime
+
+#endif  // KLINECOLUMNS_H
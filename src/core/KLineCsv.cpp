@@ -0,0 +1,218 @@
+#include "KLineCsv.h"
+
+#include <QFile>
+#include <QStringList>
+#include <limits>
+
+#include "KLineTrace.h"
+
+namespace {
+
+constexpr qint64 kReadChunkSize = 4 << 20;
+
+// CSV列在数据行中的位置，-1表示文件没有这一列
+struct CsvColumns
+{
+    int time = 0;
+    int open = 1;
+    int high = 2;
+    int low = 3;
+    int close = 4;
+    int volume = -1;
+    int turnover = -1;
+    int openInterest = -1;
+    int price = -1;  // 逐笔数据的成交价列，>=0表示这是逐笔文件，此时volume列为成交数量
+};
+
+// 按标题行识别列，成交量/成交额/持仓量是可选的；无法识别时退回到前5列为OHLC的旧格式。
+// 有成交价列而没有开盘价列时视为逐笔数据: 时间,价格,数量
+CsvColumns detectCsvColumns(QStringView header)
+{
+    static const struct
+    {
+        int CsvColumns::*column;
+        QStringList names;
+    } kColumnNames[] = {
+        {&CsvColumns::time, {"时间", "日期", "time", "datetime", "date"}},
+        {&CsvColumns::open, {"开盘", "开盘价", "open"}},
+        {&CsvColumns::high, {"最高", "最高价", "high"}},
+        {&CsvColumns::low, {"最低", "最低价", "low"}},
+        {&CsvColumns::close, {"收盘", "收盘价", "close"}},
+        {&CsvColumns::volume, {"成交量", "数量", "volume", "vol", "size", "qty"}},
+        {&CsvColumns::turnover, {"成交额", "turnover", "amount"}},
+        {&CsvColumns::openInterest, {"持仓量", "open_interest", "openinterest", "oi"}},
+        {&CsvColumns::price, {"价格", "成交价", "最新价", "price", "last"}},
+    };
+
+    CsvColumns columns;
+    CsvColumns detected;
+    detected.time = detected.open = detected.high = detected.low = detected.close = -1;
+
+    const QList<QStringView> names = header.split(u',');
+    for (int i = 0; i < names.size(); ++i) {
+        QString name = names[i].trimmed().toString().remove('"').toLower();
+        if (name.startsWith(QChar(0xFEFF))) name.remove(0, 1);  // UTF-8 BOM
+        for (const auto &entry : kColumnNames) {
+            if (entry.names.contains(name)) detected.*entry.column = i;
+        }
+    }
+
+    if (detected.time >= 0 && detected.open < 0 && detected.price >= 0) return detected;
+    detected.price = -1;
+
+    if (detected.time < 0 || detected.open < 0 || detected.high < 0 || detected.low < 0 ||
+        detected.close < 0) {
+        // 没有可识别的标题，按位置读取，第6~8列依次视为成交量/成交额/持仓量
+        columns.volume = 5;
+        columns.turnover = 6;
+        columns.openInterest = 7;
+        return columns;
+    }
+    return detected;
+}
+
+// 逐笔数据行: 时间,价格,数量；无效行跳过
+void parseTickLine(QStringView line, const CsvColumns &columns, KLineTicks &ticks)
+{
+    const QList<QStringView> values = line.trimmed().split(u',');
+    if (values.size() <= qMax(columns.time, columns.price)) return;
+
+    bool ok = false;
+    const qint64 time = KLineTime::parse(values[columns.time], &ok);
+    const double price = values[columns.price].trimmed().toDouble();
+    if (!ok || price <= 0) return;
+
+    const double size = (columns.volume >= 0 && columns.volume < values.size())
+                            ? values[columns.volume].trimmed().toDouble()
+                            : 0;
+    ticks.append(time, price, size);
+}
+
+void parseBarLine(QStringView line, const CsvColumns &columns, KLineColumns &bars)
+{
+    line = line.trimmed();
+    if (line.isEmpty()) return;
+
+    const int required = qMax(qMax(columns.time, columns.open),
+                              qMax(qMax(columns.high, columns.low), columns.close));
+    const QList<QStringView> values = line.split(u',');
+    if (values.size() <= required) return;
+
+    // 清理数据：去掉空白和引号；缺失的可选列视为0
+    auto field = [&values](int index) {
+        if (index < 0 || index >= values.size()) return QStringView();
+        QStringView value = values[index].trimmed();
+        if (value.startsWith(u'"')) value = value.mid(1);
+        if (value.endsWith(u'"')) value.chop(1);
+        return value;
+    };
+
+    bool ok = false;
+    const qint64 time = KLineTime::parse(field(columns.time), &ok);
+    if (!ok) return;
+
+    bars.append(time, field(columns.open).toDouble(), field(columns.high).toDouble(),
+                field(columns.low).toDouble(), field(columns.close).toDouble(),
+                field(columns.volume).toDouble(), field(columns.turnover).toDouble(),
+                field(columns.openInterest).toDouble());
+}
+
+// 解析一组数据行，行已不含标题
+void parseLines(const QList<QStringView> &lines, int from, const CsvColumns &columns,
+                KLineColumns &bars, KLineTicks &ticks)
+{
+    if (columns.price >= 0) {
+        for (int i = from; i < lines.size(); ++i) parseTickLine(lines[i], columns, ticks);
+    } else {
+        for (int i = from; i < lines.size(); ++i) parseBarLine(lines[i], columns, bars);
+    }
+}
+
+}  // namespace
+
+namespace KLineCsv {
+
+bool parse(const QString &content, KLineColumns &bars, KLineTicks &ticks)
+{
+    KLINE_TRACE_SCOPE("parse", "KLineCsv::parse");
+    bars.clear();
+    ticks.clear();
+
+    const QList<QStringView> lines = QStringView(content).split(u'\n', Qt::SkipEmptyParts);
+    if (lines.isEmpty()) return false;
+
+    const CsvColumns columns = detectCsvColumns(lines[0]);
+    if (columns.price >= 0) {
+        ticks.reserve(lines.size() - 1);
+    } else {
+        bars.reserve(lines.size() - 1);
+    }
+    // 跳过标题行
+    parseLines(lines, 1, columns, bars, ticks);
+    return true;
+}
+
+bool readFile(const QString &path, KLineColumns &bars, KLineTicks &ticks, QString *error,
+              const Progress &progress)
+{
+    KLINE_TRACE_SCOPE_DETAIL("io", "KLineCsv::readFile", path);
+    bars.clear();
+    ticks.clear();
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        if (error) *error = file.errorString();
+        return false;
+    }
+
+    // 按块读取并解析完整的行，不完整的末行留到下一块；内存峰值与块大小而非文件大小相关
+    const qint64 total = file.size();
+    qint64 done = 0;
+    bool hasHeader = false;
+    CsvColumns columns;
+    QByteArray pending;
+    while (true) {
+        const QByteArray chunk = file.read(kReadChunkSize);
+        const bool atEnd = chunk.isEmpty();
+        pending += chunk;
+        done += chunk.size();
+
+        const qsizetype end = atEnd ? pending.size() : pending.lastIndexOf('\n') + 1;
+        const QString text = QString::fromUtf8(pending.constData(), end);
+        pending.remove(0, end);
+
+        const QList<QStringView> lines = QStringView(text).split(u'\n', Qt::SkipEmptyParts);
+        int from = 0;
+        if (!hasHeader && !lines.isEmpty()) {
+            hasHeader = true;
+            columns = detectCsvColumns(lines[0]);
+            from = 1;
+            // 按第一块的平均行长估计总行数
+            const qint64 estimate = lines.size() * total / qMax<qint64>(1, end);
+            if (columns.price >= 0) {
+                ticks.reserve(int(qMin<qint64>(estimate, std::numeric_limits<int>::max())));
+            } else {
+                bars.reserve(int(qMin<qint64>(estimate, std::numeric_limits<int>::max())));
+            }
+        }
+        parseLines(lines, from, columns, bars, ticks);
+
+        if (progress && !progress(done, total)) {
+            if (error) *error = QStringLiteral("canceled");
+            return false;
+        }
+        if (atEnd) break;
+    }
+
+    if (file.error() != QFileDevice::NoError) {
+        if (error) *error = file.errorString();
+        return false;
+    }
+    if (!hasHeader) {
+        if (error) *error = QStringLiteral("empty file");
+        return false;
+    }
+    return true;
+}
+
+}  // namespace KLineCsv
@@ -0,0 +1,27 @@
+#ifndef KLINECSV_H
+#define KLINECSV_H
+
+#include <QString>
+#include <functional>
+
+#include "KLineColumns.h"
+#include "KLineTicks.h"
+
+// CSV数据源的解析，不依赖QObject，界面和导出工具共用
+namespace KLineCsv {
+
+// 解析CSV文本：K线文件写入bars，逐笔文件(有成交价列而没有开盘价列)写入ticks，
+// 另一个输出保持为空。内容为空时返回false
+bool parse(const QString &content, KLineColumns &bars, KLineTicks &ticks);
+
+// 逐块读取时的回调：done/total为已读取/文件总字节数，bars和ticks此时包含已解析的部分。
+// 返回false时中止读取
+using Progress = std::function<bool(qint64 done, qint64 total)>;
+
+// 按UTF-8逐块读取并解析，打开失败、读取出错或被progress中止时返回false并写入error
+bool readFile(const QString &path, KLineColumns &bars, KLineTicks &ticks,
+              QString *error = nullptr, const Progress &progress = Progress());
+
+}  // namespace KLineCsv
+
+#endif  // KLINECSV_H
@@ -5,158 +5,422 @@
 #include <QCoreApplication>
 #include <QDebug>
 #include <QDir>
+#include <QElapsedTimer>
 #include <QFile>
-#include <QMutexLocker>
+#include <QFileInfo>
 #include <QStandardPaths>
-#include <QTextStream>
+#include <algorithm>
+
+#include "KLineAggregator.h"
+#include "KLineBarBuilder.h"
+#include "KLineCsv.h"
+#include "KLineIndicators.h"
+#include "KLineMetrics.h"
+#include "KLineSnapshotCache.h"
+#include "KLineTrace.h"
+
+namespace {
+
+// 视口两侧各预取的K线数量；视口距窗口边缘不足其1/4时换入新窗口
+constexpr int kWindowPrefetch = 2048;
+// 读取大文件时两次预览之间的最小间隔
+constexpr qint64 kPreviewIntervalMs = 1000;
+// 合成循环每处理这么多根输入检查一次任务是否已被取代
+constexpr int kCancelCheckInterval = 1 << 16;
+
+// 单精度指标模式下为新生成的K线建立单精度镜像，之后的窗口切片和指标计算直接复用
+void prepareSingle(KLineColumns &bars)
+{
+    if (KLineIndicators::precision() == KLineIndicators::Float) bars.buildSingle();
+}
+
+bool anyNonZero(const QVector<double> &column)
+{
+    return std::any_of(column.cbegin(), column.cend(), [](double v) { return v != 0; });
+}
+
+KLineColumns barRange(const KLineColumns &bars, int from, int to)
+{
+    KLineColumns range;
+    range.appendRange(bars, from, to - from);
+    return range;
+}
+
+// 读取大文件时的增量预览
+//
+// 每次只合成上次预览之后新解析的分钟K线，缩略汇总按追加更新，累积型指标的状态随末尾窗口前移，
+// 单次预览的开销只与新增数据和窗口大小相关，与已读取的数据量无关。
+// update()返回的引用在下一次update()之前有效；调用方不保留它的副本，否则下次追加会复制整列
+class FilePreview
+{
+public:
+    FilePreview(const QString &targetPeriod, int periodMinutes, const TradingCalendar &calendar)
+        : m_raw(targetPeriod == "1m"),
+          m_barSpec(KLineBarBuilder::isBarSpec(targetPeriod)),
+          m_aggregator(m_barSpec ? -1 : periodMinutes, calendar),
+          m_builder(m_barSpec ? KLineBarBuilder::fromSpec(targetPeriod)
+                              : KLineBarBuilder(KLineBarBuilder::Invalid, 0))
+    {
+    }
+
+    bool isValid() const { return m_raw || m_aggregator.isValid() || m_builder.isValid(); }
+
+    // 推入bars中上次之后新增的分钟K线，返回目前已完成的周期K线
+    const KLineColumns &update(const KLineColumns &bars)
+    {
+        const int from = m_consumed;
+        m_consumed = bars.size();
+        if (m_raw) return bars;
+        if (m_barSpec) {
+            m_builder.push(KLineTicks::fromBars(barRange(bars, from, bars.size())));
+            return m_builder.result();
+        }
+        m_aggregator.push(bars, from, bars.size() - from);
+        return m_aggregator.result();
+    }
+
+    // 汇总追加result中新完成的K线，累积状态前移到result[first]之前；first不会后退
+    void advance(const KLineColumns &result, int first)
+    {
+        m_overview.append(barRange(result, int(m_overview.barCount()), result.size()));
+        KLineIndicators::accumulate(m_state, barRange(result, int(m_state.bars), first));
+    }
+
+    const KLineOverview &overview() const { return m_overview; }
+    const KLineIndicators::CumulativeState &state() const { return m_state; }
+
+private:
+    bool m_raw;
+    bool m_barSpec;
+    KLineAggregator m_aggregator;
+    KLineBarBuilder m_builder;
+    int m_consumed = 0;
+    KLineOverview m_overview;
+    KLineIndicators::CumulativeState m_state;
+};
+
+}  // namespace
 
 // KLineDataWorker 实现
-void KLineDataWorker::processData(const QVariantList &rawData, const QString &targetPeriod)
+void KLineDataWorker::setGeneration(int generation) { m_generation.storeRelease(generation); }
+
+bool KLineDataWorker::isCurrent(int generation) const
 {
-    qDebug() << "KLineDataWorker: 开始异步处理数据，数据量:" << rawData.size()
-             << "周期:" << targetPeriod;
+    return m_generation.loadAcquire() == generation;
+}
 
-    QVariantList result;
-    if (targetPeriod == "1m") {
-        result = rawData;
-    } else {
-        result = synthesizeKLineData(rawData, targetPeriod);
+bool KLineDataWorker::superseded(int generation) const
+{
+    return generation != kNoGeneration && !isCurrent(generation);
+}
+
+void KLineDataWorker::loadFile(int generation, const QString &path, const QString &targetPeriod)
+{
+    if (superseded(generation)) {
+        emit fileLoaded(generation, KLineColumns(), KLineTicks(), QStringLiteral("superseded"));
+        return;
     }
 
+    KLINE_TRACE_SCOPE_DETAIL("io", "KLineDataWorker::loadFile", path);
+    qDebug() << "KLineDataWorker: 开始读取文件:" << path;
+
+    KLineColumns bars;
+    KLineTicks ticks;
+    QString error;
+    // 预览只计算末尾窗口的指标，额外带上最长的预热
+    int warmup = 0;
+    for (const QString &name : m_indicators) {
+        warmup = qMax(warmup, KLineIndicators::lookback(name));
+        if (KLineIndicators::isCumulative(name)) {
+            warmup = qMax(warmup, KLineIndicators::kCumulativeWarmup);
+        }
+    }
+    FilePreview preview(targetPeriod, getPeriodMinutes(targetPeriod), m_calendar);
+    QElapsedTimer sincePreview;
+    sincePreview.start();
+    const bool ok =
+        KLineCsv::readFile(path, bars, ticks, &error, [&](qint64 done, qint64 total) {
+            if (superseded(generation)) return false;
+            emit fileProgress(generation, done, total);
+            // 逐笔文件不做预览，合成整个周期前先要有完整的分钟K线
+            if (done < total && !bars.isEmpty() && preview.isValid() &&
+                sincePreview.elapsed() >= kPreviewIntervalMs) {
+                sincePreview.restart();
+                const KLineColumns &result = preview.update(bars);
+                if (result.isEmpty()) return true;
+
+                const int windowFirst = qMax(0, result.size() - 2 * kWindowPrefetch);
+                const int first = qMax(0, windowFirst - warmup);
+                preview.advance(result, first);
+                KLineColumns segment = barRange(result, first, result.size());
+                prepareSingle(segment);
+                KLineSeriesMap series = computeIndicators(generation, segment);
+                KLineIndicators::rebase(series, segment, preview.state());
+
+                const int skip = windowFirst - first;
+                const int count = segment.size() - skip;
+                emit filePreview(generation, result.size(), result.time.first(), windowFirst,
+                                 barRange(segment, skip, segment.size()),
+                                 KLineIndicators::slice(series, skip, count), preview.overview());
+            }
+            return true;
+        });
+
+    if (!ok) {
+        qDebug() << "KLineDataWorker: 文件读取失败:" << path << error;
+        emit fileLoaded(generation, KLineColumns(), KLineTicks(), error);
+        return;
+    }
+    emit fileLoaded(generation, bars, ticks, QString());
+}
+
+void KLineDataWorker::processData(int generation, const KLineColumns &rawBars,
+                                  const QString &targetPeriod)
+{
+    if (superseded(generation)) {
+        emit dataProcessed(generation, KLineColumns(), KLineSeriesMap());
+        return;
+    }
+
+    KLINE_TRACE_SCOPE_DETAIL("aggregate", "KLineDataWorker::processData", targetPeriod);
+    qDebug() << "KLineDataWorker: 开始异步处理数据，数据量:" << rawBars.size()
+             << "周期:" << targetPeriod;
+
+    KLineColumns result = fromMinuteBars(generation, rawBars, targetPeriod);
+    prepareSingle(result);
     qDebug() << "KLineDataWorker: 异步处理完成，结果数量:" << result.size();
-    emit dataProcessed(result);
+    emit dataProcessed(generation, result, computeIndicators(generation, result));
 }
 
-QVariantList KLineDataWorker::synthesizeKLineData(const QVariantList &minuteData,
-                                                  const QString &targetPeriod)
+void KLineDataWorker::processTicks(int generation, const KLineTicks &ticks,
+                                   const QString &targetPeriod)
 {
-    QVariantList result;
+    if (superseded(generation)) {
+        emit dataProcessed(generation, KLineColumns(), KLineSeriesMap());
+        return;
+    }
+
+    KLINE_TRACE_SCOPE_DETAIL("aggregate", "KLineDataWorker::processTicks", targetPeriod);
+    qDebug() << "KLineDataWorker: 开始构建逐笔K线，成交笔数:" << ticks.count()
+             << "周期:" << targetPeriod;
 
-    if (minuteData.isEmpty()) {
-        return result;
+    KLineColumns result;
+    if (KLineBarBuilder::isBarSpec(targetPeriod)) {
+        result = buildBars(generation, ticks, KLineBarBuilder::fromSpec(targetPeriod));
+    } else {
+        // 时间周期先由逐笔生成分钟K线，再走与分钟数据源相同的按交易时段合成
+        result = buildBars(generation, ticks, KLineBarBuilder(KLineBarBuilder::TimeBars, 1));
+        if (targetPeriod != "1m") result = synthesizeKLineData(generation, result, targetPeriod);
     }
+    prepareSingle(result);
 
-    int periodMinutes = getPeriodMinutes(targetPeriod);
-    if (periodMinutes <= 0) {
-        qDebug() << "Invalid period:" << targetPeriod;
-        return result;
+    qDebug() << "KLineDataWorker: 异步处理完成，结果数量:" << result.size();
+    emit dataProcessed(generation, result, computeIndicators(generation, result));
+}
+
+void KLineDataWorker::processArchive(int generation, const KLineArchivePtr &archive,
+                                     const QString &targetPeriod)
+{
+    if (superseded(generation)) {
+        emit dataProcessed(generation, KLineColumns(), KLineSeriesMap());
+        return;
     }
 
-    QVariantList currentPeriodData;
-    QDateTime currentPeriodStart;
+    KLINE_TRACE_SCOPE_DETAIL("aggregate", "KLineDataWorker::processArchive", targetPeriod);
+    qDebug() << "KLineDataWorker: 开始流式合成归档，K线数量:" << archive->barCount()
+             << "周期:" << targetPeriod;
 
-    for (const QVariant &item : minuteData) {
-        QVariantList row = item.toList();
-        if (row.size() < 5) continue;
+    const bool barSpec = KLineBarBuilder::isBarSpec(targetPeriod);
+    KLineAggregator aggregator(barSpec ? -1 : getPeriodMinutes(targetPeriod), m_calendar);
+    KLineBarBuilder builder = barSpec ? KLineBarBuilder::fromSpec(targetPeriod)
+                                      : KLineBarBuilder(KLineBarBuilder::Invalid, 0);
+    if (!aggregator.isValid() && !builder.isValid()) {
+        qDebug() << "Invalid period:" << targetPeriod;
+        emit dataProcessed(generation, KLineColumns(), KLineSeriesMap());
+        return;
+    }
 
-        // 解析时间戳
-        QString timeStr = row[0].toString();
-        QDateTime dateTime = QDateTime::fromString(timeStr, "yyyy-MM-dd hh:mm:ss");
-        if (!dateTime.isValid()) {
-            // 尝试其他时间格式
-            dateTime = QDateTime::fromString(timeStr, "yyyy/MM/dd hh:mm:ss");
+    // 一次只解码一个Block，峰值内存与Block大小而非历史长度相关
+    KLineColumns block;
+    for (int i = 0; i < archive->blocks().size(); ++i) {
+        if (superseded(generation)) {
+            emit dataProcessed(generation, KLineColumns(), KLineSeriesMap());
+            return;
         }
-        if (!dateTime.isValid()) {
-            continue;
+        block.clear();
+        QString error;
+        if (!archive->readBlock(i, block, &error)) {
+            qDebug() << "KLineDataWorker: Block解码失败:" << error;
+            break;
         }
-
-        // 计算当前数据点应该属于哪个周期
-        QDateTime periodStart;
-        if (targetPeriod.endsWith("m")) {
-            // 分钟级别的周期
-            int minute = dateTime.time().minute();
-            int alignedMinute = (minute / periodMinutes) * periodMinutes;
-            periodStart = QDateTime(dateTime.date(), QTime(dateTime.time().hour(), alignedMinute));
-        } else if (targetPeriod.endsWith("h")) {
-            // 小时级别的周期
-            int periodHours = periodMinutes / 60;  // 转换为小时数
-            int hour = dateTime.time().hour();
-            int alignedHour = (hour / periodHours) * periodHours;
-            periodStart = QDateTime(dateTime.date(), QTime(alignedHour, 0));
-        } else if (targetPeriod == "1d") {
-            // 日级别的周期
-            periodStart = QDateTime(dateTime.date(), QTime(0, 0));
+        if (barSpec) {
+            builder.push(KLineTicks::fromBars(block));
+        } else {
+            aggregator.push(block);
         }
+    }
+    aggregator.finish();
+    builder.finish();
 
-        // 如果是新的周期，处理之前的数据
-        if (currentPeriodStart.isValid() && periodStart != currentPeriodStart) {
-            if (!currentPeriodData.isEmpty()) {
-                QVariantMap combinedData = combineKLineData(currentPeriodData);
-                if (!combinedData.isEmpty()) {
-                    QVariantList combinedRow;
-                    combinedRow << combinedData["time"].toString()
-                                << combinedData["open"].toDouble()
-                                << combinedData["high"].toDouble() << combinedData["low"].toDouble()
-                                << combinedData["close"].toDouble();
-                    result.append(QVariant::fromValue(combinedRow));
-                }
-            }
-            currentPeriodData.clear();
-        }
+    KLineColumns result = barSpec ? builder.takeResult() : aggregator.takeResult();
+    prepareSingle(result);
+    qDebug() << "KLineDataWorker: 异步处理完成，结果数量:" << result.size();
+    emit dataProcessed(generation, result, computeIndicators(generation, result));
+}
 
-        currentPeriodStart = periodStart;
-        currentPeriodData.append(item);
+void KLineDataWorker::loadWindow(const KLineArchivePtr &archive, qint64 firstBar, int count)
+{
+    KLINE_TRACE_SCOPE("io", "KLineDataWorker::loadWindow");
+    // 额外读取指标所需的前置K线，保证窗口首部的指标也是完整的
+    int warmup = 0;
+    bool cumulative = false;
+    for (const QString &name : m_indicators) {
+        warmup = qMax(warmup, KLineIndicators::lookback(name));
+        cumulative = cumulative || KLineIndicators::isCumulative(name);
+    }
+    const bool rebased = cumulative && m_cumulativeArchive.toStrongRef() == archive &&
+                         m_cumulativeStates.size() == archive->blocks().size();
+    if (rebased) warmup = qMax(warmup, KLineIndicators::kCumulativeWarmup);
+    qint64 warmupFirst = qMax<qint64>(0, firstBar - warmup);
+    // 累积型指标从Block起点开始计算，再按该Block之前的状态换算为全序列的值
+    const int block = rebased ? archive->blockForBar(warmupFirst) : -1;
+    if (block >= 0) warmupFirst = archive->blocks()[block].firstBar;
+    const int skip = int(firstBar - warmupFirst);
+
+    KLineColumns bars;
+    QString error;
+    if (!archive->readBars(warmupFirst, count + skip, bars, &error)) {
+        qDebug() << "KLineDataWorker: 窗口解码失败:" << error;
     }
 
-    // 处理最后一个周期的数据
-    if (!currentPeriodData.isEmpty()) {
-        QVariantMap combinedData = combineKLineData(currentPeriodData);
-        if (!combinedData.isEmpty()) {
-            QVariantList combinedRow;
-            combinedRow << combinedData["time"].toString() << combinedData["open"].toDouble()
-                        << combinedData["high"].toDouble() << combinedData["low"].toDouble()
-                        << combinedData["close"].toDouble();
-            result.append(QVariant::fromValue(combinedRow));
+    prepareSingle(bars);
+    KLineSeriesMap series = computeIndicators(kNoGeneration, bars);
+    if (block >= 0) {
+        KLineIndicators::rebase(series, bars, m_cumulativeStates[block]);
+    } else if (cumulative) {
+        for (const QString &name : m_indicators) {
+            if (KLineIndicators::isCumulative(name)) series.remove(name);
         }
     }
+    if (skip == 0 || bars.size() <= skip) {
+        emit windowLoaded(archive, warmupFirst, bars, series);
+        return;
+    }
 
-    return result;
+    KLineColumns window;
+    window.appendRange(bars, skip, bars.size() - skip);
+    emit windowLoaded(archive, firstBar, window,
+                      KLineIndicators::slice(series, skip, bars.size() - skip));
 }
 
-QVariantMap KLineDataWorker::combineKLineData(const QVariantList &dataPoints)
+void KLineDataWorker::buildOverview(int generation, const KLineArchivePtr &archive)
 {
-    QVariantMap result;
+    KLINE_TRACE_SCOPE("aggregate", "KLineDataWorker::buildOverview");
+    // 一次只解码一个Block，汇总按追加方式增量更新，内存与历史长度无关
+    KLineOverview overview;
+    QVector<KLineIndicators::CumulativeState> states;
+    states.reserve(archive->blocks().size());
+    KLineIndicators::CumulativeState state;
+    KLineColumns block;
+    for (int i = 0; i < archive->blocks().size(); ++i) {
+        if (superseded(generation)) {
+            emit overviewBuilt(generation, archive, KLineOverview());
+            return;
+        }
+        block.clear();
+        QString error;
+        if (!archive->readBlock(i, block, &error)) {
+            qDebug() << "KLineDataWorker: Block解码失败:" << error;
+            break;
+        }
+        overview.append(block);
+        states.append(state);
+        KLineIndicators::accumulate(state, block);
+    }
+
+    // 中途解码失败时状态不完整，窗口继续隐藏累积型指标
+    m_cumulativeArchive = archive;
+    m_cumulativeStates = states;
+    emit overviewBuilt(generation, archive, overview);
+}
 
-    if (dataPoints.isEmpty()) {
-        return result;
+KLineColumns KLineDataWorker::fromMinuteBars(int generation, const KLineColumns &rawBars,
+                                             const QString &targetPeriod)
+{
+    if (targetPeriod == "1m") return rawBars;
+    // 分钟K线数据源按收盘价和成交量近似为逐笔
+    if (KLineBarBuilder::isBarSpec(targetPeriod)) {
+        return buildBars(generation, KLineTicks::fromBars(rawBars),
+                         KLineBarBuilder::fromSpec(targetPeriod));
     }
+    return synthesizeKLineData(generation, rawBars, targetPeriod);
+}
 
-    double open = 0, high = 0, low = 0, close = 0;
-    QString timeStr;
-    bool first = true;
+KLineColumns KLineDataWorker::synthesizeKLineData(int generation, const KLineColumns &minuteData,
+                                                  const QString &targetPeriod)
+{
+    KLineAggregator aggregator(getPeriodMinutes(targetPeriod), m_calendar);
+    if (!aggregator.isValid()) {
+        qDebug() << "Invalid period:" << targetPeriod;
+        return KLineColumns();
+    }
 
-    for (const QVariant &item : dataPoints) {
-        QVariantList row = item.toList();
-        if (row.size() < 5) continue;
+    const int count = minuteData.size();
+    for (int from = 0; from < count; from += kCancelCheckInterval) {
+        if (superseded(generation)) return KLineColumns();
+        aggregator.push(minuteData, from, qMin(kCancelCheckInterval, count - from));
+    }
+    aggregator.finish();
+    return aggregator.takeResult();
+}
 
-        double currentOpen = row[1].toDouble();
-        double currentHigh = row[2].toDouble();
-        double currentLow = row[3].toDouble();
-        double currentClose = row[4].toDouble();
+KLineColumns KLineDataWorker::buildBars(int generation, const KLineTicks &ticks,
+                                        KLineBarBuilder builder)
+{
+    if (!builder.isValid()) return KLineColumns();
 
-        if (first) {
-            timeStr = row[0].toString();
-            open = currentOpen;
-            high = currentHigh;
-            low = currentLow;
-            close = currentClose;
-            first = false;
-        } else {
-            // 更新最高价和最低价
-            if (currentHigh > high) high = currentHigh;
-            if (currentLow < low) low = currentLow;
-            // 收盘价使用最后一个数据点的收盘价
-            close = currentClose;
-        }
+    const int count = ticks.count();
+    for (int from = 0; from < count; from += kCancelCheckInterval) {
+        if (superseded(generation)) return KLineColumns();
+        builder.push(ticks, from, qMin(kCancelCheckInterval, count - from));
     }
+    builder.finish();
+    return builder.takeResult();
+}
 
-    result["time"] = timeStr;
-    result["open"] = open;
-    result["high"] = high;
-    result["low"] = low;
-    result["close"] = close;
+KLineSeriesMap KLineDataWorker::computeIndicators(int generation, const KLineColumns &bars)
+{
+    // 使用TA-lib计算，直接读取K线的列；每个指标之间检查一次是否已被取代
+    KLineSeriesMap series;
+    for (const QString &name : m_indicators) {
+        if (superseded(generation)) return KLineSeriesMap();
+        KLineIndicators::compute(name, bars, series);
+    }
+    return series;
+}
 
-    return result;
+void KLineDataWorker::setIndicators(const QStringList &indicators)
+{
+    // MA总是计算，K线行数据里带着它
+    m_indicators = indicators;
+    if (!m_indicators.contains("MA")) m_indicators.prepend("MA");
+}
+
+void KLineDataWorker::writeSnapshot(const KLineColumns &bars, const QString &sourcePath)
+{
+    QString error;
+    if (!KLineSnapshotCache::write(sourcePath, bars, &error)) {
+        qDebug() << "KLineDataWorker: 快照写入失败:" << sourcePath << error;
+        return;
+    }
+    qDebug() << "KLineDataWorker: 已写入快照" << KLineSnapshotCache::snapshotPath(sourcePath);
+}
+
+void KLineDataWorker::setCalendar(const TradingCalendar &calendar)
+{
+    qDebug() << "KLineDataWorker: 交易日历切换为" << calendar.name() << "，每日交易分钟:"
+             << calendar.tradingMinutesPerDay();
+    m_calendar = calendar;
 }
 
 int KLineDataWorker::getPeriodMinutes(const QString &period)
@@ -174,16 +438,42 @@ int KLineDataWorker::getPeriodMinutes(const QString &period)
 
 // KLineDataProvider 实现
 KLineDataProvider::KLineDataProvider(QObject *parent)
-    : QObject(parent), m_klinePeriod("1m"), m_isLoading(false)
+    : QObject(parent), m_klinePeriod("1m"), m_sessionTemplate("24h"), m_isLoading(false)
 {
+    qRegisterMetaType<KLineColumns>();
+    qRegisterMetaType<KLineTicks>();
+    qRegisterMetaType<KLineArchivePtr>();
+    qRegisterMetaType<TradingCalendar>();
+    qRegisterMetaType<KLineSeriesMap>();
+    qRegisterMetaType<KLineOverview>();
+
     // 创建工作线程和worker
     m_workerThread = new QThread(this);
+    m_workerThread->setObjectName("KLineDataWorker");
     m_worker = new KLineDataWorker();
     m_worker->moveToThread(m_workerThread);
 
     // 连接信号和槽
+    connect(this, &KLineDataProvider::loadFileRequest, m_worker, &KLineDataWorker::loadFile);
     connect(this, &KLineDataProvider::processDataRequest, m_worker, &KLineDataWorker::processData);
+    connect(this, &KLineDataProvider::processArchiveRequest, m_worker,
+            &KLineDataWorker::processArchive);
+    connect(this, &KLineDataProvider::processTicksRequest, m_worker,
+            &KLineDataWorker::processTicks);
+    connect(this, &KLineDataProvider::loadWindowRequest, m_worker, &KLineDataWorker::loadWindow);
+    connect(this, &KLineDataProvider::overviewRequest, m_worker,
+            &KLineDataWorker::buildOverview);
+    connect(this, &KLineDataProvider::calendarRequest, m_worker, &KLineDataWorker::setCalendar);
+    connect(this, &KLineDataProvider::indicatorsRequest, m_worker,
+            &KLineDataWorker::setIndicators);
+    connect(this, &KLineDataProvider::writeSnapshotRequest, m_worker,
+            &KLineDataWorker::writeSnapshot);
+    connect(m_worker, &KLineDataWorker::fileProgress, this, &KLineDataProvider::onFileProgress);
+    connect(m_worker, &KLineDataWorker::filePreview, this, &KLineDataProvider::onFilePreview);
+    connect(m_worker, &KLineDataWorker::fileLoaded, this, &KLineDataProvider::onFileLoaded);
     connect(m_worker, &KLineDataWorker::dataProcessed, this, &KLineDataProvider::onDataProcessed);
+    connect(m_worker, &KLineDataWorker::windowLoaded, this, &KLineDataProvider::onWindowLoaded);
+    connect(m_worker, &KLineDataWorker::overviewBuilt, this, &KLineDataProvider::onOverviewBuilt);
 
     // 启动工作线程
     m_workerThread->start();
@@ -224,48 +514,421 @@ void KLineDataProvider::setKlinePeriod(const QString &klinePeriod)
         emit klinePeriodChanged();
 
         // 如果已有原始数据，启动异步处理
-        if (!m_rawData.isEmpty()) {
+        if (hasSource()) {
             startAsyncProcessing(m_klinePeriod);
         }
     }
 }
 
-QVariantList KLineDataProvider::data() const
+QVariantList KLineDataProvider::data() const { return snapshot()->rows; }
+
+bool KLineDataProvider::isLoading() const { return m_isLoading; }
+
+QString KLineDataProvider::loadStage() const { return m_loadStage; }
+
+double KLineDataProvider::loadProgress() const { return m_loadProgress; }
+
+void KLineDataProvider::setLoadProgress(const QString &stage, double progress)
 {
-    QMutexLocker locker(&m_dataMutex);
-    return m_data;
+    if (m_loadStage == stage && qFuzzyCompare(m_loadProgress + 1, progress + 1)) return;
+
+    m_loadStage = stage;
+    m_loadProgress = progress;
+    emit loadProgressChanged();
 }
 
-bool KLineDataProvider::isLoading() const { return m_isLoading; }
+int KLineDataProvider::totalCount() const { return int(m_totalCount); }
+
+int KLineDataProvider::windowOffset() const { return int(snapshot()->firstBar); }
+
+KLineWindowSnapshotPtr KLineDataProvider::snapshot() const { return std::atomic_load(&m_snapshot); }
+
+KLineColumns KLineDataProvider::windowBars() const { return snapshot()->bars; }
+
+QVector<double> KLineDataProvider::windowSeries(const QString &name) const
+{
+    return snapshot()->series.value(name);
+}
+
+KLineOverview KLineDataProvider::overview() const { return *std::atomic_load(&m_overview); }
+
+void KLineDataProvider::setOverview(const KLineOverview &overview)
+{
+    std::atomic_store(&m_overview, std::make_shared<const KLineOverview>(overview));
+    emit overviewChanged();
+}
+
+QStringList KLineDataProvider::indicators() const { return m_indicators; }
+
+void KLineDataProvider::setIndicators(const QStringList &indicators)
+{
+    if (m_indicators == indicators) return;
+
+    m_indicators = indicators;
+    emit indicatorsChanged();
+    // 与处理请求走同一个队列，之后的计算使用新的指标列表
+    emit indicatorsRequest(m_indicators);
+    if (hasSource()) startAsyncProcessing(m_klinePeriod);
+}
+
+QStringList KLineDataProvider::availableIndicators() const { return KLineIndicators::names(); }
+
+QString KLineDataProvider::firstTime() const
+{
+    return m_totalCount > 0 ? KLineTime::format(m_firstTime) : QString();
+}
+
+QString KLineDataProvider::lastTime() const
+{
+    return m_totalCount > 0 ? KLineTime::format(m_lastTime) : QString();
+}
+
+QString KLineDataProvider::sessionTemplate() const { return m_sessionTemplate; }
+
+void KLineDataProvider::setSessionTemplate(const QString &sessionTemplate)
+{
+    if (m_sessionTemplate != sessionTemplate) {
+        m_sessionTemplate = sessionTemplate;
+        emit sessionTemplateChanged();
+        applyCalendar();
+    }
+}
+
+QString KLineDataProvider::dataTimeZone() const { return m_dataTimeZone; }
+
+void KLineDataProvider::setDataTimeZone(const QString &dataTimeZone)
+{
+    if (m_dataTimeZone != dataTimeZone) {
+        m_dataTimeZone = dataTimeZone;
+        emit dataTimeZoneChanged();
+        applyCalendar();
+    }
+}
+
+QString KLineDataProvider::holidayFile() const { return m_holidayFile; }
+
+void KLineDataProvider::setHolidayFile(const QString &holidayFile)
+{
+    if (m_holidayFile != holidayFile) {
+        m_holidayFile = holidayFile;
+        emit holidayFileChanged();
+        applyCalendar();
+    }
+}
+
+QStringList KLineDataProvider::sessionTemplates() const { return TradingCalendar::templateNames(); }
+
+void KLineDataProvider::applyCalendar()
+{
+    TradingCalendar calendar = TradingCalendar::fromTemplate(m_sessionTemplate);
+    if (!m_dataTimeZone.isEmpty()) {
+        const QTimeZone zone(m_dataTimeZone.toUtf8());
+        if (zone.isValid()) {
+            calendar.setDataTimeZone(zone);
+        } else {
+            qDebug() << "KLineDataProvider: 无效的时区:" << m_dataTimeZone;
+        }
+    }
+    if (!m_holidayFile.isEmpty()) calendar.loadHolidays(m_holidayFile);
+
+    // 与处理请求走同一个队列，保证之后的合成使用新日历
+    emit calendarRequest(calendar);
+
+    // 原始周期不受交易时段影响
+    if (hasSource() && m_klinePeriod != "1m") {
+        startAsyncProcessing(m_klinePeriod);
+    }
+}
+
+bool KLineDataProvider::hasSource() const
+{
+    return !m_rawBars.isEmpty() || !m_ticks.isEmpty() || m_archive;
+}
+
+bool KLineDataProvider::isArchiveWindowed() const { return m_archive && m_klinePeriod == "1m"; }
+
+void KLineDataProvider::setExtents(qint64 totalCount, qint64 firstTime, qint64 lastTime)
+{
+    m_totalCount = totalCount;
+    m_firstTime = firstTime;
+    m_lastTime = lastTime;
+    emit extentsChanged();
+}
+
+void KLineDataProvider::setHasVolume(bool hasVolume)
+{
+    if (m_hasVolume == hasVolume) return;
+    m_hasVolume = hasVolume;
+    emit hasVolumeChanged();
+}
 
 void KLineDataProvider::startAsyncProcessing(const QString &targetPeriod)
 {
-    if (m_isLoading) {
-        qDebug() << "KLineDataProvider: 已经在处理中，忽略新请求";
+    // 新请求取代所有在途的读取和合成，界面连续切换时只有最后一次的结果会被发布
+    m_fileLoading = false;
+    nextGeneration();
+    if (!m_isLoading) {
+        m_isLoading = true;
+        emit isLoadingChanged();
+    }
+    dispatchProcessing(targetPeriod);
+}
+
+int KLineDataProvider::nextGeneration()
+{
+    m_worker->setGeneration(++m_generation);
+    return m_generation;
+}
+
+void KLineDataProvider::dispatchProcessing(const QString &targetPeriod)
+{
+    setLoadProgress("合成", 0);
+    if (isArchiveWindowed()) {
+        // 原始周期直接按索引分页：总数和时间范围来自索引，只解码末尾一个窗口
+        m_bars.clear();
+        m_series.clear();
+        setExtents(m_archive->barCount(), m_archive->firstTime(), m_archive->lastTime());
+
+        const qint64 first = qMax<qint64>(0, m_totalCount - 2 * kWindowPrefetch);
+        m_windowPending = false;
+        m_queuedWindowFirst = -1;
+        qDebug() << "KLineDataProvider: 归档分页加载，总K线数:" << m_totalCount;
+        requestWindow(first, int(m_totalCount - first));
+        // 缩略汇总需要解码全部Block，排在首个窗口之后
+        setOverview(KLineOverview());
+        updateWorkerQueue(1);
+        emit overviewRequest(m_generation, m_archive);
         return;
     }
 
-    m_isLoading = true;
-    emit isLoadingChanged();
+    if (m_archive) {
+        qDebug() << "KLineDataProvider: 启动归档流式合成，周期:" << targetPeriod;
+        updateWorkerQueue(1);
+        emit processArchiveRequest(m_generation, m_archive, targetPeriod);
+        return;
+    }
+
+    if (!m_ticks.isEmpty()) {
+        qDebug() << "KLineDataProvider: 启动逐笔K线构建，成交笔数:" << m_ticks.count()
+                 << "周期:" << targetPeriod;
+        updateWorkerQueue(1);
+        emit processTicksRequest(m_generation, m_ticks, targetPeriod);
+        return;
+    }
 
-    qDebug() << "KLineDataProvider: 启动异步处理，数据量:" << m_rawData.size()
+    qDebug() << "KLineDataProvider: 启动异步处理，数据量:" << m_rawBars.size()
              << "周期:" << targetPeriod;
-    emit processDataRequest(m_rawData, targetPeriod);
+    updateWorkerQueue(1);
+    emit processDataRequest(m_generation, m_rawBars, targetPeriod);
 }
 
-void KLineDataProvider::onDataProcessed(const QVariantList &processedData)
+void KLineDataProvider::onFileProgress(int generation, qint64 done, qint64 total)
 {
-    {
-        QMutexLocker locker(&m_dataMutex);
-        m_data = processedData;
+    if (generation != m_generation || !m_fileLoading) return;
+    setLoadProgress("读取", total > 0 ? double(done) / total : 0);
+}
+
+void KLineDataProvider::onFilePreview(int generation, qint64 totalCount, qint64 firstTime,
+                                      qint64 firstBar, const KLineColumns &bars,
+                                      const KLineSeriesMap &series, const KLineOverview &overview)
+{
+    if (generation != m_generation || !m_fileLoading || bars.isEmpty()) return;
+    // 预览只发布末尾窗口和汇总，m_bars要等最终结果才替换；不发dataLoaded，视口不重置。
+    // 读完前成交量副图只会出现不会消失，读完后按整个文件确定
+    setExtents(totalCount, firstTime, bars.time.last());
+    if (!m_hasVolume && anyNonZero(bars.volume)) setHasVolume(true);
+    publishWindow(firstBar, bars, series, 0, bars.size());
+    setOverview(overview);
+    emit dataChanged();
+    emit previewLoaded();
+}
+
+void KLineDataProvider::onFileLoaded(int generation, const KLineColumns &bars,
+                                     const KLineTicks &ticks, const QString &error)
+{
+    updateWorkerQueue(-1);
+    // 已取消或被更新的任务取代
+    if (generation != m_generation || !m_fileLoading) return;
+
+    m_fileLoading = false;
+    if (!error.isEmpty()) {
+        qDebug() << "KLineDataProvider: Failed to load file:" << m_loadingPath << error;
+        m_isLoading = false;
+        emit isLoadingChanged();
+        setLoadProgress(QString(), 0);
+        return;
     }
 
+    m_rawBars = bars;
+    m_ticks = ticks;
+    setHasVolume(anyNonZero(m_rawBars.volume) || anyNonZero(m_ticks.size));
+    if (!m_ticks.isEmpty()) {
+        qDebug() << "KLineDataProvider: Parsed" << m_ticks.count() << "ticks";
+    } else {
+        qDebug() << "KLineDataProvider: Parsed" << m_rawBars.size() << "raw data rows";
+    }
+
+    // 沿用本次加载的代号直接合成当前周期；写快照在worker上排在合成之后，不推迟首次显示
+    dispatchProcessing(m_klinePeriod);
+    if (!m_rawBars.isEmpty()) emit writeSnapshotRequest(m_rawBars, m_loadingPath);
+}
+
+void KLineDataProvider::onDataProcessed(int generation, const KLineColumns &bars,
+                                        const KLineSeriesMap &series)
+{
+    KLINE_TRACE_SCOPE("model", "KLineDataProvider::onDataProcessed");
+    updateWorkerQueue(-1);
+    // 已被更新的请求取代（或已取消），结果作废
+    if (generation != m_generation) return;
+    applyProcessed(bars, series);
+
     m_isLoading = false;
     emit isLoadingChanged();
-    emit dataChanged();
+    setLoadProgress(QString(), 0);
     emit dataLoaded();
+    saveSession();
 
-    qDebug() << "KLineDataProvider: 异步处理完成，最终数据量:" << processedData.size();
+    qDebug() << "KLineDataProvider: 异步处理完成，最终数据量:" << bars.size();
+}
+
+void KLineDataProvider::applyProcessed(const KLineColumns &bars, const KLineSeriesMap &series)
+{
+    m_bars = bars;
+    m_series = series;
+    setExtents(bars.size(), bars.isEmpty() ? 0 : bars.time.first(),
+               bars.isEmpty() ? 0 : bars.time.last());
+
+    // 初始窗口停在最新数据处
+    const int first = qMax(0, bars.size() - 2 * kWindowPrefetch);
+    publishWindow(first, m_bars, m_series, first, bars.size() - first);
+    KLineOverview overview;
+    overview.append(m_bars);
+    setOverview(overview);
+    emit dataChanged();
+}
+
+void KLineDataProvider::onWindowLoaded(const KLineArchivePtr &archive, qint64 firstBar,
+                                       const KLineColumns &bars, const KLineSeriesMap &series)
+{
+    updateWorkerQueue(-1);
+    m_windowPending = false;
+    // 数据源或周期已切换，丢弃过期窗口
+    if (archive != m_archive || !isArchiveWindowed()) return;
+
+    publishWindow(firstBar, bars, series, 0, bars.size());
+    emit dataChanged();
+
+    if (m_isLoading) {
+        m_isLoading = false;
+        emit isLoadingChanged();
+        setLoadProgress(QString(), 0);
+        emit dataLoaded();
+        saveSession();
+    } else {
+        emit windowChanged();
+    }
+
+    if (m_queuedWindowFirst >= 0) {
+        const qint64 first = m_queuedWindowFirst;
+        m_queuedWindowFirst = -1;
+        requestWindow(first, m_queuedWindowCount);
+    }
+}
+
+void KLineDataProvider::onOverviewBuilt(int generation, const KLineArchivePtr &archive,
+                                        const KLineOverview &overview)
+{
+    updateWorkerQueue(-1);
+    // 数据源或周期已切换，丢弃过期汇总
+    if (generation != m_generation || archive != m_archive || !isArchiveWindowed()) return;
+
+    setOverview(overview);
+
+    // 累积型指标的分段状态与汇总一起就绪，重新加载当前窗口补上OBV/AD/ADOSC
+    const bool cumulative = std::any_of(m_indicators.cbegin(), m_indicators.cend(),
+                                        &KLineIndicators::isCumulative);
+    const KLineWindowSnapshotPtr window = snapshot();
+    if (cumulative && !window->bars.isEmpty()) {
+        requestWindow(window->firstBar, window->bars.size());
+    }
+}
+
+void KLineDataProvider::publishWindow(qint64 firstBar, const KLineColumns &bars,
+                                      const KLineSeriesMap &series, int from, int count)
+{
+    KLINE_TRACE_SCOPE("model", "KLineDataProvider::publishWindow");
+    // 新数据到达屏幕的延迟从这里开始计时，在下一次帧交换时结束
+    KLineMetrics::tickProbe().mark();
+    KLineMetrics::markFirstData();
+    const QVector<double> ma = series.value("MA");
+    QVariantList rows;
+    rows.reserve(count);
+    // 行格式: [时间, 开, 高, 低, 收, 成交量, 成交额, 持仓量, MA]，MA不足周期时为null
+    for (int i = from; i < from + count; ++i) {
+        QVariantList row;
+        row << KLineTime::format(bars.time[i]) << bars.open[i] << bars.high[i] << bars.low[i]
+            << bars.close[i] << bars.volume[i] << bars.turnover[i] << bars.openInterest[i];
+        row << ((i < ma.size() && !qIsNaN(ma[i])) ? QVariant(ma[i]) : QVariant());
+        rows.append(QVariant::fromValue(row));
+    }
+
+    // 新快照完整构造后才替换指针，读取方看到的要么是旧窗口要么是新窗口
+    auto next = std::make_shared<KLineWindowSnapshot>();
+    next->version = snapshot()->version + 1;
+    next->firstBar = firstBar;
+    next->rows = rows;
+    next->bars.appendRange(bars, from, count);
+    next->series = KLineIndicators::slice(series, from, count);
+    std::atomic_store(&m_snapshot, KLineWindowSnapshotPtr(std::move(next)));
+}
+
+void KLineDataProvider::ensureWindow(int startIndex, int visibleCount)
+{
+    if (m_totalCount == 0 || m_isLoading) return;
+
+    const qint64 start = qBound<qint64>(0, startIndex, m_totalCount - 1);
+    const qint64 end = qMin<qint64>(m_totalCount, start + qMax(1, visibleCount));
+    const KLineWindowSnapshotPtr window = snapshot();
+    const qint64 loadedEnd = window->firstBar + window->bars.size();
+    const qint64 edge = kWindowPrefetch / 4;
+
+    const bool nearLeft = window->firstBar > 0 && start - window->firstBar < edge;
+    const bool nearRight = loadedEnd < m_totalCount && loadedEnd - end < edge;
+    if (!nearLeft && !nearRight) return;
+
+    const qint64 first = qMax<qint64>(0, start - kWindowPrefetch);
+    const qint64 last = qMin<qint64>(m_totalCount, end + kWindowPrefetch);
+
+    if (isArchiveWindowed()) {
+        requestWindow(first, int(last - first));
+        return;
+    }
+
+    // 内存模式下窗口只是切片，同步完成
+    publishWindow(first, m_bars, m_series, int(first), int(last - first));
+    emit dataChanged();
+    emit windowChanged();
+}
+
+void KLineDataProvider::updateWorkerQueue(int delta)
+{
+    // 请求和完成信号都在GUI线程上处理，计数不需要同步
+    m_workerQueueDepth = qMax(0, m_workerQueueDepth + delta);
+    KLineMetrics::setGauge("worker.queue_depth", m_workerQueueDepth);
+}
+
+void KLineDataProvider::requestWindow(qint64 firstBar, int count)
+{
+    // 同一时间只有一个窗口请求在途，拖动过程中的后续请求只保留最新的一个
+    if (m_windowPending) {
+        m_queuedWindowFirst = firstBar;
+        m_queuedWindowCount = count;
+        return;
+    }
+
+    m_windowPending = true;
+    updateWorkerQueue(1);
+    emit loadWindowRequest(m_archive, firstBar, count);
 }
 
 void KLineDataProvider::loadData()
@@ -289,95 +952,131 @@ void KLineDataProvider::loadData()
 
     qDebug() << "KLineDataProvider: Trying to load file:" << filePath;
 
-    QFile file(filePath);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        qDebug() << "KLineDataProvider: Failed to open file:" << filePath;
-        qDebug() << "KLineDataProvider: Error:" << file.errorString();
+    // 上一个文件的读取或合成直接作废，不等它完成
+    cancelLoad();
+
+    // 压缩归档只读取头部和索引，K线按需解码
+    if (filePath.endsWith(".kla", Qt::CaseInsensitive)) {
+        loadArchive(filePath);
         return;
     }
 
-    QTextStream in(&file);
-    in.setEncoding(QStringConverter::Utf8);
-    QString content = in.readAll();
-    file.close();
+    // 上次解析过的CSV直接加载快照，跳过读取和解析
+    if (KLineSnapshotCache::hasSnapshot(filePath)) {
+        qDebug() << "KLineDataProvider: Using snapshot for" << filePath;
+        if (loadArchive(KLineSnapshotCache::snapshotPath(filePath))) return;
+    }
 
-    qDebug() << "KLineDataProvider: File loaded successfully, size:" << content.length();
+    // 读取和解析都在worker上进行，界面线程只接收进度、预览和结果
+    m_archive.reset();
+    m_rawBars.clear();
+    m_ticks.clear();
+    m_fileLoading = true;
+    m_loadingPath = filePath;
+    m_isLoading = true;
+    emit isLoadingChanged();
+    setLoadProgress("读取", 0);
 
-    parseCSV(content);
+    updateWorkerQueue(1);
+    emit loadFileRequest(nextGeneration(), filePath, m_klinePeriod);
 }
 
-void KLineDataProvider::parseCSV(const QString &content)
+void KLineDataProvider::cancelLoad()
 {
-    m_rawData.clear();
-    m_data.clear();
+    if (!m_isLoading) return;
 
-    QStringList lines = content.split('\n', Qt::SkipEmptyParts);
-    if (lines.isEmpty()) {
-        qDebug() << "KLineDataProvider: CSV file is empty";
-        return;
+    qDebug() << "KLineDataProvider: 取消加载，阶段:" << m_loadStage;
+    // 代号作废后worker在下一个检查点中止，随后到达的进度、预览和结果都会被丢弃
+    nextGeneration();
+    m_fileLoading = false;
+    m_isLoading = false;
+    emit isLoadingChanged();
+    setLoadProgress(QString(), 0);
+}
+
+bool KLineDataProvider::loadArchive(const QString &filePath)
+{
+    m_rawBars.clear();
+    m_ticks.clear();
+
+    auto reader = QSharedPointer<KLineArchiveReader>::create();
+    KLINE_TRACE_SCOPE_DETAIL("io", "KLineArchiveReader::open", filePath);
+    if (!reader->open(filePath)) {
+        qDebug() << "KLineDataProvider: Failed to open archive:" << filePath
+                 << reader->errorString();
+        return false;
     }
 
-    // 跳过标题行
-    for (int i = 1; i < lines.size(); ++i) {
-        QString line = lines[i].trimmed();
-        if (line.isEmpty()) continue;
+    qDebug() << "KLineDataProvider: Archive opened," << reader->barCount() << "bars in"
+             << reader->blocks().size() << "blocks";
 
-        QStringList values = line.split(',');
-        if (values.size() >= 5) {
-            QVariantList row;
-            // 清理数据并添加到行中
-            for (const QString &value : values) {
-                row.append(value.trimmed().remove('"'));
-            }
-            m_rawData.append(QVariant::fromValue(row));
-        }
-    }
+    m_archive = reader;
+    setHasVolume(reader->columnFlags() & KLineArchiveFormat::HasVolume);
+    startAsyncProcessing(m_klinePeriod);
+    return true;
+}
 
-    // 使用TA-lib计算MA(移动平均线)
-    if (m_rawData.size() > 0) {
-        // 准备输入数据
-        const int dataSize = m_rawData.size();
-        double *closePrice = new double[dataSize];
+void KLineDataProvider::saveSession()
+{
+    // QSettings同步写INI文件，换指标、换时段等重新合成时文件和周期不变，不必再写
+    if (m_csvFile == m_savedFile && m_klinePeriod == m_savedPeriod) return;
 
-        // 从m_rawData中提取收盘价(假设收盘价在每行的第4个位置)
-        for (int i = 0; i < dataSize; i++) {
-            QVariantList row = m_rawData[i].toList();
-            if (row.size() >= 5) {
-                closePrice[i] = row[4].toDouble();  // 通常第5列是收盘价
-            }
-        }
+    m_savedFile = m_csvFile;
+    m_savedPeriod = m_klinePeriod;
+    KLineSnapshotCache::setLastSession(m_csvFile, m_klinePeriod);
+}
 
-        // 计算MA的参数
-        const int maPeriod = 5;  // 设置MA周期为5
-        int outBegIdx, outNbElement;
-        double *outMA = new double[dataSize];
-
-        // 调用TA-Lib MA函数计算简单移动平均线
-        TA_RetCode retCode = TA_MA(0, dataSize - 1, closePrice, maPeriod, TA_MAType_SMA, &outBegIdx,
-                                   &outNbElement, outMA);
-
-        if (retCode == TA_SUCCESS) {
-            qDebug() << "计算MA成功: 开始索引=" << outBegIdx << ", 结果元素数量=" << outNbElement;
-
-            // 将MA值添加到每个数据点中
-            for (int i = 0; i < outNbElement; i++) {
-                int dataIndex = i + outBegIdx;
-                QVariantList row = m_rawData[dataIndex].toList();
-                // 添加MA值作为额外字段
-                row.append(outMA[i]);
-                m_rawData[dataIndex] = QVariant::fromValue(row);
-            }
-        } else {
-            qDebug() << "TA-Lib MA计算失败，错误码:" << retCode;
+QVariantMap KLineDataProvider::lastSession() const
+{
+    QVariantMap session;
+    const QString file = KLineSnapshotCache::lastFile();
+    if (file.isEmpty()) return session;
+
+    const QString appDir = QCoreApplication::applicationDirPath();
+    if (!QFile::exists(file) && !QFile::exists(QDir(appDir).absoluteFilePath(file))) {
+        return session;
+    }
+    session["file"] = file;
+    session["period"] = KLineSnapshotCache::lastPeriod();
+    return session;
+}
+
+bool KLineDataProvider::exportArchive(const QString &archivePath)
+{
+    // 归档数据源（包括从快照加载的CSV）已经是无损编码，直接复制文件
+    if (m_archive) {
+        if (QFileInfo(m_archive->path()) == QFileInfo(archivePath)) return true;
+        QFile::remove(archivePath);
+        if (!QFile::copy(m_archive->path(), archivePath)) {
+            qDebug() << "KLineDataProvider: 归档复制失败:" << m_archive->path() << "->"
+                     << archivePath;
+            return false;
         }
+        qDebug() << "KLineDataProvider: 已导出" << m_archive->barCount() << "根K线到"
+                 << archivePath;
+        return true;
+    }
 
-        // 释放内存
-        delete[] closePrice;
-        delete[] outMA;
+    // 逐笔数据源导出由逐笔生成的分钟K线
+    KLineColumns bars = m_rawBars;
+    if (bars.isEmpty() && !m_ticks.isEmpty()) {
+        KLineBarBuilder builder(KLineBarBuilder::TimeBars, 1);
+        builder.push(m_ticks);
+        builder.finish();
+        bars = builder.takeResult();
+    }
+    if (bars.isEmpty()) {
+        qDebug() << "KLineDataProvider: 没有可导出的数据";
+        return false;
     }
 
-    qDebug() << "KLineDataProvider: Parsed" << m_rawData.size() << "raw data rows";
+    // 与快照相同，价格位数按数据确定，不能原样保存时拒绝导出而不是四舍五入
+    QString error;
+    if (!KLineArchiveWriter::writeLossless(archivePath, bars, &error)) {
+        qDebug() << "KLineDataProvider: 归档写入失败:" << archivePath << error;
+        return false;
+    }
 
-    // 启动异步处理来合成当前周期的数据
-    startAsyncProcessing(m_klinePeriod);
-}
\ No newline at end of file
+    qDebug() << "KLineDataProvider: 已导出" << bars.size() << "根K线到" << archivePath;
+    return true;
+}
@@ -1,29 +1,115 @@
 #ifndef KLINEDATAPROVIDER_H
 #define KLINEDATAPROVIDER_H
 
-#include <QMutex>
+#include <QAtomicInt>
 #include <QObject>
+#include <QSharedPointer>
 #include <QString>
 #include <QThread>
 #include <QVariantList>
+#include <QVariantMap>
+#include <memory>
+
+#include "KLineArchive.h"
+#include "KLineBarBuilder.h"
+#include "KLineColumns.h"
+#include "KLineIndicators.h"
+#include "KLineOverview.h"
+#include "KLineTicks.h"
+#include "TradingCalendar.h"
+
+using KLineArchivePtr = QSharedPointer<const KLineArchiveReader>;
+Q_DECLARE_METATYPE(KLineArchivePtr)
 
 // 异步数据处理Worker
+//
+// 读取、合成和汇总任务都带有发起时的代号(generation)。提供器每次发起新任务时先递增代号，
+// 旧任务在合成、解码和指标循环的检查点发现自己已被取代后放弃剩余工作，仍在队列中的旧任务
+// 开始时直接跳过，因此连续切换周期时只有最后一次真正计算。被放弃的任务照常发出结果信号
+// （内容为空），由提供器按代号丢弃
 class KLineDataWorker : public QObject
 {
     Q_OBJECT
 
+public:
+    // 不会被取代的任务，供窗口换页和同步调用worker的导出、基准工具使用
+    static constexpr int kNoGeneration = -1;
+
+    // 可从任何线程调用
+    void setGeneration(int generation);
+    bool isCurrent(int generation) const;
+
 public slots:
-    void processData(const QVariantList &rawData, const QString &targetPeriod);
+    // CSV数据源：逐块读取和解析文件并报告进度，大文件定期把新解析的部分增量合成为targetPeriod
+    // 并发出末尾窗口的预览。结果（或失败原因）总是通过fileLoaded返回
+    void loadFile(int generation, const QString &path, const QString &targetPeriod);
+    // 内存数据源：合成整个周期序列
+    void processData(int generation, const KLineColumns &rawBars, const QString &targetPeriod);
+    // 归档数据源：逐Block解码并流式合成，内存只与输出周期的K线数量相关
+    void processArchive(int generation, const KLineArchivePtr &archive,
+                        const QString &targetPeriod);
+    // 逐笔数据源：时间周期先生成分钟K线再合成，"tick:100"等非时间K线直接由逐笔构建
+    void processTicks(int generation, const KLineTicks &ticks, const QString &targetPeriod);
+    // 归档数据源的原始周期：只解码[firstBar, firstBar + count)窗口
+    void loadWindow(const KLineArchivePtr &archive, qint64 firstBar, int count);
+    // 归档数据源的原始周期：逐Block解码一遍生成整个历史的缩略汇总和累积型指标的分段状态
+    void buildOverview(int generation, const KLineArchivePtr &archive);
+    // CSV数据源的分钟K线写成二进制快照，下次启动直接加载
+    void writeSnapshot(const KLineColumns &bars, const QString &sourcePath);
+    void setCalendar(const TradingCalendar &calendar);
+    void setIndicators(const QStringList &indicators);
 
 signals:
-    void dataProcessed(const QVariantList &processedData);
+    void fileProgress(int generation, qint64 done, qint64 total);
+    // 预览：已解析部分按周期合成后共totalCount根，只带[firstBar, firstBar + bars.size())
+    // 末尾窗口的K线和指标，以及增量更新的整体汇总
+    void filePreview(int generation, qint64 totalCount, qint64 firstTime, qint64 firstBar,
+                     const KLineColumns &bars, const KLineSeriesMap &series,
+                     const KLineOverview &overview);
+    void fileLoaded(int generation, const KLineColumns &bars, const KLineTicks &ticks,
+                    const QString &error);
+    void dataProcessed(int generation, const KLineColumns &bars, const KLineSeriesMap &series);
+    void windowLoaded(const KLineArchivePtr &archive, qint64 firstBar, const KLineColumns &bars,
+                      const KLineSeriesMap &series);
+    void overviewBuilt(int generation, const KLineArchivePtr &archive,
+                       const KLineOverview &overview);
 
 private:
-    QVariantList synthesizeKLineData(const QVariantList &minuteData, const QString &targetPeriod);
-    QVariantMap combineKLineData(const QVariantList &dataPoints);
+    bool superseded(int generation) const;
+    // 以下合成函数在被取代时提前返回空结果
+    KLineColumns fromMinuteBars(int generation, const KLineColumns &rawBars,
+                                const QString &targetPeriod);
+    KLineColumns synthesizeKLineData(int generation, const KLineColumns &minuteData,
+                                     const QString &targetPeriod);
+    KLineColumns buildBars(int generation, const KLineTicks &ticks, KLineBarBuilder builder);
+    KLineSeriesMap computeIndicators(int generation, const KLineColumns &bars);
     int getPeriodMinutes(const QString &period);
+
+    TradingCalendar m_calendar;
+    QStringList m_indicators = {"MA"};
+    QAtomicInt m_generation;
+
+    // 归档每个Block之前的累积型指标状态，buildOverview遍历全部Block时顺带计算。
+    // 就绪前窗口不输出OBV/AD/ADOSC，避免显示相对窗口起点的数值
+    QWeakPointer<const KLineArchiveReader> m_cumulativeArchive;
+    QVector<KLineIndicators::CumulativeState> m_cumulativeStates;
 };
 
+// 已发布的窗口，发布后不再修改
+//
+// 提供器每次换入窗口时构造新的快照并原子地替换指针，读取方持有shared_ptr期间快照一直有效，
+// 在任何线程上不加锁即可读到彼此一致的行数据、K线列和指标。列数据是隐式共享的，
+// 取出bars或series只增加引用计数，不拷贝数据
+struct KLineWindowSnapshot
+{
+    quint64 version = 0;  // 每次发布递增，读取方可据此判断数据是否变化
+    qint64 firstBar = 0;  // bars[0]在完整序列中的序号
+    QVariantList rows;    // 交给QML的行数据
+    KLineColumns bars;
+    KLineSeriesMap series;  // 与bars对齐的指标
+};
+using KLineWindowSnapshotPtr = std::shared_ptr<const KLineWindowSnapshot>;
+
 class KLineDataProvider : public QObject
 {
     Q_OBJECT
@@ -31,6 +117,25 @@ class KLineDataProvider : public QObject
     Q_PROPERTY(QString klinePeriod READ klinePeriod WRITE setKlinePeriod NOTIFY klinePeriodChanged)
     Q_PROPERTY(QVariantList data READ data NOTIFY dataChanged)
     Q_PROPERTY(bool isLoading READ isLoading NOTIFY isLoadingChanged)
+    // 当前加载阶段（"读取"、"合成"，空表示空闲）和读取阶段的进度(0~1)
+    Q_PROPERTY(QString loadStage READ loadStage NOTIFY loadProgressChanged)
+    Q_PROPERTY(double loadProgress READ loadProgress NOTIFY loadProgressChanged)
+    // data只包含[windowOffset, windowOffset + data.length)这一段，总数和时间范围来自索引
+    Q_PROPERTY(int totalCount READ totalCount NOTIFY extentsChanged)
+    Q_PROPERTY(int windowOffset READ windowOffset NOTIFY dataChanged)
+    // 数据源是否带有成交量，按整个数据集而不是当前窗口判断，换页时不变
+    Q_PROPERTY(bool hasVolume READ hasVolume NOTIFY hasVolumeChanged)
+    Q_PROPERTY(QString firstTime READ firstTime NOTIFY extentsChanged)
+    Q_PROPERTY(QString lastTime READ lastTime NOTIFY extentsChanged)
+    // 交易时段模板（见TradingCalendar::templateNames），决定周期K线的分桶边界
+    Q_PROPERTY(QString sessionTemplate READ sessionTemplate WRITE setSessionTemplate NOTIFY
+                   sessionTemplateChanged)
+    // K线时间戳所在时区(IANA名称)，为空表示数据已是交易所本地时间
+    Q_PROPERTY(QString dataTimeZone READ dataTimeZone WRITE setDataTimeZone NOTIFY
+                   dataTimeZoneChanged)
+    Q_PROPERTY(QString holidayFile READ holidayFile WRITE setHolidayFile NOTIFY holidayFileChanged)
+    // 除MA外需要计算的指标（见KLineIndicators::names），结果按窗口提供给绘制组件
+    Q_PROPERTY(QStringList indicators READ indicators WRITE setIndicators NOTIFY indicatorsChanged)
 
 public:
     explicit KLineDataProvider(QObject *parent = nullptr);
@@ -44,33 +149,143 @@ public:
 
     QVariantList data() const;
     bool isLoading() const;
+    QString loadStage() const;
+    double loadProgress() const;
 
+    int totalCount() const;
+    int windowOffset() const;
+    bool hasVolume() const { return m_hasVolume; }
+    // 当前窗口的不可变快照，从不为空；可在任何线程调用。
+    // 需要同时读取K线、指标或偏移时应取一次快照，避免两次读取之间窗口被替换
+    KLineWindowSnapshotPtr snapshot() const;
+    // 与data相同的窗口，列式形式，供C++绘制组件直接使用
+    KLineColumns windowBars() const;
+    // 与windowBars对齐的指标输出，没有计算该指标时为空
+    QVector<double> windowSeries(const QString &name) const;
+    // 整个历史（而不只是窗口）的缩略汇总，供导航条绘制；可在任何线程调用
+    KLineOverview overview() const;
+    QString firstTime() const;
+    QString lastTime() const;
+
+    QString sessionTemplate() const;
+    void setSessionTemplate(const QString &sessionTemplate);
+    QString dataTimeZone() const;
+    void setDataTimeZone(const QString &dataTimeZone);
+    QString holidayFile() const;
+    void setHolidayFile(const QString &holidayFile);
+    QStringList indicators() const;
+    void setIndicators(const QStringList &indicators);
+
+    Q_INVOKABLE QStringList sessionTemplates() const;
+    Q_INVOKABLE QStringList availableIndicators() const;
     Q_INVOKABLE void loadData();
+    // 中止当前的读取或合成，已显示的数据（包括预览）保留
+    Q_INVOKABLE void cancelLoad();
+    // 把当前数据源的原始1分钟数据导出为压缩归档(.kla)，之后可直接作为csvFile加载。
+    // 归档数据源直接复制；逐笔数据源导出由逐笔生成的分钟K线；不能无损保存时返回false
+    Q_INVOKABLE bool exportArchive(const QString &archivePath);
+    // 视口接近已加载窗口边缘时调用，按需（异步）换入新的窗口
+    Q_INVOKABLE void ensureWindow(int startIndex, int visibleCount);
+    // 上次成功加载的{file, period}，文件已不存在时返回空
+    Q_INVOKABLE QVariantMap lastSession() const;
 
 signals:
     void csvFileChanged();
     void klinePeriodChanged();
     void dataChanged();
+    // 加载或合成完成，数据集已替换
     void dataLoaded();
+    // 大文件读取过程中的预览已发布到窗口，加载仍在进行
+    void previewLoaded();
+    void windowChanged();
+    void extentsChanged();
+    void hasVolumeChanged();
     void isLoadingChanged();
-    void processDataRequest(const QVariantList &rawData, const QString &targetPeriod);
+    void loadProgressChanged();
+    void sessionTemplateChanged();
+    void dataTimeZoneChanged();
+    void holidayFileChanged();
+    void indicatorsChanged();
+    void overviewChanged();
+    void indicatorsRequest(const QStringList &indicators);
+    void calendarRequest(const TradingCalendar &calendar);
+    void loadFileRequest(int generation, const QString &path, const QString &targetPeriod);
+    void processDataRequest(int generation, const KLineColumns &rawBars,
+                            const QString &targetPeriod);
+    void processArchiveRequest(int generation, const KLineArchivePtr &archive,
+                               const QString &targetPeriod);
+    void processTicksRequest(int generation, const KLineTicks &ticks, const QString &targetPeriod);
+    void loadWindowRequest(const KLineArchivePtr &archive, qint64 firstBar, int count);
+    void overviewRequest(int generation, const KLineArchivePtr &archive);
+    void writeSnapshotRequest(const KLineColumns &bars, const QString &sourcePath);
 
 private slots:
-    void onDataProcessed(const QVariantList &processedData);
+    void onFileProgress(int generation, qint64 done, qint64 total);
+    void onFilePreview(int generation, qint64 totalCount, qint64 firstTime, qint64 firstBar,
+                       const KLineColumns &bars, const KLineSeriesMap &series,
+                       const KLineOverview &overview);
+    void onFileLoaded(int generation, const KLineColumns &bars, const KLineTicks &ticks,
+                      const QString &error);
+    void onDataProcessed(int generation, const KLineColumns &bars, const KLineSeriesMap &series);
+    void onWindowLoaded(const KLineArchivePtr &archive, qint64 firstBar, const KLineColumns &bars,
+                        const KLineSeriesMap &series);
+    void onOverviewBuilt(int generation, const KLineArchivePtr &archive,
+                         const KLineOverview &overview);
 
 private:
-    void parseCSV(const QString &content);
+    bool loadArchive(const QString &filePath);
     void startAsyncProcessing(const QString &targetPeriod);
+    int nextGeneration();
+    void dispatchProcessing(const QString &targetPeriod);
+    void applyProcessed(const KLineColumns &bars, const KLineSeriesMap &series);
+    void setLoadProgress(const QString &stage, double progress);
+    bool hasSource() const;
+    bool isArchiveWindowed() const;
+    void requestWindow(qint64 firstBar, int count);
+    void updateWorkerQueue(int delta);
+    void publishWindow(qint64 firstBar, const KLineColumns &bars, const KLineSeriesMap &series,
+                       int from, int count);
+    void setExtents(qint64 totalCount, qint64 firstTime, qint64 lastTime);
+    void setHasVolume(bool hasVolume);
+    void applyCalendar();
+    void setOverview(const KLineOverview &overview);
+    // 文件或周期与上次记录的不同时才写入会话
+    void saveSession();
 
     QString m_csvFile;
     QString m_klinePeriod;
-    QVariantList m_rawData;  // 原始1分钟数据
-    QVariantList m_data;     // 当前周期的数据
-    bool m_isLoading;
+    QString m_sessionTemplate;
+    QString m_dataTimeZone;
+    QString m_holidayFile;
+    QStringList m_indicators;
+    KLineColumns m_rawBars;  // 原始1分钟数据（CSV数据源）
+    KLineTicks m_ticks;      // 逐笔数据（逐笔CSV数据源）
+    KLineArchivePtr m_archive;  // 归档数据源
+    KLineColumns m_bars;     // 当前周期的完整数据（内存模式）
+    KLineSeriesMap m_series;  // 与m_bars对齐的指标，不足周期的位置为NaN
+    // 只通过std::atomic_load/atomic_store访问
+    KLineWindowSnapshotPtr m_snapshot = std::make_shared<const KLineWindowSnapshot>();
+    std::shared_ptr<const KLineOverview> m_overview = std::make_shared<const KLineOverview>();
+    bool m_isLoading;            // 当前代号的任务尚未完成
+    bool m_fileLoading = false;  // CSV文件正在worker上读取和解析
+    int m_generation = 0;        // 最新任务的代号，较早任务的结果丢弃
+    QString m_loadingPath;
+    QString m_savedFile;  // 上次写入会话的文件和周期
+    QString m_savedPeriod;
+    QString m_loadStage;
+    double m_loadProgress = 0;
+
+    qint64 m_totalCount = 0;
+    bool m_hasVolume = false;
+    qint64 m_firstTime = 0;
+    qint64 m_lastTime = 0;
+    bool m_windowPending = false;
+    qint64 m_queuedWindowFirst = -1;
+    int m_queuedWindowCount = 0;
+    int m_workerQueueDepth = 0;  // 已发给worker、尚未收到结果的请求数
 
     QThread *m_workerThread;
     KLineDataWorker *m_worker;
-    mutable QMutex m_dataMutex;
 };
 
-#endif  // KLINEDATAPROVIDER_H
\ No newline at end of file
+#endif  // KLINEDATAPROVIDER_H
@@ -0,0 +1,292 @@
+#include "KLineIndicators.h"
+
+#include <ta_libc.h>
+
+#include <QDebug>
+#include <atomic>
+#include <future>
+#include <limits>
+#include <mutex>
+
+#include "KLineArena.h"
+#include "KLineTrace.h"
+
+namespace {
+
+std::mutex g_initMutex;
+std::shared_future<TA_RetCode> g_init;  // 受g_initMutex保护
+std::atomic<bool> g_initialized{false};
+std::atomic<int> g_precision{KLineIndicators::Double};
+
+// 单精度模式且K线带有镜像时走TA_S_*
+bool useSingle(const KLineColumns &bars)
+{
+    return g_precision.load(std::memory_order_relaxed) == KLineIndicators::Float &&
+           bars.hasSingle();
+}
+
+// 分配对齐的输出序列并调用TA-Lib；call接收输出起始指针，返回TA_RetCode
+template <typename Call>
+QVector<double> aligned(int size, int lookback, const char *name, Call call)
+{
+    QVector<double> out(size, std::numeric_limits<double>::quiet_NaN());
+    if (size <= lookback || !KLineIndicators::ensureInitialized()) return out;
+
+    int outBegIdx = 0, outNbElement = 0;
+    const TA_RetCode retCode = call(out.data() + lookback, &outBegIdx, &outNbElement);
+    if (retCode != TA_SUCCESS) {
+        qDebug() << "TA-Lib" << name << "计算失败，错误码:" << retCode;
+        out.fill(std::numeric_limits<double>::quiet_NaN());
+    }
+    return out;
+}
+
+}  // namespace
+
+namespace KLineIndicators {
+
+void initializeAsync()
+{
+    std::lock_guard<std::mutex> lock(g_initMutex);
+    if (!g_init.valid()) g_init = std::async(std::launch::async, TA_Initialize).share();
+}
+
+bool ensureInitialized()
+{
+    if (g_initialized.load(std::memory_order_acquire)) return true;
+
+    initializeAsync();
+    std::shared_future<TA_RetCode> init;
+    {
+        std::lock_guard<std::mutex> lock(g_initMutex);
+        init = g_init;
+    }
+    const TA_RetCode retCode = init.get();
+    if (retCode != TA_SUCCESS) {
+        qDebug() << "TA-Lib初始化失败，错误码:" << retCode;
+        return false;
+    }
+    g_initialized.store(true, std::memory_order_release);
+    return true;
+}
+
+void shutdown()
+{
+    std::lock_guard<std::mutex> lock(g_initMutex);
+    if (!g_init.valid()) return;
+
+    if (g_init.get() == TA_SUCCESS) TA_Shutdown();
+    g_init = std::shared_future<TA_RetCode>();
+    g_initialized.store(false, std::memory_order_release);
+}
+
+void setPrecision(Precision precision)
+{
+    g_precision.store(precision, std::memory_order_relaxed);
+}
+
+Precision precision() { return Precision(g_precision.load(std::memory_order_relaxed)); }
+
+QStringList names() { return {"MA", "BBANDS", "OBV", "AD", "ADOSC", "MFI"}; }
+
+int lookback(const QString &name)
+{
+    if (name == "MA") return TA_MA_Lookback(kMaPeriod, TA_MAType_SMA);
+    if (name == "BBANDS") {
+        return TA_BBANDS_Lookback(kBbandsPeriod, kBbandsDeviations, kBbandsDeviations,
+                                  TA_MAType_SMA);
+    }
+    if (name == "OBV") return TA_OBV_Lookback();
+    if (name == "AD") return TA_AD_Lookback();
+    if (name == "ADOSC") return TA_ADOSC_Lookback(3, 10);
+    if (name == "MFI") return TA_MFI_Lookback(14);
+    return 0;
+}
+
+bool compute(const QString &name, const KLineColumns &bars, KLineSeriesMap &out)
+{
+    KLINE_TRACE_SCOPE_DETAIL("indicator", "KLineIndicators::compute", name);
+    // TA-Lib内部的临时数组从本线程的arena分配，计算结束整体回收
+    KLineArena::Scope arena;
+    if (name == "MA") {
+        out.insert(name, sma(bars, kMaPeriod));
+    } else if (name == "BBANDS") {
+        QVector<double> upper, middle, lower;
+        bbands(bars, kBbandsPeriod, kBbandsDeviations, upper, middle, lower);
+        out.insert("BBANDS.upper", upper);
+        out.insert("BBANDS.middle", middle);
+        out.insert("BBANDS.lower", lower);
+    } else if (name == "OBV") {
+        out.insert(name, obv(bars));
+    } else if (name == "AD") {
+        out.insert(name, ad(bars));
+    } else if (name == "ADOSC") {
+        out.insert(name, adosc(bars));
+    } else if (name == "MFI") {
+        out.insert(name, mfi(bars));
+    } else {
+        qDebug() << "KLineIndicators: 未知指标" << name;
+        return false;
+    }
+    return true;
+}
+
+bool isCumulative(const QString &name)
+{
+    return name == "OBV" || name == "AD" || name == "ADOSC";
+}
+
+void accumulate(CumulativeState &state, const KLineColumns &bars)
+{
+    // 与TA_OBV、TA_AD的递推一致
+    for (int i = 0; i < bars.size(); ++i) {
+        const double close = bars.close[i];
+        if (state.bars == 0) {
+            state.obv = bars.volume[i];
+        } else if (close > state.lastClose) {
+            state.obv += bars.volume[i];
+        } else if (close < state.lastClose) {
+            state.obv -= bars.volume[i];
+        }
+        state.lastClose = close;
+
+        const double range = bars.high[i] - bars.low[i];
+        if (range > 0) {
+            state.ad += (((close - bars.low[i]) - (bars.high[i] - close)) / range) * bars.volume[i];
+        }
+        ++state.bars;
+    }
+}
+
+void rebase(KLineSeriesMap &series, const KLineColumns &bars, const CumulativeState &start)
+{
+    if (start.bars == 0 || bars.isEmpty()) return;
+
+    // TA_OBV以段内第一根的成交量起算，全序列的OBV则由前一根收盘价决定第一根的方向
+    if (series.contains("OBV")) {
+        const double close = bars.close[0];
+        const double volume = bars.volume[0];
+        double first = start.obv;
+        if (close > start.lastClose) first += volume;
+        if (close < start.lastClose) first -= volume;
+        for (double &value : series["OBV"]) value += first - volume;
+    }
+    if (series.contains("AD")) {
+        for (double &value : series["AD"]) value += start.ad;
+    }
+    // ADOSC是AD两条EMA之差，与AD的常数偏移无关，只需足够的预热
+}
+
+KLineSeriesMap slice(const KLineSeriesMap &series, int from, int count)
+{
+    KLineSeriesMap result;
+    for (auto it = series.cbegin(); it != series.cend(); ++it) {
+        result.insert(it.key(), it.value().mid(from, count));
+    }
+    return result;
+}
+
+QVector<double> sma(const KLineColumns &bars, int period)
+{
+    const int end = bars.size() - 1;
+    return aligned(bars.size(), TA_MA_Lookback(period, TA_MAType_SMA), "MA",
+                   [&](double *out, int *beg, int *nb) {
+                       if (useSingle(bars)) {
+                           return TA_S_MA(0, end, bars.single.close.constData(), period,
+                                          TA_MAType_SMA, beg, nb, out);
+                       }
+                       return TA_MA(0, end, bars.close.constData(), period, TA_MAType_SMA, beg,
+                                    nb, out);
+                   });
+}
+
+void bbands(const KLineColumns &bars, int period, double nbDev, QVector<double> &upper,
+            QVector<double> &middle, QVector<double> &lower)
+{
+    const int size = bars.size();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    upper.fill(nan, size);
+    middle.fill(nan, size);
+    lower.fill(nan, size);
+
+    const int lookback = TA_BBANDS_Lookback(period, nbDev, nbDev, TA_MAType_SMA);
+    if (size <= lookback || !ensureInitialized()) return;
+
+    int outBegIdx = 0, outNbElement = 0;
+    const TA_RetCode retCode =
+        useSingle(bars)
+            ? TA_S_BBANDS(0, size - 1, bars.single.close.constData(), period, nbDev, nbDev,
+                          TA_MAType_SMA, &outBegIdx, &outNbElement, upper.data() + lookback,
+                          middle.data() + lookback, lower.data() + lookback)
+            : TA_BBANDS(0, size - 1, bars.close.constData(), period, nbDev, nbDev,
+                        TA_MAType_SMA, &outBegIdx, &outNbElement, upper.data() + lookback,
+                        middle.data() + lookback, lower.data() + lookback);
+    if (retCode != TA_SUCCESS) {
+        qDebug() << "TA-Lib BBANDS 计算失败，错误码:" << retCode;
+        upper.fill(nan);
+        middle.fill(nan);
+        lower.fill(nan);
+    }
+}
+
+QVector<double> obv(const KLineColumns &bars)
+{
+    const int end = bars.size() - 1;
+    return aligned(bars.size(), TA_OBV_Lookback(), "OBV", [&](double *out, int *beg, int *nb) {
+        if (useSingle(bars)) {
+            return TA_S_OBV(0, end, bars.single.close.constData(),
+                            bars.single.volume.constData(), beg, nb, out);
+        }
+        return TA_OBV(0, end, bars.close.constData(), bars.volume.constData(), beg, nb, out);
+    });
+}
+
+QVector<double> ad(const KLineColumns &bars)
+{
+    const int end = bars.size() - 1;
+    return aligned(bars.size(), TA_AD_Lookback(), "AD", [&](double *out, int *beg, int *nb) {
+        if (useSingle(bars)) {
+            const KLineColumns::Single &f = bars.single;
+            return TA_S_AD(0, end, f.high.constData(), f.low.constData(), f.close.constData(),
+                           f.volume.constData(), beg, nb, out);
+        }
+        return TA_AD(0, end, bars.high.constData(), bars.low.constData(), bars.close.constData(),
+                     bars.volume.constData(), beg, nb, out);
+    });
+}
+
+QVector<double> adosc(const KLineColumns &bars, int fastPeriod, int slowPeriod)
+{
+    const int end = bars.size() - 1;
+    return aligned(bars.size(), TA_ADOSC_Lookback(fastPeriod, slowPeriod), "ADOSC",
+                   [&](double *out, int *beg, int *nb) {
+                       if (useSingle(bars)) {
+                           const KLineColumns::Single &f = bars.single;
+                           return TA_S_ADOSC(0, end, f.high.constData(), f.low.constData(),
+                                             f.close.constData(), f.volume.constData(),
+                                             fastPeriod, slowPeriod, beg, nb, out);
+                       }
+                       return TA_ADOSC(0, end, bars.high.constData(), bars.low.constData(),
+                                       bars.close.constData(), bars.volume.constData(),
+                                       fastPeriod, slowPeriod, beg, nb, out);
+                   });
+}
+
+QVector<double> mfi(const KLineColumns &bars, int period)
+{
+    const int end = bars.size() - 1;
+    return aligned(bars.size(), TA_MFI_Lookback(period), "MFI",
+                   [&](double *out, int *beg, int *nb) {
+                       if (useSingle(bars)) {
+                           const KLineColumns::Single &f = bars.single;
+                           return TA_S_MFI(0, end, f.high.constData(), f.low.constData(),
+                                           f.close.constData(), f.volume.constData(), period,
+                                           beg, nb, out);
+                       }
+                       return TA_MFI(0, end, bars.high.constData(), bars.low.constData(),
+                                     bars.close.constData(), bars.volume.constData(), period,
+                                     beg, nb, out);
+                   });
+}
+
+}  // namespace KLineIndicators
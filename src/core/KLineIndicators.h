@@ -0,0 +1,82 @@
+#ifndef KLINEINDICATORS_H
+#define KLINEINDICATORS_H
+
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "KLineColumns.h"
+
+// 指标输出名 -> 与K线对齐的序列，不足lookback的位置为NaN
+using KLineSeriesMap = QMap<QString, QVector<double>>;
+
+// 直接在列式存储上调用TA-Lib：输入列以constData()原样传入，不做任何拷贝，
+// 输出从lookback位置写入，返回与K线等长的序列，前lookback个位置为NaN。
+// 单精度模式下K线带有单精度镜像时读取镜像，同样不做拷贝。
+namespace KLineIndicators {
+
+// 在后台线程上调用TA_Initialize，立即返回。启动时尽早调用，与窗口和QML的加载并行
+void initializeAsync();
+// 等待初始化完成，尚未开始时在当前线程上同步初始化；各指标函数在调用TA-Lib前自动调用
+bool ensureInitialized();
+// 等待初始化完成后调用TA_Shutdown
+void shutdown();
+
+// 指标输入的精度。Float时数据集在生成时建立单精度镜像(KLineColumns::buildSingle)，
+// 指标调用TA-Lib的TA_S_*版本直接读取镜像，输出仍为double；没有镜像的K线按双精度计算。
+// OBV、MFI会因舍入翻转个别K线的涨跌方向，误差见kline_bench的accuracy用例，缺省不开启
+enum Precision { Double, Float };
+// 对所有线程生效，从下一次生成的数据集开始
+void setPrecision(Precision precision);
+Precision precision();
+
+// 可按名称计算的指标
+QStringList names();
+// 指标需要的前置K线数量，窗口加载时据此额外读取
+int lookback(const QString &name);
+// 计算name的全部输出写入out，单输出指标的键与name相同，
+// 多输出指标的键为"name.输出名"，例如BBANDS.upper；未知指标返回false
+bool compute(const QString &name, const KLineColumns &bars, KLineSeriesMap &out);
+// 把每个序列截取为[from, from + count)
+KLineSeriesMap slice(const KLineSeriesMap &series, int from, int count);
+
+// 累积型指标(OBV、AD和由AD导出的ADOSC)的值取决于序列起点以来的全部K线。
+// 分段计算时先用accumulate按顺序累计出每段之前的状态，再用rebase把从段起点算出的序列
+// 换算为从序列起点计算的值
+bool isCumulative(const QString &name);
+
+struct CumulativeState
+{
+    qint64 bars = 0;  // 已累计的K线数
+    double obv = 0;
+    double ad = 0;
+    double lastClose = 0;
+};
+
+// ADOSC的两条EMA从段起点重新开始，段起点到第一个需要的K线之间至少留出这么多根，
+// 与从序列起点计算的差异衰减到double精度以下
+constexpr int kCumulativeWarmup = 512;
+
+void accumulate(CumulativeState &state, const KLineColumns &bars);
+// series由从某段起点开始的bars算出，start为该段之前的累计状态
+void rebase(KLineSeriesMap &series, const KLineColumns &bars, const CumulativeState &start);
+
+constexpr int kMaPeriod = 5;
+constexpr int kBbandsPeriod = 20;
+constexpr double kBbandsDeviations = 2.0;
+
+QVector<double> sma(const KLineColumns &bars, int period);
+// 布林带：收盘价的SMA及其上下nbDev倍标准差，三条输出写入upper/middle/lower
+void bbands(const KLineColumns &bars, int period, double nbDev, QVector<double> &upper,
+            QVector<double> &middle, QVector<double> &lower);
+
+// 成交量类指标
+QVector<double> obv(const KLineColumns &bars);
+QVector<double> ad(const KLineColumns &bars);
+QVector<double> adosc(const KLineColumns &bars, int fastPeriod = 3, int slowPeriod = 10);
+QVector<double> mfi(const KLineColumns &bars, int period = 14);
+
+}  // namespace KLineIndicators
+
+#endif  // KLINEINDICATORS_H
@@ -0,0 +1,255 @@
+#include "KLineMetrics.h"
+
+#include <QDateTime>
+#include <QDebug>
+#include <QFile>
+#include <QJsonDocument>
+#include <QMutex>
+#include <QMutexLocker>
+#include <cmath>
+#include <limits>
+#include <map>
+
+#include "KLineTrace.h"
+
+namespace KLineMetrics {
+
+namespace detail {
+std::atomic<int> users{0};
+}
+
+namespace {
+
+struct Registry
+{
+    QMutex mutex;
+    std::map<QString, std::unique_ptr<Histogram>> histograms;
+    std::map<QString, qint64> gauges;
+};
+
+// 故意不析构，渲染线程可能在静态对象析构之后仍在记录
+Registry &registry()
+{
+    static Registry *instance = new Registry;
+    return *instance;
+}
+
+std::atomic<qint64> g_startup{-1};
+std::atomic<bool> g_firstData{false};
+std::atomic<bool> g_startupDone{false};
+
+int highestBit(quint64 value)
+{
+    int bit = 0;
+    while (value >>= 1) ++bit;
+    return bit;
+}
+
+}  // namespace
+
+void retain() { detail::users.fetch_add(1, std::memory_order_relaxed); }
+
+void release() { detail::users.fetch_sub(1, std::memory_order_relaxed); }
+
+qint64 now() { return KLineTrace::now(); }
+
+Histogram::Histogram(Unit unit) : m_unit(unit), m_buckets(new std::atomic<quint64>[kBucketCount])
+{
+    reset();
+}
+
+int Histogram::bucketIndex(qint64 value)
+{
+    const quint64 v = quint64(qMax<qint64>(0, value));
+    if (v < quint64(kSubBuckets)) return int(v);
+
+    // [2^k, 2^(k+1))分成kSubBuckets格，格宽2^(k - kSubBucketBits)
+    const int k = highestBit(v);
+    const int shift = k - kSubBucketBits;
+    return kSubBuckets + shift * kSubBuckets + int((v >> shift) - kSubBuckets);
+}
+
+qint64 Histogram::bucketUpperBound(int index)
+{
+    if (index < kSubBuckets) return index;
+
+    const int shift = (index - kSubBuckets) / kSubBuckets;
+    const quint64 sub = quint64((index - kSubBuckets) % kSubBuckets);
+    const quint64 lower = (quint64(kSubBuckets) + sub) << shift;
+    const quint64 upper = lower + (quint64(1) << shift) - 1;
+    return qint64(qMin<quint64>(upper, quint64(std::numeric_limits<qint64>::max())));
+}
+
+void Histogram::record(qint64 value)
+{
+    value = qMax<qint64>(0, value);
+    m_buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+
+    qint64 current = m_min.load(std::memory_order_relaxed);
+    while (value < current && !m_min.compare_exchange_weak(current, value)) {
+    }
+    current = m_max.load(std::memory_order_relaxed);
+    while (value > current && !m_max.compare_exchange_weak(current, value)) {
+    }
+}
+
+void Histogram::reset()
+{
+    for (int i = 0; i < kBucketCount; ++i) m_buckets[i].store(0, std::memory_order_relaxed);
+    m_count.store(0, std::memory_order_relaxed);
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(std::numeric_limits<qint64>::max(), std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+qint64 Histogram::min() const { return count() == 0 ? 0 : m_min.load(std::memory_order_relaxed); }
+
+qint64 Histogram::max() const { return m_max.load(std::memory_order_relaxed); }
+
+double Histogram::mean() const
+{
+    const quint64 n = count();
+    return n == 0 ? 0.0 : double(m_sum.load(std::memory_order_relaxed)) / n;
+}
+
+qint64 Histogram::percentile(double p) const
+{
+    // 与记录并发时各格之和可能略大于count，以各格之和为准
+    quint64 total = 0;
+    for (int i = 0; i < kBucketCount; ++i) total += m_buckets[i].load(std::memory_order_relaxed);
+    if (total == 0) return 0;
+
+    const quint64 rank = qMax<quint64>(1, quint64(std::ceil(qBound(0.0, p, 1.0) * total)));
+    quint64 seen = 0;
+    for (int i = 0; i < kBucketCount; ++i) {
+        seen += m_buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank) return qMin(bucketUpperBound(i), max());
+    }
+    return max();
+}
+
+QJsonObject Histogram::toJson() const
+{
+    const double scale = m_unit == Nanoseconds ? 1e-6 : 1.0;
+    const QString suffix = m_unit == Nanoseconds ? "_ms" : "";
+
+    QJsonObject object;
+    object["count"] = double(count());
+    object["min" + suffix] = min() * scale;
+    object["mean" + suffix] = mean() * scale;
+    object["p50" + suffix] = percentile(0.5) * scale;
+    object["p90" + suffix] = percentile(0.9) * scale;
+    object["p99" + suffix] = percentile(0.99) * scale;
+    object["p999" + suffix] = percentile(0.999) * scale;
+    object["max" + suffix] = max() * scale;
+    return object;
+}
+
+Histogram &histogram(const QString &name, Histogram::Unit unit)
+{
+    Registry &reg = registry();
+    QMutexLocker locker(&reg.mutex);
+    std::unique_ptr<Histogram> &slot = reg.histograms[name];
+    if (!slot) slot = std::make_unique<Histogram>(unit);
+    return *slot;
+}
+
+void setGauge(const QString &name, qint64 value)
+{
+    if (!isEnabled()) return;
+
+    Histogram &samples = histogram(name, Histogram::Count);
+    samples.record(value);
+    Registry &reg = registry();
+    QMutexLocker locker(&reg.mutex);
+    reg.gauges[name] = value;
+}
+
+qint64 gauge(const QString &name)
+{
+    Registry &reg = registry();
+    QMutexLocker locker(&reg.mutex);
+    auto it = reg.gauges.find(name);
+    return it == reg.gauges.end() ? 0 : it->second;
+}
+
+void LatencyProbe::mark()
+{
+    if (!isEnabled()) return;
+
+    qint64 expected = -1;
+    m_start.compare_exchange_strong(expected, now(), std::memory_order_relaxed);
+}
+
+void LatencyProbe::complete(qint64 end)
+{
+    const qint64 start = m_start.exchange(-1, std::memory_order_relaxed);
+    if (start >= 0) m_histogram.record(end - start);
+}
+
+LatencyProbe &inputProbe()
+{
+    static LatencyProbe *probe = new LatencyProbe("latency.input_to_frame");
+    return *probe;
+}
+
+LatencyProbe &tickProbe()
+{
+    static LatencyProbe *probe = new LatencyProbe("latency.tick_to_frame");
+    return *probe;
+}
+
+void markStartup() { g_startup.store(now(), std::memory_order_relaxed); }
+
+void markFirstData() { g_firstData.store(true, std::memory_order_release); }
+
+void completeStartup(qint64 end)
+{
+    if (!g_firstData.load(std::memory_order_acquire)) return;
+    if (g_startupDone.exchange(true)) return;
+
+    const qint64 start = g_startup.load(std::memory_order_relaxed);
+    if (start < 0) return;
+    histogram("startup.first_chart").record(end - start);
+    qDebug() << "KLineMetrics: 启动到首帧图表耗时" << (end - start) / 1e6 << "ms";
+}
+
+QJsonObject snapshot()
+{
+    Registry &reg = registry();
+    QMutexLocker locker(&reg.mutex);
+
+    QJsonObject histograms;
+    for (const auto &entry : reg.histograms) histograms[entry.first] = entry.second->toJson();
+    QJsonObject gauges;
+    for (const auto &entry : reg.gauges) gauges[entry.first] = double(entry.second);
+
+    QJsonObject root;
+    root["date"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+    root["histograms"] = histograms;
+    root["gauges"] = gauges;
+    return root;
+}
+
+bool exportJson(const QString &path, QString *error)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        if (error) *error = file.errorString();
+        return false;
+    }
+    file.write(QJsonDocument(snapshot()).toJson());
+    return true;
+}
+
+void reset()
+{
+    Registry &reg = registry();
+    QMutexLocker locker(&reg.mutex);
+    for (const auto &entry : reg.histograms) entry.second->reset();
+    reg.gauges.clear();
+}
+
+}  // namespace KLineMetrics
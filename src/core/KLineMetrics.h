@@ -0,0 +1,124 @@
+#ifndef KLINEMETRICS_H
+#define KLINEMETRICS_H
+
+#include <QJsonObject>
+#include <QString>
+#include <QtGlobal>
+#include <atomic>
+#include <memory>
+
+// 延迟和帧时间指标。数值记录在HDR风格的直方图里：按2的幂分段，每段再线性分成kSubBuckets格，
+// 任意量级的相对误差都不超过1/kSubBuckets，记录只是几次原子加，可以在任意线程上调用。
+// 运行期开关关闭时各记录点只读一次原子变量，不取时间戳
+namespace KLineMetrics {
+
+namespace detail {
+extern std::atomic<int> users;
+}
+
+inline bool isEnabled() { return detail::users.load(std::memory_order_relaxed) > 0; }
+// 嵌套计数：HUD显示和命令行--metrics各持有一次，全部释放后停止记录
+void retain();
+void release();
+
+// 单调时钟，纳秒，与KLineTrace相同
+qint64 now();
+
+class Histogram
+{
+public:
+    // Nanoseconds的直方图导出为毫秒，Count原样导出
+    enum Unit { Nanoseconds, Count };
+
+    static constexpr int kSubBucketBits = 5;
+    static constexpr int kSubBuckets = 1 << kSubBucketBits;
+    static constexpr int kBucketCount = (64 - kSubBucketBits) * kSubBuckets;
+
+    explicit Histogram(Unit unit = Nanoseconds);
+
+    // 负值按0记录
+    void record(qint64 value);
+    void reset();
+
+    quint64 count() const { return m_count.load(std::memory_order_relaxed); }
+    qint64 min() const;
+    qint64 max() const;
+    double mean() const;
+    // 第p(0~1)分位所在格的上界，没有样本时返回0
+    qint64 percentile(double p) const;
+
+    Unit unit() const { return m_unit; }
+    QJsonObject toJson() const;
+
+    static int bucketIndex(qint64 value);
+    static qint64 bucketUpperBound(int index);
+
+private:
+    Unit m_unit;
+    std::unique_ptr<std::atomic<quint64>[]> m_buckets;
+    std::atomic<quint64> m_count{0};
+    std::atomic<qint64> m_sum{0};
+    std::atomic<qint64> m_min;
+    std::atomic<qint64> m_max{0};
+};
+
+// 按名称取直方图，首次使用时按unit创建，整个进程内地址不变；热路径应缓存返回的引用
+Histogram &histogram(const QString &name, Histogram::Unit unit = Histogram::Nanoseconds);
+
+// 瞬时值（例如队列深度），同时记入同名直方图
+void setGauge(const QString &name, qint64 value);
+qint64 gauge(const QString &name);
+
+// 从事件发生到下一帧交换的延迟。mark只保留最早一次未完成的事件，
+// 同一帧内的多次输入算作一次，complete在帧交换后调用，把间隔记入直方图
+class LatencyProbe
+{
+public:
+    explicit LatencyProbe(const QString &name) : m_histogram(histogram(name)) {}
+
+    void mark();
+    void complete(qint64 end);
+
+private:
+    Histogram &m_histogram;
+    std::atomic<qint64> m_start{-1};
+};
+
+// 作用域耗时记入直方图
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(Histogram &histogram)
+        : m_histogram(histogram), m_start(isEnabled() ? now() : -1)
+    {
+    }
+    ~ScopedTimer()
+    {
+        if (m_start >= 0) m_histogram.record(now() - m_start);
+    }
+
+private:
+    Q_DISABLE_COPY(ScopedTimer)
+
+    Histogram &m_histogram;
+    qint64 m_start;
+};
+
+LatencyProbe &inputProbe();  // 十字光标移动到屏幕
+LatencyProbe &tickProbe();   // 行情或数据窗口到屏幕
+
+// 启动到第一张有数据的图表上屏，记为startup.first_chart：main入口调用markStartup，
+// 第一次发布数据时markFirstData，之后的第一次帧交换completeStartup。只记录一次，
+// 不受retain/release开关影响
+void markStartup();
+void markFirstData();
+void completeStartup(qint64 end);
+
+// 全部直方图和瞬时值，按名称排序
+QJsonObject snapshot();
+bool exportJson(const QString &path, QString *error = nullptr);
+void reset();
+
+}  // namespace KLineMetrics
+
+#endif  // KLINEMETRICS_H
@@ -0,0 +1,78 @@
+#include "KLineOverview.h"
+
+#include <cmath>
+#include <limits>
+
+void KLineOverview::clear()
+{
+    m_buckets.clear();
+    m_bucketSize = 1;
+    m_barCount = 0;
+}
+
+void KLineOverview::append(const KLineColumns &bars)
+{
+    for (int i = 0; i < bars.size(); ++i) {
+        // 最后一个桶未满时并入，否则开新桶；合并后桶宽翻倍，已有K线数仍是桶宽的整数倍
+        if (m_barCount % m_bucketSize == 0) {
+            if (m_buckets.size() == kMaxBuckets) mergePairs();
+            m_buckets.append({bars.low[i], bars.high[i], bars.close[i]});
+        } else {
+            Bucket &bucket = m_buckets.last();
+            bucket.low = qMin(bucket.low, bars.low[i]);
+            bucket.high = qMax(bucket.high, bars.high[i]);
+            bucket.close = bars.close[i];
+        }
+        ++m_barCount;
+    }
+}
+
+void KLineOverview::mergePairs()
+{
+    // 桶数为偶数且都已满，两两合并后最后一个桶恰好也是满的
+    const int merged = m_buckets.size() / 2;
+    for (int i = 0; i < merged; ++i) {
+        const Bucket &left = m_buckets[2 * i];
+        const Bucket &right = m_buckets[2 * i + 1];
+        m_buckets[i] = {qMin(left.low, right.low), qMax(left.high, right.high), right.close};
+    }
+    m_buckets.resize(merged);
+    m_bucketSize *= 2;
+}
+
+void KLineOverview::summarize(int columns, QVector<double> &low, QVector<double> &high,
+                              QVector<double> &close) const
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    low.fill(nan, qMax(0, columns));
+    high.fill(nan, qMax(0, columns));
+    close.fill(nan, qMax(0, columns));
+    if (columns <= 0 || m_buckets.isEmpty()) return;
+
+    // 每个桶按起始K线落入一列；桶比列少时一个桶跨多列，按列中心取桶
+    const double barsPerColumn = double(m_barCount) / columns;
+    if (barsPerColumn < m_bucketSize) {
+        for (int column = 0; column < columns; ++column) {
+            const qint64 bar = qint64((column + 0.5) * barsPerColumn);
+            const Bucket &bucket = m_buckets[int(qMin<qint64>(bar / m_bucketSize,
+                                                              m_buckets.size() - 1))];
+            low[column] = bucket.low;
+            high[column] = bucket.high;
+            close[column] = bucket.close;
+        }
+        return;
+    }
+
+    for (int i = 0; i < m_buckets.size(); ++i) {
+        const Bucket &bucket = m_buckets[i];
+        const int column = qMin(columns - 1, int(i * m_bucketSize / barsPerColumn));
+        if (std::isnan(low[column])) {
+            low[column] = bucket.low;
+            high[column] = bucket.high;
+        } else {
+            low[column] = qMin(low[column], bucket.low);
+            high[column] = qMax(high[column], bucket.high);
+        }
+        close[column] = bucket.close;
+    }
+}
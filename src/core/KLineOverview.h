@@ -0,0 +1,48 @@
+#ifndef KLINEOVERVIEW_H
+#define KLINEOVERVIEW_H
+
+#include <QMetaType>
+#include <QVector>
+#include <QtGlobal>
+
+#include "KLineColumns.h"
+
+// 整个历史的缩略汇总：每bucketSize根K线一个桶，记录最高、最低和最后收盘价。
+// 桶数超过kMaxBuckets时相邻两桶合并、桶宽翻倍，桶数始终与屏幕宽度同级，
+// 与K线总数无关。追加新K线只更新最后一个桶或在末尾加桶，均摊O(1)。
+class KLineOverview
+{
+public:
+    static constexpr int kMaxBuckets = 4096;
+
+    struct Bucket
+    {
+        double low = 0;
+        double high = 0;
+        double close = 0;
+    };
+
+    qint64 barCount() const { return m_barCount; }
+    qint64 bucketSize() const { return m_bucketSize; }
+    const QVector<Bucket> &buckets() const { return m_buckets; }
+    bool isEmpty() const { return m_barCount == 0; }
+
+    void clear();
+    void append(const KLineColumns &bars);
+
+    // 把[0, barCount)按列均分为columns列，每列写入覆盖的桶的最低、最高和最后收盘价，
+    // 耗时O(columns + 桶数)；没有数据的列low/high/close均为NaN
+    void summarize(int columns, QVector<double> &low, QVector<double> &high,
+                   QVector<double> &close) const;
+
+private:
+    void mergePairs();
+
+    QVector<Bucket> m_buckets;
+    qint64 m_bucketSize = 1;
+    qint64 m_barCount = 0;
+};
+
+Q_DECLARE_METATYPE(KLineOverview)
+
+#endif  // KLINEOVERVIEW_H
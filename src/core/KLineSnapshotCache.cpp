@@ -0,0 +1,134 @@
+#include "KLineSnapshotCache.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSettings>
+#include <QMutex>
+#include <QStandardPaths>
+#include <atomic>
+
+#include "KLineArchive.h"
+#include "KLineTrace.h"
+
+namespace {
+
+// 快照内容的规则变化时递增，旧快照的文件名随之失效
+// （版本1固定按两位小数存价格，版本2总是带全部可选列）
+constexpr int kSnapshotVersion = 3;
+
+// 界面线程设置，worker线程写快照时读取
+QMutex g_cacheDirMutex;
+QString g_cacheDir;  // 受g_cacheDirMutex保护，空表示缺省目录
+std::atomic<bool> g_enabled{true};
+
+// 快照文件名: <路径哈希>-<大小和修改时间哈希>.kla，同一源文件的快照有相同前缀
+QString pathKey(const QFileInfo &info)
+{
+    return QString::fromLatin1(
+        QCryptographicHash::hash(info.absoluteFilePath().toUtf8(), QCryptographicHash::Sha1)
+            .toHex()
+            .left(16));
+}
+
+QString contentKey(const QFileInfo &info)
+{
+    const QByteArray stamp = QByteArray::number(kSnapshotVersion) + ':' +
+                             QByteArray::number(info.size()) + ':' +
+                             QByteArray::number(info.lastModified().toMSecsSinceEpoch());
+    return QString::fromLatin1(
+        QCryptographicHash::hash(stamp, QCryptographicHash::Sha1).toHex().left(8));
+}
+
+QString sessionFile() { return QDir(KLineSnapshotCache::cacheDir()).filePath("session.ini"); }
+
+}  // namespace
+
+namespace KLineSnapshotCache {
+
+QString cacheDir()
+{
+    {
+        QMutexLocker locker(&g_cacheDirMutex);
+        if (!g_cacheDir.isEmpty()) return g_cacheDir;
+    }
+    return QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation))
+        .filePath("snapshots");
+}
+
+void setCacheDir(const QString &dir)
+{
+    QMutexLocker locker(&g_cacheDirMutex);
+    g_cacheDir = dir;
+}
+
+void setEnabled(bool enabled) { g_enabled.store(enabled, std::memory_order_relaxed); }
+
+bool isEnabled() { return g_enabled.load(std::memory_order_relaxed); }
+
+QString snapshotPath(const QString &sourcePath)
+{
+    const QFileInfo info(sourcePath);
+    if (!info.exists()) return QString();
+    return QDir(cacheDir()).filePath(pathKey(info) + "-" + contentKey(info) + ".kla");
+}
+
+bool hasSnapshot(const QString &sourcePath)
+{
+    if (!isEnabled()) return false;
+    const QString path = snapshotPath(sourcePath);
+    return !path.isEmpty() && QFile::exists(path);
+}
+
+bool write(const QString &sourcePath, const KLineColumns &bars, QString *error)
+{
+    KLINE_TRACE_SCOPE_DETAIL("io", "KLineSnapshotCache::write", sourcePath);
+    if (!isEnabled()) {
+        if (error) *error = QStringLiteral("snapshot cache disabled");
+        return false;
+    }
+    const QString target = snapshotPath(sourcePath);
+    if (target.isEmpty() || bars.isEmpty()) {
+        if (error) *error = QStringLiteral("no source data");
+        return false;
+    }
+
+    const QDir dir(cacheDir());
+    if (!dir.exists() && !QDir().mkpath(dir.path())) {
+        if (error) *error = QStringLiteral("cannot create %1").arg(dir.path());
+        return false;
+    }
+
+    // 快照会代替CSV被加载，只缓存能原样还原的数据
+    if (!KLineArchiveWriter::writeLossless(target, bars, error)) return false;
+
+    // 同一源文件旧内容的快照
+    const QString prefix = pathKey(QFileInfo(sourcePath)) + "-";
+    for (const QString &name : dir.entryList({prefix + "*.kla"}, QDir::Files)) {
+        if (dir.filePath(name) != target) QFile::remove(dir.filePath(name));
+    }
+    return true;
+}
+
+QString lastFile()
+{
+    const QSettings settings(sessionFile(), QSettings::IniFormat);
+    return settings.value("lastFile").toString();
+}
+
+QString lastPeriod()
+{
+    const QSettings settings(sessionFile(), QSettings::IniFormat);
+    return settings.value("lastPeriod").toString();
+}
+
+void setLastSession(const QString &file, const QString &period)
+{
+    QSettings settings(sessionFile(), QSettings::IniFormat);
+    settings.setValue("lastFile", file);
+    settings.setValue("lastPeriod", period);
+}
+
+}  // namespace KLineSnapshotCache
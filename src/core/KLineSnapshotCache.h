@@ -0,0 +1,38 @@
+#ifndef KLINESNAPSHOTCACHE_H
+#define KLINESNAPSHOTCACHE_H
+
+#include <QString>
+
+#include "KLineColumns.h"
+
+// CSV数据源的二进制快照和上次查看的会话
+//
+// 第一次加载CSV后把分钟K线写成.kla归档放在缓存目录，下次打开同一文件时直接加载归档：
+// 只读头部和索引并映射文件，K线按窗口在worker上解码，不再读取和解析整个CSV。
+// 快照按源文件的绝对路径、大小和修改时间命名，源文件变化后旧快照自动失效并被清理。
+namespace KLineSnapshotCache {
+
+// 快照和会话文件所在目录，缺省在系统缓存目录下
+QString cacheDir();
+// 基准测试等工具把缓存指向临时目录，不碰用户的缓存；空字符串恢复缺省
+void setCacheDir(const QString &dir);
+// 关闭后hasSnapshot总是返回false，write不写文件，用于测量直接解析CSV的路径
+void setEnabled(bool enabled);
+bool isEnabled();
+
+// 源文件当前内容对应的快照路径，文件不存在时返回空
+QString snapshotPath(const QString &sourcePath);
+// 快照存在且与源文件当前内容对应
+bool hasSnapshot(const QString &sourcePath);
+// 先写临时文件再改名，中途失败不会留下不完整的快照；同一源文件的旧快照一并删除。
+// 价格小数位数按数据确定，价格超过8位小数或成交量、持仓量不是整数时不写快照
+bool write(const QString &sourcePath, const KLineColumns &bars, QString *error = nullptr);
+
+// 上次成功加载的文件和周期，启动时据此恢复
+QString lastFile();
+QString lastPeriod();
+void setLastSession(const QString &file, const QString &period);
+
+}  // namespace KLineSnapshotCache
+
+#endif  // KLINESNAPSHOTCACHE_H
@@ -0,0 +1,31 @@
+#include "KLineTicks.h"
+
+void KLineTicks::reserve(int n)
+{
+    time.reserve(n);
+    price.reserve(n);
+    size.reserve(n);
+}
+
+void KLineTicks::clear()
+{
+    time.clear();
+    price.clear();
+    size.clear();
+}
+
+void KLineTicks::append(qint64 t, double p, double s)
+{
+    time.append(t);
+    price.append(p);
+    size.append(s);
+}
+
+KLineTicks KLineTicks::fromBars(const KLineColumns &bars)
+{
+    KLineTicks ticks;
+    ticks.time = bars.time;
+    ticks.price = bars.close;
+    ticks.size = bars.volume;
+    return ticks;
+}
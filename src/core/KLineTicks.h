@@ -0,0 +1,30 @@
+#ifndef KLINETICKS_H
+#define KLINETICKS_H
+
+#include <QMetaType>
+#include <QVector>
+#include <QtGlobal>
+
+#include "KLineColumns.h"
+
+// 列式逐笔数据：时间、成交价、成交数量各一个连续数组
+struct KLineTicks
+{
+    QVector<qint64> time;  // 毫秒时间戳，与KLineColumns::time的约定相同
+    QVector<double> price;
+    QVector<double> size;
+
+    int count() const { return time.size(); }
+    bool isEmpty() const { return time.isEmpty(); }
+
+    void reserve(int n);
+    void clear();
+    void append(qint64 t, double p, double s);
+
+    // 把K线按收盘价和成交量视为逐笔，三列与K线共享数据，不做拷贝
+    static KLineTicks fromBars(const KLineColumns &bars);
+};
+
+Q_DECLARE_METATYPE(KLineTicks)
+
+#endif  // KLINETICKS_H
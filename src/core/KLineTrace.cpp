@@ -0,0 +1,205 @@
+#include "KLineTrace.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QFile>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace KLineTrace {
+
+namespace detail {
+std::atomic<bool> enabled{false};
+}
+
+namespace {
+
+struct Event
+{
+    const char *category;
+    const char *name;
+    const char *detail;
+    qint64 start;
+    qint64 end;
+};
+
+// 第n个事件写在events[n % kThreadCapacity]，written为已写入的事件总数
+struct ThreadBuffer
+{
+    std::unique_ptr<Event[]> events{new Event[kThreadCapacity]};
+    std::atomic<quint64> written{0};
+    int threadId = 0;
+    QString threadName;  // 受Registry::mutex保护
+};
+
+// 线程退出后缓冲区仍保留到进程结束，线程池中已退出线程的事件也能导出。
+// 故意不析构：静态对象析构之后仍可能有线程在退出途中记录事件
+struct Registry
+{
+    QMutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    QHash<QString, QByteArray> strings;
+};
+
+Registry &registry()
+{
+    static Registry *instance = new Registry;
+    return *instance;
+}
+
+ThreadBuffer *currentBuffer()
+{
+    thread_local ThreadBuffer *buffer = nullptr;
+    if (buffer) return buffer;
+
+    auto owned = std::make_unique<ThreadBuffer>();
+    QThread *thread = QThread::currentThread();
+    owned->threadName = thread->objectName();
+    if (owned->threadName.isEmpty() && QCoreApplication::instance() &&
+        thread == QCoreApplication::instance()->thread()) {
+        owned->threadName = QStringLiteral("GUI");
+    }
+
+    Registry &reg = registry();
+    QMutexLocker locker(&reg.mutex);
+    owned->threadId = int(reg.buffers.size()) + 1;
+    if (owned->threadName.isEmpty()) {
+        owned->threadName = QString("Thread %1").arg(owned->threadId);
+    }
+    buffer = owned.get();
+    reg.buffers.push_back(std::move(owned));
+    return buffer;
+}
+
+}  // namespace
+
+void setEnabled(bool enabled)
+{
+    if (enabled && !kCompiledIn) {
+        qDebug() << "KLineTrace: 编译时未启用KLINE_TRACE，追踪不会产生事件";
+    }
+    detail::enabled.store(enabled, std::memory_order_relaxed);
+}
+
+qint64 now()
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+const char *intern(const QString &text)
+{
+    Registry &reg = registry();
+    QMutexLocker locker(&reg.mutex);
+    auto it = reg.strings.find(text);
+    if (it == reg.strings.end()) it = reg.strings.insert(text, text.toUtf8());
+    // QByteArray的数据在堆上，哈希表扩容移动节点时指针不变
+    return it.value().constData();
+}
+
+void setThreadName(const QString &name)
+{
+    ThreadBuffer *buffer = currentBuffer();
+    QMutexLocker locker(&registry().mutex);
+    buffer->threadName = name;
+}
+
+void record(const char *category, const char *name, const char *detail, qint64 start,
+            qint64 end)
+{
+    ThreadBuffer *buffer = currentBuffer();
+    const quint64 n = buffer->written.load(std::memory_order_relaxed);
+    buffer->events[n % kThreadCapacity] = {category, name, detail, start, end};
+    buffer->written.store(n + 1, std::memory_order_release);
+}
+
+QByteArray chromeTraceJson()
+{
+    struct ThreadEvents
+    {
+        int threadId;
+        QString threadName;
+        std::vector<Event> events;
+    };
+    std::vector<ThreadEvents> threads;
+    qint64 origin = std::numeric_limits<qint64>::max();
+
+    {
+        Registry &reg = registry();
+        QMutexLocker locker(&reg.mutex);
+        for (const auto &buffer : reg.buffers) {
+            ThreadEvents thread{buffer->threadId, buffer->threadName, {}};
+            const quint64 end = buffer->written.load(std::memory_order_acquire);
+            const quint64 begin = end > quint64(kThreadCapacity) ? end - kThreadCapacity : 0;
+            for (quint64 i = begin; i < end; ++i) {
+                thread.events.push_back(buffer->events[i % kThreadCapacity]);
+            }
+
+            // 复制期间所属线程可能已经绕回覆盖了开头的事件，这些副本不可信
+            const quint64 after = buffer->written.load(std::memory_order_acquire);
+            const quint64 valid =
+                after > quint64(kThreadCapacity) ? after - kThreadCapacity : 0;
+            if (valid > begin) {
+                const quint64 stale = qMin<quint64>(valid - begin, thread.events.size());
+                thread.events.erase(thread.events.begin(), thread.events.begin() + stale);
+            }
+            for (const Event &event : thread.events) origin = qMin(origin, event.start);
+            threads.push_back(std::move(thread));
+        }
+    }
+
+    // Chrome trace格式：完整事件ph=X，时间单位为微秒；ph=M为线程名元数据
+    const qint64 pid = QCoreApplication::applicationPid();
+    QJsonArray traceEvents;
+    for (const ThreadEvents &thread : threads) {
+        QJsonObject meta;
+        meta["name"] = "thread_name";
+        meta["ph"] = "M";
+        meta["pid"] = pid;
+        meta["tid"] = thread.threadId;
+        meta["args"] = QJsonObject{{"name", thread.threadName}};
+        traceEvents.append(meta);
+
+        for (const Event &event : thread.events) {
+            QJsonObject object;
+            object["name"] = QString::fromUtf8(event.name);
+            object["cat"] = QString::fromUtf8(event.category);
+            object["ph"] = "X";
+            object["ts"] = (event.start - origin) / 1000.0;
+            object["dur"] = (event.end - event.start) / 1000.0;
+            object["pid"] = pid;
+            object["tid"] = thread.threadId;
+            if (event.detail) {
+                object["args"] = QJsonObject{{"detail", QString::fromUtf8(event.detail)}};
+            }
+            traceEvents.append(object);
+        }
+    }
+
+    QJsonObject root;
+    root["traceEvents"] = traceEvents;
+    root["displayTimeUnit"] = "ms";
+    return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+bool exportChromeTrace(const QString &path, QString *error)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        if (error) *error = file.errorString();
+        return false;
+    }
+    file.write(chromeTraceJson());
+    return true;
+}
+
+}  // namespace KLineTrace
@@ -0,0 +1,93 @@
+#ifndef KLINETRACE_H
+#define KLINETRACE_H
+
+#include <QByteArray>
+#include <QString>
+#include <QtGlobal>
+#include <atomic>
+
+// 热路径的作用域追踪。KLINE_TRACE_SCOPE在作用域开始和结束时各取一次时间戳，写入当前线程
+// 自己的环形缓冲区：只有所属线程写入，发布时一次release存储，不加锁。缓冲区写满后覆盖最早的
+// 事件，导出为Chrome trace JSON，用chrome://tracing或ui.perfetto.dev打开。
+//
+// 编译期：未定义KLINE_TRACE时宏展开为空(CMake选项KLINE_ENABLE_TRACE)；
+// 运行期：setEnabled(false)时每个span只读一次原子变量，不取时间戳
+namespace KLineTrace {
+
+// 每个线程缓冲区保留的最近事件数
+constexpr int kThreadCapacity = 1 << 15;
+
+#ifdef KLINE_TRACE
+constexpr bool kCompiledIn = true;
+#else
+constexpr bool kCompiledIn = false;
+#endif
+
+namespace detail {
+extern std::atomic<bool> enabled;
+}
+
+inline bool isEnabled() { return detail::enabled.load(std::memory_order_relaxed); }
+void setEnabled(bool enabled);
+
+// 单调时钟，纳秒
+qint64 now();
+
+// 事件的category/name/detail只保存指针，必须是字符串字面量等静态存储的文本；
+// 运行期生成的文本先经过intern，相同内容返回同一指针，整个进程内有效
+const char *intern(const QString &text);
+
+// 当前线程在导出结果中的名称，缺省取QThread::objectName
+void setThreadName(const QString &name);
+
+void record(const char *category, const char *name, const char *detail, qint64 start,
+            qint64 end);
+
+// 汇总各线程缓冲区。可以在追踪进行中调用，复制过程中被覆盖的事件会被丢弃
+QByteArray chromeTraceJson();
+bool exportChromeTrace(const QString &path, QString *error = nullptr);
+
+class Span
+{
+public:
+    Span(const char *category, const char *name, const char *detail = nullptr)
+        : m_category(category), m_name(name), m_detail(detail), m_start(isEnabled() ? now() : -1)
+    {
+    }
+    Span(const char *category, const char *name, const QString &detail)
+        : Span(category, name, isEnabled() ? intern(detail) : nullptr)
+    {
+    }
+    ~Span()
+    {
+        if (m_start >= 0) record(m_category, m_name, m_detail, m_start, now());
+    }
+
+private:
+    Q_DISABLE_COPY(Span)
+
+    const char *m_category;
+    const char *m_name;
+    const char *m_detail;
+    qint64 m_start;
+};
+
+}  // namespace KLineTrace
+
+#ifdef KLINE_TRACE
+#define KLINE_TRACE_CONCAT_(a, b) a##b
+#define KLINE_TRACE_CONCAT(a, b) KLINE_TRACE_CONCAT_(a, b)
+#define KLINE_TRACE_SCOPE(category, name) \
+    KLineTrace::Span KLINE_TRACE_CONCAT(klineTraceSpan, __LINE__)(category, name)
+#define KLINE_TRACE_SCOPE_DETAIL(category, name, detail) \
+    KLineTrace::Span KLINE_TRACE_CONCAT(klineTraceSpan, __LINE__)(category, name, detail)
+#else
+#define KLINE_TRACE_SCOPE(category, name) \
+    do {                                  \
+    } while (false)
+#define KLINE_TRACE_SCOPE_DETAIL(category, name, detail) \
+    do {                                                 \
+    } while (false)
+#endif
+
+#endif  // KLINETRACE_H
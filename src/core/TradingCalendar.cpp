@@ -0,0 +1,224 @@
+#include "TradingCalendar.h"
+
+#include <QDateTime>
+#include <QDebug>
+#include <QFile>
+#include <QTextStream>
+#include <algorithm>
+#include <limits>
+
+#include "KLineColumns.h"
+
+namespace {
+
+constexpr int kMinutesPerDay = 1440;
+
+struct CalendarTemplate
+{
+    const char *name;
+    const char *timeZone;  // 为空表示不做时区换算
+    bool weekendsClosed;
+    QVector<TradingSession> sessions;
+};
+
+const QVector<CalendarTemplate> &calendarTemplates()
+{
+    static const QVector<CalendarTemplate> templates = {
+        {"24h", "", false, {{0, 1440}}},
+        // A股：09:30-11:30, 13:00-15:00，集合竞价K线并入第一根
+        {"cn_stock", "Asia/Shanghai", true, {{570, 690}, {780, 900}}},
+        // 国内期货：夜盘21:00-23:00属于下一交易日，日盘含10:15-10:30小节休息
+        {"cn_futures", "Asia/Shanghai", true, {{-180, -60}, {540, 615}, {630, 690}, {810, 900}}},
+        // 国内期货（夜盘至次日02:30的品种）
+        {"cn_futures_late",
+         "Asia/Shanghai",
+         true,
+         {{-180, 150}, {540, 615}, {630, 690}, {810, 900}}},
+        {"hk_stock", "Asia/Hong_Kong", true, {{570, 720}, {780, 960}}},
+        {"us_equity", "America/New_York", true, {{570, 960}}},
+    };
+    return templates;
+}
+
+}  // namespace
+
+TradingCalendar::TradingCalendar() : m_name("24h") { setSessions({{0, kMinutesPerDay}}); }
+
+TradingCalendar TradingCalendar::fromTemplate(const QString &name, bool *ok)
+{
+    TradingCalendar calendar;
+    for (const CalendarTemplate &t : calendarTemplates()) {
+        if (name != QLatin1String(t.name)) continue;
+
+        calendar.m_name = name;
+        calendar.setSessions(t.sessions);
+        calendar.setWeekendsClosed(t.weekendsClosed);
+        if (*t.timeZone) calendar.setExchangeTimeZone(QTimeZone(QByteArray(t.timeZone)));
+        if (ok) *ok = true;
+        return calendar;
+    }
+
+    qDebug() << "TradingCalendar: 未知的交易时段模板:" << name;
+    if (ok) *ok = false;
+    return calendar;
+}
+
+QStringList TradingCalendar::templateNames()
+{
+    QStringList names;
+    for (const CalendarTemplate &t : calendarTemplates()) names << QString::fromLatin1(t.name);
+    return names;
+}
+
+bool TradingCalendar::setSessions(const QVector<TradingSession> &sessions)
+{
+    QVector<TradingSession> sorted = sessions;
+    std::sort(sorted.begin(), sorted.end(),
+              [](const TradingSession &a, const TradingSession &b) { return a.start < b.start; });
+
+    // 时段必须互不重叠，且整体跨度不超过一天
+    for (int i = 0; i < sorted.size(); ++i) {
+        if (sorted[i].end <= sorted[i].start) return false;
+        if (i > 0 && sorted[i].start < sorted[i - 1].end) return false;
+    }
+    if (sorted.isEmpty() || sorted.last().end - sorted.first().start > kMinutesPerDay) {
+        return false;
+    }
+
+    m_sessions = sorted;
+    // 交易日窗口从收盘到下一次开盘之间空档的中点开始：空档前半段（收盘价K线、盘后）
+    // 属于刚收盘的交易日，后半段（集合竞价、盘前）属于即将开盘的交易日
+    const int gap = kMinutesPerDay - (sorted.last().end - sorted.first().start);
+    m_spanStart = sorted.first().start - gap / 2;
+
+    // 生成查找表：时段内按累计交易分钟编号；时段外的K线（集合竞价、收盘价K线等）
+    // 并入之前最近的交易分钟，开盘前的并入第一分钟
+    m_minuteTable.resize(kMinutesPerDay);
+    int session = 0;
+    int cumulative = 0;
+    int lastTradingMinute = 0;
+    for (int rel = 0; rel < kMinutesPerDay; ++rel) {
+        const int minute = rel + m_spanStart;
+        while (session < m_sessions.size() && minute >= m_sessions[session].end) {
+            cumulative += m_sessions[session].end - m_sessions[session].start;
+            lastTradingMinute = cumulative - 1;
+            ++session;
+        }
+        if (session < m_sessions.size() && minute >= m_sessions[session].start) {
+            m_minuteTable[rel] = cumulative + (minute - m_sessions[session].start);
+        } else {
+            m_minuteTable[rel] = lastTradingMinute;
+        }
+    }
+    m_tradingMinutes = cumulative;
+    return true;
+}
+
+void TradingCalendar::setDataTimeZone(const QTimeZone &zone)
+{
+    m_dataZone = zone;
+    updateZoneConversion();
+}
+
+void TradingCalendar::setExchangeTimeZone(const QTimeZone &zone)
+{
+    m_exchangeZone = zone;
+    updateZoneConversion();
+}
+
+void TradingCalendar::updateZoneConversion()
+{
+    m_convertZones = m_dataZone.isValid() && m_exchangeZone.isValid() &&
+                     m_dataZone.id() != m_exchangeZone.id();
+}
+
+void TradingCalendar::addHoliday(const QDate &date)
+{
+    if (date.isValid()) {
+        m_holidays.insert(KLineTime::daysFromCivil(date.year(), date.month(), date.day()));
+    }
+}
+
+bool TradingCalendar::loadHolidays(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qDebug() << "TradingCalendar: Failed to open holiday file:" << path << file.errorString();
+        return false;
+    }
+
+    QTextStream in(&file);
+    int count = 0;
+    while (!in.atEnd()) {
+        const QString line = in.readLine().trimmed();
+        if (line.isEmpty() || line.startsWith('#')) continue;
+
+        const QDate date = QDate::fromString(line.left(10), "yyyy-MM-dd");
+        if (!date.isValid()) continue;
+        addHoliday(date);
+        ++count;
+    }
+
+    qDebug() << "TradingCalendar: 载入节假日" << count << "个";
+    return true;
+}
+
+bool TradingCalendar::isTradingDay(qint64 day) const
+{
+    // 1970-01-01是星期四，(day + 3) % 7: 0=周一 ... 5=周六, 6=周日
+    if (m_weekendsClosed && ((day % 7 + 7 + 3) % 7) >= 5) return false;
+    return !m_holidays.contains(day);
+}
+
+qint64 TradingCalendar::nextTradingDay(qint64 day) const
+{
+    if (!m_weekendsClosed && m_holidays.isEmpty()) return day;
+
+    // 周五夜盘、节前夜盘顺延到下一个交易日；最长假期也远小于这个上限
+    for (int i = 0; i < 31 && !isTradingDay(day); ++i) ++day;
+    return day;
+}
+
+qint64 TradingCalendar::localOffsetMs(qint64 naiveDay) const
+{
+    // 用当天正午的偏移代表全天，夏令时切换都发生在凌晨，不影响交易时段
+    const qint64 naiveNoon = naiveDay * KLineTime::kDayMs + KLineTime::kDayMs / 2;
+    const int dataOffset =
+        m_dataZone.offsetFromUtc(QDateTime::fromMSecsSinceEpoch(naiveNoon, QTimeZone::UTC));
+    const qint64 utc = naiveNoon - qint64(dataOffset) * 1000;
+    const int exchangeOffset =
+        m_exchangeZone.offsetFromUtc(QDateTime::fromMSecsSinceEpoch(utc, QTimeZone::UTC));
+    return qint64(exchangeOffset - dataOffset) * 1000;
+}
+
+void TradingCalendar::computeBucketIds(const qint64 *time, int count, int periodMinutes,
+                                       qint64 *bucketIds) const
+{
+    if (periodMinutes <= 0) return;
+
+    const qint32 *table = m_minuteTable.constData();
+    qint64 cachedDay = std::numeric_limits<qint64>::min();
+    qint64 offset = 0;
+    qint64 cachedRawDay = std::numeric_limits<qint64>::min();
+    qint64 tradingDay = 0;
+
+    for (int i = 0; i < count; ++i) {
+        // 时区偏移和交易日顺延按天缓存，绝大多数K线只走下面的整数运算
+        const qint64 naiveDay = KLineTime::floorDiv(time[i], KLineTime::kDayMs);
+        if (naiveDay != cachedDay) {
+            cachedDay = naiveDay;
+            offset = m_convertZones ? localOffsetMs(naiveDay) : 0;
+        }
+
+        const qint64 minute =
+            KLineTime::floorDiv(time[i] + offset, KLineTime::kMinuteMs) - m_spanStart;
+        const qint64 rawDay = KLineTime::floorDiv(minute, kMinutesPerDay);
+        if (rawDay != cachedRawDay) {
+            cachedRawDay = rawDay;
+            tradingDay = nextTradingDay(rawDay);
+        }
+
+        const int rel = int(minute - rawDay * kMinutesPerDay);
+        bucketIds[i] = tradingDay * kMinutesPerDay + table[rel] / periodMinutes;
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef TRADINGCALENDAR_H
+#define TRADINGCALENDAR_H
+
+#include <QDate>
+#include <QMetaType>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QTimeZone>
+#include <QVector>
+
+// 交易时段，单位为相对交易日0点的分钟数。
+// start可以为负：例如期货夜盘21:00开盘记为-180，表示属于下一个交易日。
+struct TradingSession
+{
+    int start;
+    int end;  // 不含
+};
+
+// 交易日历：交易时段模板 + 时区规则 + 节假日表
+//
+// 周期合成时先调用computeBucketIds为每根K线算出周期桶ID，同一ID的K线合成为一根。
+// 桶ID = 交易日序号 * 1440 + 交易日内的第几个交易分钟 / 周期分钟数，
+// 交易分钟来自预先生成的1440项查找表，逐根K线只做整数运算和查表。
+class TradingCalendar
+{
+public:
+    TradingCalendar();  // 全天24小时，不换算时区，与按自然时间对齐的结果一致
+
+    static TradingCalendar fromTemplate(const QString &name, bool *ok = nullptr);
+    static QStringList templateNames();
+
+    QString name() const { return m_name; }
+
+    bool setSessions(const QVector<TradingSession> &sessions);
+    const QVector<TradingSession> &sessions() const { return m_sessions; }
+    int tradingMinutesPerDay() const { return m_tradingMinutes; }
+
+    // K线时间戳所在的时区，默认与交易所时区相同（即数据已是交易所本地时间）
+    void setDataTimeZone(const QTimeZone &zone);
+    void setExchangeTimeZone(const QTimeZone &zone);
+    QTimeZone exchangeTimeZone() const { return m_exchangeZone; }
+
+    void setWeekendsClosed(bool closed) { m_weekendsClosed = closed; }
+    void addHoliday(const QDate &date);
+    // 每行一个日期 yyyy-MM-dd，#开头为注释
+    bool loadHolidays(const QString &path);
+    bool isTradingDay(qint64 day) const;
+
+    void computeBucketIds(const qint64 *time, int count, int periodMinutes,
+                          qint64 *bucketIds) const;
+
+private:
+    void updateZoneConversion();
+    qint64 localOffsetMs(qint64 naiveDay) const;
+    qint64 nextTradingDay(qint64 day) const;
+
+    QString m_name;
+    QVector<TradingSession> m_sessions;
+    int m_spanStart = 0;           // 交易日窗口起点（收盘到开盘空档的中点）
+    QVector<qint32> m_minuteTable;  // 交易日内第几分钟 -> 第几个交易分钟
+    int m_tradingMinutes = 1440;
+
+    QTimeZone m_exchangeZone;
+    QTimeZone m_dataZone;
+    bool m_convertZones = false;
+    bool m_weekendsClosed = false;
+    QSet<qint64> m_holidays;  // 1970-01-01起的天数
+};
+
+Q_DECLARE_METATYPE(TradingCalendar)
+
+#endif  // TRADINGCALENDAR_H
@@ -1,7 +1,7 @@
-#include <ta_libc.h>
-
+#include <QCommandLineParser>
 #include <QDebug>
 #include <QDir>
+#include <QFileInfo>
 #include <QGuiApplication>
 #include <QLoggingCategory>
 #include <QQmlApplicationEngine>
@@ -9,20 +9,169 @@
 #include <QStandardPaths>
 #include <QtQml>
 
+#include "chart/BandSeriesItem.h"
+#include "chart/CandleSeriesItem.h"
+#include "chart/ChartAxisItem.h"
+#include "chart/ChartExporter.h"
+#include "chart/ChartHoverService.h"
+#include "chart/ChartMetrics.h"
+#include "chart/ChartOverviewItem.h"
+#include "chart/ChartRepaintScheduler.h"
+#include "chart/LineSeriesItem.h"
+#include "chart/VolumeSeriesItem.h"
 #include "core/KLineDataProvider.h"
+#include "core/KLineIndicators.h"
+#include "core/KLineMetrics.h"
+#include "core/KLineTrace.h"
+
+namespace {
+
+// 命令行带--export时不创建窗口，直接批量导出图片
+bool isExportMode(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; ++i) {
+        if (qstrcmp(argv[i], "--export") == 0) return true;
+    }
+    return false;
+}
+
+// 命令行option后面的文件名，没有时取环境变量envName
+//   --trace <文件>或KLINE_TRACE_FILE：记录追踪span，退出时写出Chrome trace JSON
+//   --metrics <文件>或KLINE_METRICS_FILE：记录帧时间和延迟直方图，退出时写出JSON
+QString outputPath(int argc, char *argv[], const char *option, const char *envName)
+{
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (qstrcmp(argv[i], option) == 0) return QString::fromLocal8Bit(argv[i + 1]);
+    }
+    return qEnvironmentVariable(envName);
+}
+
+// --float32或环境变量KLINE_FLOAT32=1：数据集带单精度镜像，指标由TA-Lib的TA_S_*版本计算
+bool isSinglePrecision(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; ++i) {
+        if (qstrcmp(argv[i], "--float32") == 0) return true;
+    }
+    return qEnvironmentVariableIntValue("KLINE_FLOAT32") != 0;
+}
+
+void writeTrace(const QString &path)
+{
+    if (path.isEmpty()) return;
+
+    QString error;
+    if (KLineTrace::exportChromeTrace(path, &error)) {
+        qDebug() << "追踪已写出:" << path;
+    } else {
+        qDebug() << "追踪写出失败:" << path << error;
+    }
+}
+
+void writeMetrics(const QString &path)
+{
+    if (path.isEmpty()) return;
+
+    QString error;
+    if (KLineMetrics::exportJson(path, &error)) {
+        qDebug() << "指标已写出:" << path;
+    } else {
+        qDebug() << "指标写出失败:" << path << error;
+    }
+}
+
+// KLineChart --export <目录> [--format png|svg] [--size 宽x高] [--scale 倍数]
+//            [--bars N] [--period 周期] [--indicators MA,BBANDS,...] [--threads N]
+//            [--float32] 文件...
+int runExport(const QCoreApplication &app)
+{
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.addOption({"export", "输出目录", "dir"});
+    parser.addOption({"format", "png或svg", "format", "png"});
+    parser.addOption({"size", "图片逻辑尺寸", "WxH", "1280x720"});
+    parser.addOption({"scale", "PNG的设备像素比", "scale", "1"});
+    parser.addOption({"bars", "视口K线数量，0为全部", "count", "120"});
+    parser.addOption({"period", "K线周期", "period", "1m"});
+    parser.addOption({"indicators", "逗号分隔的指标", "names", "MA"});
+    parser.addOption({"threads", "并行线程数，0为CPU核数", "count", "0"});
+    parser.addOption({"trace", "写出Chrome trace JSON", "file"});
+    parser.addOption({"metrics", "写出耗时直方图JSON", "file"});
+    parser.addOption({"float32", "指标按单精度计算"});
+    parser.addPositionalArgument("files", "CSV或.kla数据文件");
+    parser.process(app);
+
+    const QStringList size = parser.value("size").split('x');
+    ChartExportJob base;
+    base.format = parser.value("format").compare("svg", Qt::CaseInsensitive) == 0
+                      ? ChartExportJob::Svg
+                      : ChartExportJob::Png;
+    if (size.size() == 2) base.size = QSize(size[0].toInt(), size[1].toInt());
+    base.scale = parser.value("scale").toDouble();
+    base.bars = parser.value("bars").toInt();
+    base.period = parser.value("period");
+    base.indicators = parser.value("indicators").split(',', Qt::SkipEmptyParts);
+
+    const QDir outputDir(parser.value("export"));
+    if (!outputDir.exists() && !QDir().mkpath(outputDir.path())) {
+        qDebug() << "无法创建导出目录:" << outputDir.path();
+        return 1;
+    }
+
+    QList<ChartExportJob> jobs;
+    const QString suffix = base.format == ChartExportJob::Svg ? ".svg" : ".png";
+    for (const QString &file : parser.positionalArguments()) {
+        ChartExportJob job = base;
+        job.input = file;
+        job.output = outputDir.filePath(QFileInfo(file).completeBaseName() + "_" + job.period +
+                                        suffix);
+        jobs.append(job);
+    }
+    if (jobs.isEmpty()) {
+        qDebug() << "没有需要导出的数据文件";
+        return 1;
+    }
+
+    const int succeeded = ChartExporter::exportAll(jobs, parser.value("threads").toInt());
+    qDebug() << "导出完成:" << succeeded << "/" << jobs.size();
+    return succeeded == jobs.size() ? 0 : 1;
+}
+
+}  // namespace
 
 int main(int argc, char *argv[])
 {
-    // 初始化TA-Lib
-    TA_RetCode taInitResult = TA_Initialize();
-    if (taInitResult != TA_SUCCESS) {
-        qDebug() << "TA-Lib初始化失败，错误码:" << taInitResult;
-        return -1;
+    KLineMetrics::markStartup();
+
+    // 尽早打开追踪，启动过程也能记录下来
+    const QString tracePath = outputPath(argc, argv, "--trace", "KLINE_TRACE_FILE");
+    KLineTrace::setEnabled(!tracePath.isEmpty());
+    const QString metricsPath = outputPath(argc, argv, "--metrics", "KLINE_METRICS_FILE");
+    if (!metricsPath.isEmpty()) KLineMetrics::retain();
+
+    if (isSinglePrecision(argc, argv)) {
+        KLineIndicators::setPrecision(KLineIndicators::Float);
+        qDebug() << "指标按单精度计算";
+    }
+
+    // TA-Lib在后台线程初始化，与窗口创建和QML加载并行；第一次计算指标前会等待它完成
+    KLineIndicators::initializeAsync();
+
+    // 导出模式使用offscreen平台和软件光栅化，不需要显示器和GPU
+    const bool exportMode = isExportMode(argc, argv);
+    if (exportMode && qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
     }
-    qDebug() << "TA-Lib初始化成功";
 
     QGuiApplication app(argc, argv);
 
+    if (exportMode) {
+        const int exitCode = runExport(app);
+        KLineIndicators::shutdown();
+        writeTrace(tracePath);
+        writeMetrics(metricsPath);
+        return exitCode;
+    }
+
     // 设置Qt Quick Controls样式为Basic，避免原生样式限制
     QQuickStyle::setStyle("Basic");
 
@@ -30,6 +179,15 @@ int main(int argc, char *argv[])
 
     // 注册C++类到QML
     qmlRegisterType<KLineDataProvider>("KLineModule", 1, 0, "KLineDataProvider");
+    qmlRegisterType<ChartRepaintScheduler>("KLineModule", 1, 0, "RepaintScheduler");
+    qmlRegisterType<CandleSeriesItem>("KLineModule", 1, 0, "CandleSeriesItem");
+    qmlRegisterType<VolumeSeriesItem>("KLineModule", 1, 0, "VolumeSeriesItem");
+    qmlRegisterType<LineSeriesItem>("KLineModule", 1, 0, "LineSeriesItem");
+    qmlRegisterType<BandSeriesItem>("KLineModule", 1, 0, "BandSeriesItem");
+    qmlRegisterType<ChartAxisItem>("KLineModule", 1, 0, "ChartAxisItem");
+    qmlRegisterType<ChartHoverService>("KLineModule", 1, 0, "HoverService");
+    qmlRegisterType<ChartOverviewItem>("KLineModule", 1, 0, "ChartOverviewItem");
+    qmlRegisterType<ChartMetrics>("KLineModule", 1, 0, "ChartMetrics");
 
     QQmlApplicationEngine engine;
     QObject::connect(
@@ -47,8 +205,11 @@ int main(int argc, char *argv[])
     int result = app.exec();
 
     // 关闭TA-Lib
-    TA_Shutdown();
+    KLineIndicators::shutdown();
     qDebug() << "TA-Lib已关闭";
 
+    writeTrace(tracePath);
+    writeMetrics(metricsPath);
+
     return result;
 }
@@ -0,0 +1,81 @@
+// KLineArena的容量回收：一次超大的重算把arena撑大后，后续各轮用量持续远小于容量时
+// 应缩回默认大块，用量接近容量时保持不变
+
+#include <QtTest>
+
+#include "core/KLineArena.h"
+
+namespace {
+
+// 一轮重算：在Scope内分配bytes字节，离开时reset
+void round(std::size_t bytes)
+{
+    KLineArena::Scope scope;
+    KLineArena::local().allocate(bytes);
+}
+
+}  // namespace
+
+class KLineArenaTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void growMergesBlocks();
+    void shrinksAfterLowRounds();
+    void keepsCapacityInUse();
+};
+
+void KLineArenaTest::init()
+{
+    // 每个用例从默认大块开始
+    for (int i = 0; i < KLineArena::kRetainRounds; ++i) round(1);
+}
+
+void KLineArenaTest::growMergesBlocks()
+{
+    {
+        KLineArena::Scope scope;
+        KLineArena::local().allocate(1024);
+        KLineArena::local().allocate(8 * KLineArena::kBlockSize);
+    }
+    // 两块合并成一块，下一轮同样的用量不再分配
+    const std::size_t grown = KLineArena::local().capacity();
+    QVERIFY(grown >= 8 * KLineArena::kBlockSize + 1024);
+    round(8 * KLineArena::kBlockSize);
+    QCOMPARE(KLineArena::local().capacity(), grown);
+}
+
+void KLineArenaTest::shrinksAfterLowRounds()
+{
+    round(16 * KLineArena::kBlockSize);
+    const std::size_t grown = KLineArena::local().capacity();
+    QVERIFY(grown > KLineArena::kBlockSize);
+
+    for (int i = 0; i < KLineArena::kRetainRounds - 1; ++i) round(4096);
+    QCOMPARE(KLineArena::local().capacity(), grown);
+    round(4096);
+    QCOMPARE(KLineArena::local().capacity(), KLineArena::kBlockSize);
+    // 历史峰值仍然可查
+    QVERIFY(KLineArena::local().peak() >= 16 * KLineArena::kBlockSize);
+}
+
+void KLineArenaTest::keepsCapacityInUse()
+{
+    round(16 * KLineArena::kBlockSize);
+    const std::size_t grown = KLineArena::local().capacity();
+
+    // 用量在容量的1/kShrinkRatio以上时一直保留
+    for (int i = 0; i < 2 * KLineArena::kRetainRounds; ++i) round(8 * KLineArena::kBlockSize);
+    QCOMPARE(KLineArena::local().capacity(), grown);
+
+    // 中间夹一轮大用量，低用量轮数重新计数
+    for (int i = 0; i < KLineArena::kRetainRounds - 1; ++i) round(4096);
+    round(8 * KLineArena::kBlockSize);
+    for (int i = 0; i < KLineArena::kRetainRounds - 1; ++i) round(4096);
+    QCOMPARE(KLineArena::local().capacity(), grown);
+}
+
+QTEST_APPLESS_MAIN(KLineArenaTest)
+#include "tst_KLineArena.moc"
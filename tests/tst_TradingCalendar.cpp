@@ -0,0 +1,94 @@
+// TradingCalendar的周期分桶：时段外的K线（集合竞价、午休边界、收盘价K线、夜盘开盘前）
+// 应并入同一交易日最近的交易分钟，不能跨到前一个交易日
+
+#include <QtTest>
+
+#include "core/KLineColumns.h"
+#include "core/TradingCalendar.h"
+
+namespace {
+
+qint64 bucketId(const TradingCalendar &calendar, const QString &time, int periodMinutes)
+{
+    const qint64 t = KLineTime::parse(time);
+    qint64 id = 0;
+    calendar.computeBucketIds(&t, 1, periodMinutes, &id);
+    return id;
+}
+
+qint64 dayOf(const QString &date)
+{
+    const QDate d = QDate::fromString(date, "yyyy-MM-dd");
+    return KLineTime::daysFromCivil(d.year(), d.month(), d.day());
+}
+
+}  // namespace
+
+class TradingCalendarTest : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void cnStockBoundaries_data();
+    void cnStockBoundaries();
+    void cnFuturesNightAuction();
+    void usEquityPreMarket();
+};
+
+void TradingCalendarTest::cnStockBoundaries_data()
+{
+    QTest::addColumn<QString>("time");
+    QTest::addColumn<int>("period");
+    QTest::addColumn<int>("expected");  // 2024-01-02（周二）的第几个周期桶
+
+    // A股每日240个交易分钟：上午0~119，下午120~239
+    const QList<QPair<QString, QVector<int>>> rows = {
+        {"09:25", {0, 0, 0}},  // 集合竞价并入开盘第一根
+        {"09:30", {0, 0, 0}},
+        {"11:30", {119, 3, 0}},  // 上午收盘K线并入11:00-11:30
+        {"15:00", {239, 7, 0}},  // 收盘K线并入14:30-15:00
+    };
+    const QVector<int> periods = {1, 30, 1440};
+    for (const auto &row : rows) {
+        for (int i = 0; i < periods.size(); ++i) {
+            const QByteArray tag = (row.first + " " + QString::number(periods[i]) + "m").toUtf8();
+            QTest::newRow(tag.constData())
+                << "2024-01-02 " + row.first << periods[i] << row.second[i];
+        }
+    }
+}
+
+void TradingCalendarTest::cnStockBoundaries()
+{
+    QFETCH(QString, time);
+    QFETCH(int, period);
+    QFETCH(int, expected);
+
+    const TradingCalendar calendar = TradingCalendar::fromTemplate("cn_stock");
+    QCOMPARE(bucketId(calendar, time, period), dayOf("2024-01-02") * 1440 + expected);
+}
+
+void TradingCalendarTest::cnFuturesNightAuction()
+{
+    const TradingCalendar calendar = TradingCalendar::fromTemplate("cn_futures");
+    // 周一20:59的集合竞价与21:00开盘同属周二交易日的第一根
+    QCOMPARE(bucketId(calendar, "2024-01-01 20:59", 1), dayOf("2024-01-02") * 1440);
+    QCOMPARE(bucketId(calendar, "2024-01-01 21:00", 1), dayOf("2024-01-02") * 1440);
+    // 周五夜盘顺延到下周一
+    QCOMPARE(bucketId(calendar, "2024-01-05 20:59", 1), dayOf("2024-01-08") * 1440);
+    // 周一15:00收盘K线仍属周一
+    QCOMPARE(bucketId(calendar, "2024-01-01 15:00", 1440), dayOf("2024-01-01") * 1440);
+}
+
+void TradingCalendarTest::usEquityPreMarket()
+{
+    const TradingCalendar calendar = TradingCalendar::fromTemplate("us_equity");
+    // 盘前并入当天开盘第一根，盘后并入当天最后一根
+    QCOMPARE(bucketId(calendar, "2024-01-02 08:00", 1), dayOf("2024-01-02") * 1440);
+    QCOMPARE(bucketId(calendar, "2024-01-02 17:00", 1), dayOf("2024-01-02") * 1440 + 389);
+    QCOMPARE(bucketId(calendar, "2024-01-02 08:00", 1440),
+             bucketId(calendar, "2024-01-02 15:59", 1440));
+}
+
+QTEST_APPLESS_MAIN(TradingCalendarTest)
+#include "tst_TradingCalendar.moc"
@@ -146,6 +146,25 @@ TA_LIB_API void TA_SetRetCodeInfo( TA_RetCode theRetCode, TA_RetCodeInfo *retCod
 TA_LIB_API TA_RetCode TA_Initialize( void );
 TA_LIB_API TA_RetCode TA_Shutdown( void );
 
+/* TA_SetScratchAllocator() installs, for the calling thread only, the
+ * allocator used for the temporary arrays that some functions allocate
+ * internally (MACD, STOCH, ADXR, TEMA, MA with some MA types...).
+ *
+ * This lets a caller serve these temporaries from its own scratch memory
+ * (e.g. an arena that is reset after each recompute) instead of the heap.
+ *
+ * The memory returned by allocFunc must be aligned for a double. A NULL
+ * return makes the function fail with TA_ALLOC_ERR. freeFunc may be NULL
+ * when the caller releases the memory in bulk. Passing NULL as allocFunc
+ * restores malloc/free.
+ */
+typedef void *(*TA_ScratchAllocFunc)( size_t size, void *opaque );
+typedef void  (*TA_ScratchFreeFunc)( void *ptr, void *opaque );
+
+TA_LIB_API void TA_SetScratchAllocator( TA_ScratchAllocFunc allocFunc,
+                                        TA_ScratchFreeFunc freeFunc,
+                                        void *opaque );
+
 /* TA_LIB_SOURCES_DIGEST helps for TA-Lib automated maintenance.
  *
  * This value is updated whenever a make, cmake or any source files
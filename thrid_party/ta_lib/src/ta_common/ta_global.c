@@ -63,6 +63,7 @@
 #include "ta_magic_nb.h"
 #include "ta_global.h"
 #include "ta_func.h"
+#include "ta_memory.h"
 
 /**** External functions declarations. ****/
 /* None */
@@ -78,13 +79,23 @@ TA_LibcPriv ta_theGlobals = {0,{{0,0,0}},0,0,0,0,(TA_Compatibility)0,{0},{{(TA_C
 TA_LibcPriv *TA_Globals = &ta_theGlobals;
 
 /**** Local declarations.              ****/
-/* None */
+#if defined( _MSC_VER )
+   #define TA_THREAD_LOCAL __declspec(thread)
+#elif defined( __STDC_VERSION__ ) && (__STDC_VERSION__ >= 201112L)
+   #define TA_THREAD_LOCAL _Thread_local
+#else
+   #define TA_THREAD_LOCAL __thread
+#endif
 
 /**** Local functions declarations.    ****/
 /* None */
 
 /**** Local variables definitions.     ****/
-/* None */
+
+/* Scratch allocator of the calling thread, see TA_SetScratchAllocator(). */
+static TA_THREAD_LOCAL TA_ScratchAllocFunc ta_scratchAlloc = NULL;
+static TA_THREAD_LOCAL TA_ScratchFreeFunc  ta_scratchFree  = NULL;
+static TA_THREAD_LOCAL void               *ta_scratchOpaque = NULL;
 
 /**** Global functions definitions.   ****/
 TA_RetCode TA_Initialize( void )
@@ -114,6 +125,33 @@ TA_RetCode TA_Shutdown( void )
    return TA_SUCCESS;
 }
 
+void TA_SetScratchAllocator( TA_ScratchAllocFunc allocFunc,
+                             TA_ScratchFreeFunc freeFunc,
+                             void *opaque )
+{
+   ta_scratchAlloc  = allocFunc;
+   ta_scratchFree   = allocFunc? freeFunc : NULL;
+   ta_scratchOpaque = allocFunc? opaque : NULL;
+}
+
+void *TA_ScratchMalloc( size_t size )
+{
+   if( ta_scratchAlloc )
+      return ta_scratchAlloc( size, ta_scratchOpaque );
+   return TA_Malloc( size );
+}
+
+void TA_ScratchFree( void *ptr )
+{
+   if( ta_scratchAlloc )
+   {
+      if( ta_scratchFree )
+         ta_scratchFree( ptr, ta_scratchOpaque );
+      return;
+   }
+   TA_Free( ptr );
+}
+
 TA_RetCode TA_SetCandleSettings( TA_CandleSettingType settingType,
                                  TA_RangeType rangeType,
                                  int avgPeriod,
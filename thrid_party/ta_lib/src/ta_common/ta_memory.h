@@ -15,6 +15,13 @@
 
    #define FREE_IF_NOT_NULL(x) { if((x)!=NULL) {TA_Free((void *)(x)); (x)=NULL;} }
 
+   /* Temporary arrays of the TA functions (ARRAY_ALLOC and the heap
+    * fallback of CIRCBUF) come from the allocator installed with
+    * TA_SetScratchAllocator() for the calling thread, malloc/free otherwise.
+    */
+   void *TA_ScratchMalloc( size_t size );
+   void  TA_ScratchFree( void *ptr );
+
 #endif /* !defined(_MANAGED) && !defined( _JAVA ) && !defined( _RUST )*/
 
 
@@ -56,11 +63,11 @@
 #else
    #define ARRAY_VTYPE_REF(type,name)             type *name
    #define ARRAY_VTYPE_LOCAL(type,name,size)      type name[size]
-   #define ARRAY_VTYPE_ALLOC(type,name,size)      name = (type *)TA_Malloc( sizeof(type)*(size))
+   #define ARRAY_VTYPE_ALLOC(type,name,size)      name = (type *)TA_ScratchMalloc( sizeof(type)*(size))
    #define ARRAY_VTYPE_COPY(type,dest,src,size)   memcpy(dest,src,sizeof(type)*(size))
    #define ARRAY_VTYPE_MEMMOVE(type,dest,destIdx,src,srcIdx,size) memmove( &dest[destIdx], &src[srcIdx], (size)*sizeof(type) )
-   #define ARRAY_VTYPE_FREE(type,name)            TA_Free(name)
-   #define ARRAY_VTYPE_FREE_COND(type,cond,name)  if( cond ){ TA_Free(name); }
+   #define ARRAY_VTYPE_FREE(type,name)            TA_ScratchFree(name)
+   #define ARRAY_VTYPE_FREE_COND(type,cond,name)  if( cond ){ TA_ScratchFree(name); }
 #endif
 
 /* ARRAY : Macros to manipulate arrays of double. */
@@ -320,7 +327,7 @@
          return TA_INTERNAL_ERROR(137); \
       if( (int)Size > (int)(sizeof(local_##Id)/sizeof(Type)) ) \
       { \
-         Id = TA_Malloc( sizeof(Type)*Size ); \
+         Id = TA_ScratchMalloc( sizeof(Type)*Size ); \
          if( !Id ) \
             return TA_ALLOC_ERR; \
       } \
@@ -342,7 +349,7 @@
 #define CIRCBUF_DESTROY(Id) \
    { \
       if( Id != &local_##Id[0] ) \
-         TA_Free( Id ); \
+         TA_ScratchFree( Id ); \
    }
 
 /* Use this macro to access the member when Type is a class or a struct. */
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""Generate ta_frame_s.c, the single precision counterpart of ta_frame.c.
+
+ta_frame.c (generated by gen_code) maps a TA_ParamHolderPriv onto every
+double precision TA_XXX function so that TA_CallFunc can call them through
+the abstract interface. There is no equivalent for the TA_S_XXX variants.
+
+This script rewrites each TA_XXX_FramePP into a TA_S_XXX_FramePP that
+reinterprets the input pointers stored in the param holder as float arrays,
+and emits a table indexed by function name for ta_bench.
+
+Usage (from the ta-lib root):
+    python3 src/tools/ta_bench/gen_frame_s.py
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", "..", ".."))
+SOURCE = os.path.join(ROOT, "src", "ta_abstract", "frames", "ta_frame.c")
+TARGET = os.path.join(ROOT, "src", "tools", "ta_bench", "ta_frame_s.c")
+
+FRAME_RE = re.compile(
+    r"TA_RetCode TA_(\w+)_FramePP\(.*?\n\{\n(.*?)\n\}", re.DOTALL)
+INPUT_RE = re.compile(r"(params->in\[\d+\]\.data\.(?:inReal|inPrice\.\w+))")
+
+HEADER = """/* Note: This file is generated by gen_frame_s.py, do not
+ *       modify directly.
+ */
+
+/* Single precision frames for ta_bench: same as ta_frame.c but calling
+ * TA_S_XXX. The input pointers in the param holder point to float arrays
+ * and are cast back before the call.
+ */
+
+#include "ta_func.h"
+#include "ta_frame_priv.h"
+#include "ta_frame_s.h"
+
+"""
+
+
+def main():
+    with open(SOURCE, encoding="utf-8") as f:
+        text = "".join(line.replace("/* Generated */ ", "", 1) for line in f)
+
+    names = []
+    out = [HEADER]
+    for match in FRAME_RE.finditer(text):
+        name, body = match.group(1), match.group(2)
+        body = body.replace("return TA_%s(" % name, "return TA_S_%s(" % name, 1)
+        body = INPUT_RE.sub(r"(const float *)\1", body)
+        out.append("static TA_RetCode TA_S_%s_FramePP( const TA_ParamHolderPriv *params,\n"
+                   "                                 int startIdx,\n"
+                   "                                 int endIdx,\n"
+                   "                                 int *outBegIdx,\n"
+                   "                                 int *outNBElement )\n"
+                   "{\n%s\n}\n\n" % (name, body))
+        names.append(name)
+
+    if not names:
+        sys.exit("no frame found in " + SOURCE)
+
+    out.append("const TA_FrameS TA_FramesS[] =\n{\n")
+    for name in names:
+        out.append("   { \"%s\", TA_S_%s_FramePP },\n" % (name, name))
+    out.append("};\n\nconst unsigned int TA_FramesSCount = %d;\n" % len(names))
+
+    with open(TARGET, "w", encoding="utf-8", newline="\n") as f:
+        f.write("".join(out))
+    print("%d frames written to %s" % (len(names), TARGET))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,524 @@
+/* TA-LIB Copyright (c) 1999-2024, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Description:
+ *    Per-function micro-benchmark of the TA-LIB.
+ *
+ *    Every function is enumerated with TA_ForEachFunc and called through
+ *    the abstract interface with its default optional inputs, once on
+ *    double inputs (TA_XXX through TA_CallFunc) and once on float inputs
+ *    (TA_S_XXX through the frames generated by gen_frame_s.py).
+ *
+ *    For each function the following is reported:
+ *       ns/element    median time of one call divided by the number of
+ *                     input elements.
+ *       bytes/element bytes read from the inputs and written to the
+ *                     outputs for each element.
+ *       lookback      the lookback with the default optional inputs, the
+ *                     share of the input it consumes without producing an
+ *                     output and the cost of TA_GetLookback itself.
+ *
+ * Usage:
+ *    ta_bench [-n nbElement] [-t minSecondsPerFunc] [-f funcName]
+ *             [-o result.json]
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef WIN32
+   #include <windows.h>
+#else
+   #include <time.h>
+#endif
+
+#include "ta_libc.h"
+#include "ta_frame_priv.h"
+#include "ta_frame_s.h"
+
+/**** Local declarations. ****/
+#define MAX_SAMPLES   4096
+#define MAX_INPUTS    8
+#define MAX_OUTPUTS   8
+#define MIN_CALLS     3
+#define LOOKBACK_REPS 10000
+
+typedef struct
+{
+   int nbElement;
+   double minSeconds;
+   const char *filter;
+
+   /* Input data, the float arrays hold the same values. */
+   double *open, *high, *low, *close, *volume, *openInterest, *periods;
+   float *openS, *highS, *lowS, *closeS, *volumeS, *openInterestS, *periodsS;
+   int *integers;
+
+   /* One buffer for each possible output, reused for every function. */
+   double *outReal[MAX_OUTPUTS];
+   int *outInteger[MAX_OUTPUTS];
+
+   double samples[MAX_SAMPLES];
+
+   FILE *json;
+   int nbFunction;
+   int nbFailed;
+} BenchContext;
+
+typedef struct
+{
+   int ok;
+   double nsPerElement;
+   double bytesPerElement;
+} BenchTiming;
+
+/**** Local functions. ****/
+static double now( void )
+{
+#ifdef WIN32
+   LARGE_INTEGER frequency, counter;
+   QueryPerformanceFrequency( &frequency );
+   QueryPerformanceCounter( &counter );
+   return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+   struct timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+static int compareDouble( const void *a, const void *b )
+{
+   const double x = *(const double *)a;
+   const double y = *(const double *)b;
+   return (x > y) - (x < y);
+}
+
+static double median( double *samples, int nbSample )
+{
+   qsort( samples, (size_t)nbSample, sizeof(double), compareDouble );
+   return samples[nbSample/2];
+}
+
+static void *allocOrDie( size_t size )
+{
+   void *ptr = malloc( size );
+   if( !ptr )
+   {
+      fprintf( stderr, "ta_bench: out of memory\n" );
+      exit( 1 );
+   }
+   return ptr;
+}
+
+/* Deterministic random walk, the same on every platform. */
+static void initData( BenchContext *ctx )
+{
+   unsigned int seed = 12345;
+   double price = 100.0;
+   int i, j, n = ctx->nbElement;
+
+   ctx->open          = allocOrDie( n*sizeof(double) );
+   ctx->high          = allocOrDie( n*sizeof(double) );
+   ctx->low           = allocOrDie( n*sizeof(double) );
+   ctx->close         = allocOrDie( n*sizeof(double) );
+   ctx->volume        = allocOrDie( n*sizeof(double) );
+   ctx->openInterest  = allocOrDie( n*sizeof(double) );
+   ctx->periods       = allocOrDie( n*sizeof(double) );
+   ctx->openS         = allocOrDie( n*sizeof(float) );
+   ctx->highS         = allocOrDie( n*sizeof(float) );
+   ctx->lowS          = allocOrDie( n*sizeof(float) );
+   ctx->closeS        = allocOrDie( n*sizeof(float) );
+   ctx->volumeS       = allocOrDie( n*sizeof(float) );
+   ctx->openInterestS = allocOrDie( n*sizeof(float) );
+   ctx->periodsS      = allocOrDie( n*sizeof(float) );
+   ctx->integers      = allocOrDie( n*sizeof(int) );
+
+   for( i=0; i < n; i++ )
+   {
+      double r1, r2, r3;
+      seed = seed*1103515245u + 12345u; r1 = (double)((seed>>8)&0xFFFF)/65536.0;
+      seed = seed*1103515245u + 12345u; r2 = (double)((seed>>8)&0xFFFF)/65536.0;
+      seed = seed*1103515245u + 12345u; r3 = (double)((seed>>8)&0xFFFF)/65536.0;
+
+      ctx->open[i]  = price;
+      price *= 1.0 + (r1-0.5)*0.004;
+      ctx->close[i] = price;
+      ctx->high[i]  = (ctx->open[i] > price ? ctx->open[i] : price)*(1.0 + r2*0.002);
+      ctx->low[i]   = (ctx->open[i] < price ? ctx->open[i] : price)*(1.0 - r3*0.002);
+      ctx->volume[i] = 1000.0 + floor( r2*9000.0 );
+      ctx->openInterest[i] = 50000.0 + floor( r3*1000.0 );
+      ctx->periods[i] = 2.0 + (double)(i%29);
+      ctx->integers[i] = i%100;
+
+      ctx->openS[i]  = (float)ctx->open[i];
+      ctx->highS[i]  = (float)ctx->high[i];
+      ctx->lowS[i]   = (float)ctx->low[i];
+      ctx->closeS[i] = (float)ctx->close[i];
+      ctx->volumeS[i] = (float)ctx->volume[i];
+      ctx->openInterestS[i] = (float)ctx->openInterest[i];
+      ctx->periodsS[i] = (float)ctx->periods[i];
+   }
+
+   for( j=0; j < MAX_OUTPUTS; j++ )
+   {
+      ctx->outReal[j]    = allocOrDie( n*sizeof(double) );
+      ctx->outInteger[j] = allocOrDie( n*sizeof(int) );
+   }
+}
+
+static void freeData( BenchContext *ctx )
+{
+   int j;
+   free( ctx->open ); free( ctx->high ); free( ctx->low ); free( ctx->close );
+   free( ctx->volume ); free( ctx->openInterest ); free( ctx->periods );
+   free( ctx->openS ); free( ctx->highS ); free( ctx->lowS ); free( ctx->closeS );
+   free( ctx->volumeS ); free( ctx->openInterestS ); free( ctx->periodsS );
+   free( ctx->integers );
+   for( j=0; j < MAX_OUTPUTS; j++ )
+   {
+      free( ctx->outReal[j] );
+      free( ctx->outInteger[j] );
+   }
+}
+
+static int countPriceArrays( TA_InputFlags flags )
+{
+   int count = 0;
+   if( flags & TA_IN_PRICE_OPEN )         count++;
+   if( flags & TA_IN_PRICE_HIGH )         count++;
+   if( flags & TA_IN_PRICE_LOW )          count++;
+   if( flags & TA_IN_PRICE_CLOSE )        count++;
+   if( flags & TA_IN_PRICE_VOLUME )       count++;
+   if( flags & TA_IN_PRICE_OPENINTEREST ) count++;
+   return count;
+}
+
+/* Point every input of the param holder to the double or float arrays.
+ * Returns the number of bytes read per element, or -1 on failure.
+ */
+static int setInputs( BenchContext *ctx, const TA_FuncInfo *info,
+                      TA_ParamHolder *params, int useFloat )
+{
+   const TA_InputParameterInfo *inInfo;
+   const size_t realSize = useFloat ? sizeof(float) : sizeof(double);
+   unsigned int i;
+   int bytes = 0;
+
+   /* The float arrays are stored in place of the TA_Real pointers, the
+    * frames of ta_frame_s.c cast them back.
+    */
+   #define REAL_PTR(name) (useFloat ? (const TA_Real *)ctx->name##S : ctx->name)
+
+   for( i=0; i < info->nbInput; i++ )
+   {
+      if( TA_GetInputParameterInfo( info->handle, i, &inInfo ) != TA_SUCCESS )
+         return -1;
+
+      switch( inInfo->type )
+      {
+      case TA_Input_Price:
+         if( TA_SetInputParamPricePtr( params, i,
+                                       REAL_PTR(open), REAL_PTR(high), REAL_PTR(low),
+                                       REAL_PTR(close), REAL_PTR(volume),
+                                       REAL_PTR(openInterest) ) != TA_SUCCESS )
+            return -1;
+         bytes += countPriceArrays( inInfo->flags )*(int)realSize;
+         break;
+      case TA_Input_Real:
+         if( TA_SetInputParamRealPtr( params, i,
+                                      strcmp( inInfo->paramName, "inPeriods" ) == 0 ?
+                                      REAL_PTR(periods) : REAL_PTR(close) ) != TA_SUCCESS )
+            return -1;
+         bytes += (int)realSize;
+         break;
+      case TA_Input_Integer:
+         if( TA_SetInputParamIntegerPtr( params, i, ctx->integers ) != TA_SUCCESS )
+            return -1;
+         bytes += (int)sizeof(int);
+         break;
+      default:
+         return -1;
+      }
+   }
+
+   #undef REAL_PTR
+   return bytes;
+}
+
+/* Returns the number of bytes written per element, or -1 on failure. */
+static int setOutputs( BenchContext *ctx, const TA_FuncInfo *info, TA_ParamHolder *params )
+{
+   const TA_OutputParameterInfo *outInfo;
+   unsigned int i;
+   int bytes = 0;
+
+   if( info->nbOutput > MAX_OUTPUTS )
+      return -1;
+
+   for( i=0; i < info->nbOutput; i++ )
+   {
+      if( TA_GetOutputParameterInfo( info->handle, i, &outInfo ) != TA_SUCCESS )
+         return -1;
+
+      if( outInfo->type == TA_Output_Real )
+      {
+         if( TA_SetOutputParamRealPtr( params, i, ctx->outReal[i] ) != TA_SUCCESS )
+            return -1;
+         bytes += (int)sizeof(double);
+      }
+      else
+      {
+         if( TA_SetOutputParamIntegerPtr( params, i, ctx->outInteger[i] ) != TA_SUCCESS )
+            return -1;
+         bytes += (int)sizeof(int);
+      }
+   }
+   return bytes;
+}
+
+static const TA_FrameS *findFrameS( const char *name )
+{
+   unsigned int i;
+   for( i=0; i < TA_FramesSCount; i++ )
+   {
+      if( strcmp( TA_FramesS[i].name, name ) == 0 )
+         return &TA_FramesS[i];
+   }
+   return NULL;
+}
+
+/* Repeat the call until both MIN_CALLS and ctx->minSeconds are reached,
+ * returns the median time of one call in seconds.
+ */
+static BenchTiming timeCalls( BenchContext *ctx, TA_ParamHolder *params,
+                              const TA_FrameS *frameS, int bytesPerElement )
+{
+   BenchTiming timing;
+   int nbSample = 0;
+   double start = now();
+   int outBegIdx, outNBElement;
+   TA_RetCode retCode;
+
+   timing.ok = 0;
+   timing.nsPerElement = 0.0;
+   timing.bytesPerElement = (double)bytesPerElement;
+
+   while( nbSample < MAX_SAMPLES &&
+          (nbSample < MIN_CALLS || now()-start < ctx->minSeconds) )
+   {
+      double t0 = now();
+      if( frameS )
+         retCode = frameS->function( (const TA_ParamHolderPriv *)params->hiddenData,
+                                     0, ctx->nbElement-1, &outBegIdx, &outNBElement );
+      else
+         retCode = TA_CallFunc( params, 0, ctx->nbElement-1, &outBegIdx, &outNBElement );
+      ctx->samples[nbSample++] = now()-t0;
+
+      if( retCode != TA_SUCCESS )
+         return timing;
+   }
+
+   timing.ok = 1;
+   timing.nsPerElement = median( ctx->samples, nbSample )*1e9/ctx->nbElement;
+   return timing;
+}
+
+static void writeJsonTiming( FILE *out, const char *key, BenchTiming timing )
+{
+   if( timing.ok )
+      fprintf( out, "\"%s\": {\"ns_per_element\": %.4f, \"bytes_per_element\": %.0f, "
+                    "\"elements_per_second\": %.0f}",
+               key, timing.nsPerElement, timing.bytesPerElement,
+               timing.nsPerElement > 0.0 ? 1e9/timing.nsPerElement : 0.0 );
+   else
+      fprintf( out, "\"%s\": null", key );
+}
+
+static void benchFunction( const TA_FuncInfo *info, void *opaqueData )
+{
+   BenchContext *ctx = (BenchContext *)opaqueData;
+   TA_ParamHolder *params = NULL;
+   const TA_FrameS *frameS;
+   BenchTiming timingD, timingS;
+   TA_Integer lookback = 0;
+   double lookbackNs, start;
+   int inBytesD, inBytesS, outBytes, i;
+
+   if( ctx->filter && strcmp( ctx->filter, info->name ) != 0 )
+      return;
+
+   timingD.ok = timingS.ok = 0;
+   timingD.nsPerElement = timingS.nsPerElement = 0.0;
+   timingD.bytesPerElement = timingS.bytesPerElement = 0.0;
+
+   if( TA_ParamHolderAlloc( info->handle, &params ) != TA_SUCCESS )
+   {
+      fprintf( stderr, "ta_bench: %s: TA_ParamHolderAlloc failed\n", info->name );
+      ctx->nbFailed++;
+      return;
+   }
+
+   /* Optional inputs keep the defaults set by TA_ParamHolderAlloc. */
+   outBytes = setOutputs( ctx, info, params );
+   inBytesD = setInputs( ctx, info, params, 0 );
+   if( outBytes >= 0 && inBytesD >= 0 )
+      timingD = timeCalls( ctx, params, NULL, inBytesD+outBytes );
+
+   /* The lookback depends only on the optional inputs. */
+   lookbackNs = 0.0;
+   if( TA_GetLookback( params, &lookback ) == TA_SUCCESS )
+   {
+      start = now();
+      for( i=0; i < LOOKBACK_REPS; i++ )
+         TA_GetLookback( params, &lookback );
+      lookbackNs = (now()-start)*1e9/LOOKBACK_REPS;
+   }
+
+   frameS = findFrameS( info->name );
+   inBytesS = setInputs( ctx, info, params, 1 );
+   if( frameS && outBytes >= 0 && inBytesS >= 0 )
+      timingS = timeCalls( ctx, params, frameS, inBytesS+outBytes );
+
+   TA_ParamHolderFree( params );
+
+   if( !timingD.ok || !timingS.ok )
+      ctx->nbFailed++;
+
+   printf( "%-20s %-22.22s %10.3f %10.3f %6.0f %6.0f %8d %7.2f%% %9.1f\n",
+           info->name, info->group,
+           timingD.nsPerElement, timingS.nsPerElement,
+           timingD.bytesPerElement, timingS.bytesPerElement,
+           lookback, 100.0*lookback/ctx->nbElement, lookbackNs );
+
+   if( ctx->json )
+   {
+      fprintf( ctx->json, "%s\n    {\"name\": \"%s\", \"group\": \"%s\", "
+                          "\"inputs\": %u, \"outputs\": %u, ",
+               ctx->nbFunction ? "," : "", info->name, info->group,
+               info->nbInput, info->nbOutput );
+      writeJsonTiming( ctx->json, "double", timingD );
+      fprintf( ctx->json, ", " );
+      writeJsonTiming( ctx->json, "float", timingS );
+      fprintf( ctx->json, ", \"lookback\": %d, \"lookback_fraction\": %.6f, "
+                          "\"lookback_ns\": %.2f}",
+               lookback, (double)lookback/ctx->nbElement, lookbackNs );
+   }
+   ctx->nbFunction++;
+}
+
+static void printUsage( void )
+{
+   printf( "Usage: ta_bench [-n nbElement] [-t minSecondsPerFunc] [-f funcName] [-o result.json]\n" );
+}
+
+int main( int argc, char **argv )
+{
+   BenchContext ctx;
+   const char *jsonPath = NULL;
+   TA_RetCode retCode;
+   int i;
+
+   memset( &ctx, 0, sizeof(ctx) );
+   ctx.nbElement = 10000;
+   ctx.minSeconds = 0.05;
+
+   for( i=1; i < argc; i++ )
+   {
+      if( strcmp( argv[i], "-n" ) == 0 && i+1 < argc )
+         ctx.nbElement = atoi( argv[++i] );
+      else if( strcmp( argv[i], "-t" ) == 0 && i+1 < argc )
+         ctx.minSeconds = atof( argv[++i] );
+      else if( strcmp( argv[i], "-f" ) == 0 && i+1 < argc )
+         ctx.filter = argv[++i];
+      else if( strcmp( argv[i], "-o" ) == 0 && i+1 < argc )
+         jsonPath = argv[++i];
+      else
+      {
+         printUsage();
+         return strcmp( argv[i], "-h" ) == 0 ? 0 : 1;
+      }
+   }
+
+   if( ctx.nbElement < 1 )
+   {
+      printUsage();
+      return 1;
+   }
+
+   retCode = TA_Initialize();
+   if( retCode != TA_SUCCESS )
+   {
+      fprintf( stderr, "ta_bench: TA_Initialize failed [%d]\n", retCode );
+      return 1;
+   }
+
+   initData( &ctx );
+
+   if( jsonPath )
+   {
+      ctx.json = fopen( jsonPath, "w" );
+      if( !ctx.json )
+      {
+         fprintf( stderr, "ta_bench: cannot write %s\n", jsonPath );
+         freeData( &ctx );
+         TA_Shutdown();
+         return 1;
+      }
+      fprintf( ctx.json, "{\n  \"context\": {\"library\": \"TA-Lib %s\", "
+                         "\"nb_element\": %d, \"min_seconds\": %g},\n  \"functions\": [",
+               TA_GetVersionString(), ctx.nbElement, ctx.minSeconds );
+   }
+
+   printf( "TA-Lib %s, %d elements per call\n", TA_GetVersionString(), ctx.nbElement );
+   printf( "%-20s %-22s %10s %10s %6s %6s %8s %8s %9s\n",
+           "function", "group", "ns/el TA_", "ns/el TA_S", "B/el", "B/el S",
+           "lookback", "lb %", "lb ns" );
+
+   TA_ForEachFunc( benchFunction, &ctx );
+
+   if( ctx.json )
+   {
+      fprintf( ctx.json, "\n  ]\n}\n" );
+      fclose( ctx.json );
+   }
+
+   printf( "%d functions, %d failed\n", ctx.nbFunction, ctx.nbFailed );
+
+   freeData( &ctx );
+   TA_Shutdown();
+   return ctx.nbFailed ? 1 : 0;
+}
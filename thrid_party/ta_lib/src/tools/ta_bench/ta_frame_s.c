@@ -0,0 +1,2975 @@
+/* Note: This file is generated by gen_frame_s.py, do not
+ *       modify directly.
+ */
+
+/* Single precision frames for ta_bench: same as ta_frame.c but calling
+ * TA_S_XXX. The input pointers in the param holder point to float arrays
+ * and are cast back before the call.
+ */
+
+#include "ta_func.h"
+#include "ta_frame_priv.h"
+#include "ta_frame_s.h"
+
+static TA_RetCode TA_S_ACCBANDS_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ACCBANDS(
+                 startIdx,
+                 endIdx,
+                 (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                 (const float *)params->in[0].data.inPrice.low, /* inLow */
+                 (const float *)params->in[0].data.inPrice.close, /* inClose */
+                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                 outBegIdx, 
+                 outNBElement, 
+                 params->out[0].data.outReal, /*  outRealUpperBand */
+                 params->out[1].data.outReal, /*  outRealMiddleBand */
+                 params->out[2].data.outReal /*  outRealLowerBand */ );
+}
+
+static TA_RetCode TA_S_ACOS_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ACOS(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_AD_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_AD(
+           startIdx,
+           endIdx,
+           (const float *)params->in[0].data.inPrice.high, /* inHigh */
+           (const float *)params->in[0].data.inPrice.low, /* inLow */
+           (const float *)params->in[0].data.inPrice.close, /* inClose */
+           (const float *)params->in[0].data.inPrice.volume, /* inVolume */
+           outBegIdx, 
+           outNBElement, 
+           params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_ADD_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ADD(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal0 */
+            (const float *)params->in[1].data.inReal, /* inReal1 */
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_ADOSC_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ADOSC(
+              startIdx,
+              endIdx,
+              (const float *)params->in[0].data.inPrice.high, /* inHigh */
+              (const float *)params->in[0].data.inPrice.low, /* inLow */
+              (const float *)params->in[0].data.inPrice.close, /* inClose */
+              (const float *)params->in[0].data.inPrice.volume, /* inVolume */
+              params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+              params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
+              outBegIdx, 
+              outNBElement, 
+              params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_ADX_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ADX(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inPrice.high, /* inHigh */
+            (const float *)params->in[0].data.inPrice.low, /* inLow */
+            (const float *)params->in[0].data.inPrice.close, /* inClose */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_ADXR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ADXR(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inPrice.high, /* inHigh */
+             (const float *)params->in[0].data.inPrice.low, /* inLow */
+             (const float *)params->in[0].data.inPrice.close, /* inClose */
+             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_APO_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_APO(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+            params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
+            (TA_MAType)params->optIn[2].data.optInInteger, /* optInMAType*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_AROON_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_AROON(
+              startIdx,
+              endIdx,
+              (const float *)params->in[0].data.inPrice.high, /* inHigh */
+              (const float *)params->in[0].data.inPrice.low, /* inLow */
+              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+              outBegIdx, 
+              outNBElement, 
+              params->out[0].data.outReal, /*  outAroonDown */
+              params->out[1].data.outReal /*  outAroonUp */ );
+}
+
+static TA_RetCode TA_S_AROONOSC_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_AROONOSC(
+                 startIdx,
+                 endIdx,
+                 (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                 (const float *)params->in[0].data.inPrice.low, /* inLow */
+                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                 outBegIdx, 
+                 outNBElement, 
+                 params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_ASIN_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ASIN(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_ATAN_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ATAN(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_ATR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ATR(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inPrice.high, /* inHigh */
+            (const float *)params->in[0].data.inPrice.low, /* inLow */
+            (const float *)params->in[0].data.inPrice.close, /* inClose */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_AVGPRICE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_AVGPRICE(
+                 startIdx,
+                 endIdx,
+                 (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                 (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                 (const float *)params->in[0].data.inPrice.low, /* inLow */
+                 (const float *)params->in[0].data.inPrice.close, /* inClose */
+                 outBegIdx, 
+                 outNBElement, 
+                 params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_AVGDEV_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_AVGDEV(
+               startIdx,
+               endIdx,
+               (const float *)params->in[0].data.inReal, /* inReal */
+               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+               outBegIdx, 
+               outNBElement, 
+               params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_BBANDS_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_BBANDS(
+               startIdx,
+               endIdx,
+               (const float *)params->in[0].data.inReal, /* inReal */
+               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+               params->optIn[1].data.optInReal, /* optInNbDevUp*/
+               params->optIn[2].data.optInReal, /* optInNbDevDn*/
+               (TA_MAType)params->optIn[3].data.optInInteger, /* optInMAType*/
+               outBegIdx, 
+               outNBElement, 
+               params->out[0].data.outReal, /*  outRealUpperBand */
+               params->out[1].data.outReal, /*  outRealMiddleBand */
+               params->out[2].data.outReal /*  outRealLowerBand */ );
+}
+
+static TA_RetCode TA_S_BETA_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_BETA(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal0 */
+             (const float *)params->in[1].data.inReal, /* inReal1 */
+             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_BOP_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_BOP(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inPrice.open, /* inOpen */
+            (const float *)params->in[0].data.inPrice.high, /* inHigh */
+            (const float *)params->in[0].data.inPrice.low, /* inLow */
+            (const float *)params->in[0].data.inPrice.close, /* inClose */
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_CCI_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CCI(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inPrice.high, /* inHigh */
+            (const float *)params->in[0].data.inPrice.low, /* inLow */
+            (const float *)params->in[0].data.inPrice.close, /* inClose */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_CDL2CROWS_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDL2CROWS(
+                  startIdx,
+                  endIdx,
+                  (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                  (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                  (const float *)params->in[0].data.inPrice.low, /* inLow */
+                  (const float *)params->in[0].data.inPrice.close, /* inClose */
+                  outBegIdx, 
+                  outNBElement, 
+                  params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDL3BLACKCROWS_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDL3BLACKCROWS(
+                       startIdx,
+                       endIdx,
+                       (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                       (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                       (const float *)params->in[0].data.inPrice.low, /* inLow */
+                       (const float *)params->in[0].data.inPrice.close, /* inClose */
+                       outBegIdx, 
+                       outNBElement, 
+                       params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDL3INSIDE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDL3INSIDE(
+                   startIdx,
+                   endIdx,
+                   (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                   (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                   (const float *)params->in[0].data.inPrice.low, /* inLow */
+                   (const float *)params->in[0].data.inPrice.close, /* inClose */
+                   outBegIdx, 
+                   outNBElement, 
+                   params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDL3LINESTRIKE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDL3LINESTRIKE(
+                       startIdx,
+                       endIdx,
+                       (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                       (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                       (const float *)params->in[0].data.inPrice.low, /* inLow */
+                       (const float *)params->in[0].data.inPrice.close, /* inClose */
+                       outBegIdx, 
+                       outNBElement, 
+                       params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDL3OUTSIDE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDL3OUTSIDE(
+                    startIdx,
+                    endIdx,
+                    (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                    (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                    (const float *)params->in[0].data.inPrice.low, /* inLow */
+                    (const float *)params->in[0].data.inPrice.close, /* inClose */
+                    outBegIdx, 
+                    outNBElement, 
+                    params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDL3STARSINSOUTH_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDL3STARSINSOUTH(
+                         startIdx,
+                         endIdx,
+                         (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                         (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                         (const float *)params->in[0].data.inPrice.low, /* inLow */
+                         (const float *)params->in[0].data.inPrice.close, /* inClose */
+                         outBegIdx, 
+                         outNBElement, 
+                         params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDL3WHITESOLDIERS_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDL3WHITESOLDIERS(
+                          startIdx,
+                          endIdx,
+                          (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                          (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                          (const float *)params->in[0].data.inPrice.low, /* inLow */
+                          (const float *)params->in[0].data.inPrice.close, /* inClose */
+                          outBegIdx, 
+                          outNBElement, 
+                          params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLABANDONEDBABY_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLABANDONEDBABY(
+                         startIdx,
+                         endIdx,
+                         (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                         (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                         (const float *)params->in[0].data.inPrice.low, /* inLow */
+                         (const float *)params->in[0].data.inPrice.close, /* inClose */
+                         params->optIn[0].data.optInReal, /* optInPenetration*/
+                         outBegIdx, 
+                         outNBElement, 
+                         params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLADVANCEBLOCK_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLADVANCEBLOCK(
+                        startIdx,
+                        endIdx,
+                        (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                        (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                        (const float *)params->in[0].data.inPrice.low, /* inLow */
+                        (const float *)params->in[0].data.inPrice.close, /* inClose */
+                        outBegIdx, 
+                        outNBElement, 
+                        params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLBELTHOLD_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLBELTHOLD(
+                    startIdx,
+                    endIdx,
+                    (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                    (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                    (const float *)params->in[0].data.inPrice.low, /* inLow */
+                    (const float *)params->in[0].data.inPrice.close, /* inClose */
+                    outBegIdx, 
+                    outNBElement, 
+                    params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLBREAKAWAY_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLBREAKAWAY(
+                     startIdx,
+                     endIdx,
+                     (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                     (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                     (const float *)params->in[0].data.inPrice.low, /* inLow */
+                     (const float *)params->in[0].data.inPrice.close, /* inClose */
+                     outBegIdx, 
+                     outNBElement, 
+                     params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLCLOSINGMARUBOZU_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLCLOSINGMARUBOZU(
+                           startIdx,
+                           endIdx,
+                           (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                           (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                           (const float *)params->in[0].data.inPrice.low, /* inLow */
+                           (const float *)params->in[0].data.inPrice.close, /* inClose */
+                           outBegIdx, 
+                           outNBElement, 
+                           params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLCONCEALBABYSWALL_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLCONCEALBABYSWALL(
+                            startIdx,
+                            endIdx,
+                            (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                            (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                            (const float *)params->in[0].data.inPrice.low, /* inLow */
+                            (const float *)params->in[0].data.inPrice.close, /* inClose */
+                            outBegIdx, 
+                            outNBElement, 
+                            params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLCOUNTERATTACK_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLCOUNTERATTACK(
+                         startIdx,
+                         endIdx,
+                         (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                         (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                         (const float *)params->in[0].data.inPrice.low, /* inLow */
+                         (const float *)params->in[0].data.inPrice.close, /* inClose */
+                         outBegIdx, 
+                         outNBElement, 
+                         params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLDARKCLOUDCOVER_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLDARKCLOUDCOVER(
+                          startIdx,
+                          endIdx,
+                          (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                          (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                          (const float *)params->in[0].data.inPrice.low, /* inLow */
+                          (const float *)params->in[0].data.inPrice.close, /* inClose */
+                          params->optIn[0].data.optInReal, /* optInPenetration*/
+                          outBegIdx, 
+                          outNBElement, 
+                          params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLDOJI_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLDOJI(
+                startIdx,
+                endIdx,
+                (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                (const float *)params->in[0].data.inPrice.low, /* inLow */
+                (const float *)params->in[0].data.inPrice.close, /* inClose */
+                outBegIdx, 
+                outNBElement, 
+                params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLDOJISTAR(
+                    startIdx,
+                    endIdx,
+                    (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                    (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                    (const float *)params->in[0].data.inPrice.low, /* inLow */
+                    (const float *)params->in[0].data.inPrice.close, /* inClose */
+                    outBegIdx, 
+                    outNBElement, 
+                    params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLDRAGONFLYDOJI_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLDRAGONFLYDOJI(
+                         startIdx,
+                         endIdx,
+                         (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                         (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                         (const float *)params->in[0].data.inPrice.low, /* inLow */
+                         (const float *)params->in[0].data.inPrice.close, /* inClose */
+                         outBegIdx, 
+                         outNBElement, 
+                         params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLENGULFING_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLENGULFING(
+                     startIdx,
+                     endIdx,
+                     (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                     (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                     (const float *)params->in[0].data.inPrice.low, /* inLow */
+                     (const float *)params->in[0].data.inPrice.close, /* inClose */
+                     outBegIdx, 
+                     outNBElement, 
+                     params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLEVENINGDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLEVENINGDOJISTAR(
+                           startIdx,
+                           endIdx,
+                           (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                           (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                           (const float *)params->in[0].data.inPrice.low, /* inLow */
+                           (const float *)params->in[0].data.inPrice.close, /* inClose */
+                           params->optIn[0].data.optInReal, /* optInPenetration*/
+                           outBegIdx, 
+                           outNBElement, 
+                           params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLEVENINGSTAR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLEVENINGSTAR(
+                       startIdx,
+                       endIdx,
+                       (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                       (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                       (const float *)params->in[0].data.inPrice.low, /* inLow */
+                       (const float *)params->in[0].data.inPrice.close, /* inClose */
+                       params->optIn[0].data.optInReal, /* optInPenetration*/
+                       outBegIdx, 
+                       outNBElement, 
+                       params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLGAPSIDESIDEWHITE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLGAPSIDESIDEWHITE(
+                            startIdx,
+                            endIdx,
+                            (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                            (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                            (const float *)params->in[0].data.inPrice.low, /* inLow */
+                            (const float *)params->in[0].data.inPrice.close, /* inClose */
+                            outBegIdx, 
+                            outNBElement, 
+                            params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLGRAVESTONEDOJI_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLGRAVESTONEDOJI(
+                          startIdx,
+                          endIdx,
+                          (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                          (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                          (const float *)params->in[0].data.inPrice.low, /* inLow */
+                          (const float *)params->in[0].data.inPrice.close, /* inClose */
+                          outBegIdx, 
+                          outNBElement, 
+                          params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLHAMMER_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLHAMMER(
+                  startIdx,
+                  endIdx,
+                  (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                  (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                  (const float *)params->in[0].data.inPrice.low, /* inLow */
+                  (const float *)params->in[0].data.inPrice.close, /* inClose */
+                  outBegIdx, 
+                  outNBElement, 
+                  params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLHANGINGMAN_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLHANGINGMAN(
+                      startIdx,
+                      endIdx,
+                      (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                      (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                      (const float *)params->in[0].data.inPrice.low, /* inLow */
+                      (const float *)params->in[0].data.inPrice.close, /* inClose */
+                      outBegIdx, 
+                      outNBElement, 
+                      params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLHARAMI_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLHARAMI(
+                  startIdx,
+                  endIdx,
+                  (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                  (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                  (const float *)params->in[0].data.inPrice.low, /* inLow */
+                  (const float *)params->in[0].data.inPrice.close, /* inClose */
+                  outBegIdx, 
+                  outNBElement, 
+                  params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLHARAMICROSS_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLHARAMICROSS(
+                       startIdx,
+                       endIdx,
+                       (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                       (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                       (const float *)params->in[0].data.inPrice.low, /* inLow */
+                       (const float *)params->in[0].data.inPrice.close, /* inClose */
+                       outBegIdx, 
+                       outNBElement, 
+                       params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLHIGHWAVE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLHIGHWAVE(
+                    startIdx,
+                    endIdx,
+                    (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                    (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                    (const float *)params->in[0].data.inPrice.low, /* inLow */
+                    (const float *)params->in[0].data.inPrice.close, /* inClose */
+                    outBegIdx, 
+                    outNBElement, 
+                    params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLHIKKAKE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLHIKKAKE(
+                   startIdx,
+                   endIdx,
+                   (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                   (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                   (const float *)params->in[0].data.inPrice.low, /* inLow */
+                   (const float *)params->in[0].data.inPrice.close, /* inClose */
+                   outBegIdx, 
+                   outNBElement, 
+                   params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLHIKKAKEMOD_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLHIKKAKEMOD(
+                      startIdx,
+                      endIdx,
+                      (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                      (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                      (const float *)params->in[0].data.inPrice.low, /* inLow */
+                      (const float *)params->in[0].data.inPrice.close, /* inClose */
+                      outBegIdx, 
+                      outNBElement, 
+                      params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLHOMINGPIGEON_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLHOMINGPIGEON(
+                        startIdx,
+                        endIdx,
+                        (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                        (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                        (const float *)params->in[0].data.inPrice.low, /* inLow */
+                        (const float *)params->in[0].data.inPrice.close, /* inClose */
+                        outBegIdx, 
+                        outNBElement, 
+                        params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLIDENTICAL3CROWS_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLIDENTICAL3CROWS(
+                           startIdx,
+                           endIdx,
+                           (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                           (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                           (const float *)params->in[0].data.inPrice.low, /* inLow */
+                           (const float *)params->in[0].data.inPrice.close, /* inClose */
+                           outBegIdx, 
+                           outNBElement, 
+                           params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLINNECK_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLINNECK(
+                  startIdx,
+                  endIdx,
+                  (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                  (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                  (const float *)params->in[0].data.inPrice.low, /* inLow */
+                  (const float *)params->in[0].data.inPrice.close, /* inClose */
+                  outBegIdx, 
+                  outNBElement, 
+                  params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLINVERTEDHAMMER_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLINVERTEDHAMMER(
+                          startIdx,
+                          endIdx,
+                          (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                          (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                          (const float *)params->in[0].data.inPrice.low, /* inLow */
+                          (const float *)params->in[0].data.inPrice.close, /* inClose */
+                          outBegIdx, 
+                          outNBElement, 
+                          params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLKICKING_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLKICKING(
+                   startIdx,
+                   endIdx,
+                   (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                   (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                   (const float *)params->in[0].data.inPrice.low, /* inLow */
+                   (const float *)params->in[0].data.inPrice.close, /* inClose */
+                   outBegIdx, 
+                   outNBElement, 
+                   params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLKICKINGBYLENGTH_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLKICKINGBYLENGTH(
+                           startIdx,
+                           endIdx,
+                           (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                           (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                           (const float *)params->in[0].data.inPrice.low, /* inLow */
+                           (const float *)params->in[0].data.inPrice.close, /* inClose */
+                           outBegIdx, 
+                           outNBElement, 
+                           params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLLADDERBOTTOM_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLLADDERBOTTOM(
+                        startIdx,
+                        endIdx,
+                        (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                        (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                        (const float *)params->in[0].data.inPrice.low, /* inLow */
+                        (const float *)params->in[0].data.inPrice.close, /* inClose */
+                        outBegIdx, 
+                        outNBElement, 
+                        params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLLONGLEGGEDDOJI_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLLONGLEGGEDDOJI(
+                          startIdx,
+                          endIdx,
+                          (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                          (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                          (const float *)params->in[0].data.inPrice.low, /* inLow */
+                          (const float *)params->in[0].data.inPrice.close, /* inClose */
+                          outBegIdx, 
+                          outNBElement, 
+                          params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLLONGLINE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLLONGLINE(
+                    startIdx,
+                    endIdx,
+                    (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                    (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                    (const float *)params->in[0].data.inPrice.low, /* inLow */
+                    (const float *)params->in[0].data.inPrice.close, /* inClose */
+                    outBegIdx, 
+                    outNBElement, 
+                    params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLMARUBOZU_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLMARUBOZU(
+                    startIdx,
+                    endIdx,
+                    (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                    (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                    (const float *)params->in[0].data.inPrice.low, /* inLow */
+                    (const float *)params->in[0].data.inPrice.close, /* inClose */
+                    outBegIdx, 
+                    outNBElement, 
+                    params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLMATCHINGLOW_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLMATCHINGLOW(
+                       startIdx,
+                       endIdx,
+                       (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                       (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                       (const float *)params->in[0].data.inPrice.low, /* inLow */
+                       (const float *)params->in[0].data.inPrice.close, /* inClose */
+                       outBegIdx, 
+                       outNBElement, 
+                       params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLMATHOLD_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLMATHOLD(
+                   startIdx,
+                   endIdx,
+                   (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                   (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                   (const float *)params->in[0].data.inPrice.low, /* inLow */
+                   (const float *)params->in[0].data.inPrice.close, /* inClose */
+                   params->optIn[0].data.optInReal, /* optInPenetration*/
+                   outBegIdx, 
+                   outNBElement, 
+                   params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLMORNINGDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLMORNINGDOJISTAR(
+                           startIdx,
+                           endIdx,
+                           (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                           (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                           (const float *)params->in[0].data.inPrice.low, /* inLow */
+                           (const float *)params->in[0].data.inPrice.close, /* inClose */
+                           params->optIn[0].data.optInReal, /* optInPenetration*/
+                           outBegIdx, 
+                           outNBElement, 
+                           params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLMORNINGSTAR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLMORNINGSTAR(
+                       startIdx,
+                       endIdx,
+                       (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                       (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                       (const float *)params->in[0].data.inPrice.low, /* inLow */
+                       (const float *)params->in[0].data.inPrice.close, /* inClose */
+                       params->optIn[0].data.optInReal, /* optInPenetration*/
+                       outBegIdx, 
+                       outNBElement, 
+                       params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLONNECK_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLONNECK(
+                  startIdx,
+                  endIdx,
+                  (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                  (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                  (const float *)params->in[0].data.inPrice.low, /* inLow */
+                  (const float *)params->in[0].data.inPrice.close, /* inClose */
+                  outBegIdx, 
+                  outNBElement, 
+                  params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLPIERCING_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLPIERCING(
+                    startIdx,
+                    endIdx,
+                    (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                    (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                    (const float *)params->in[0].data.inPrice.low, /* inLow */
+                    (const float *)params->in[0].data.inPrice.close, /* inClose */
+                    outBegIdx, 
+                    outNBElement, 
+                    params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLRICKSHAWMAN_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLRICKSHAWMAN(
+                       startIdx,
+                       endIdx,
+                       (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                       (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                       (const float *)params->in[0].data.inPrice.low, /* inLow */
+                       (const float *)params->in[0].data.inPrice.close, /* inClose */
+                       outBegIdx, 
+                       outNBElement, 
+                       params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLRISEFALL3METHODS_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLRISEFALL3METHODS(
+                            startIdx,
+                            endIdx,
+                            (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                            (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                            (const float *)params->in[0].data.inPrice.low, /* inLow */
+                            (const float *)params->in[0].data.inPrice.close, /* inClose */
+                            outBegIdx, 
+                            outNBElement, 
+                            params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLSEPARATINGLINES_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLSEPARATINGLINES(
+                           startIdx,
+                           endIdx,
+                           (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                           (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                           (const float *)params->in[0].data.inPrice.low, /* inLow */
+                           (const float *)params->in[0].data.inPrice.close, /* inClose */
+                           outBegIdx, 
+                           outNBElement, 
+                           params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLSHOOTINGSTAR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLSHOOTINGSTAR(
+                        startIdx,
+                        endIdx,
+                        (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                        (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                        (const float *)params->in[0].data.inPrice.low, /* inLow */
+                        (const float *)params->in[0].data.inPrice.close, /* inClose */
+                        outBegIdx, 
+                        outNBElement, 
+                        params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLSHORTLINE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLSHORTLINE(
+                     startIdx,
+                     endIdx,
+                     (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                     (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                     (const float *)params->in[0].data.inPrice.low, /* inLow */
+                     (const float *)params->in[0].data.inPrice.close, /* inClose */
+                     outBegIdx, 
+                     outNBElement, 
+                     params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLSPINNINGTOP_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLSPINNINGTOP(
+                       startIdx,
+                       endIdx,
+                       (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                       (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                       (const float *)params->in[0].data.inPrice.low, /* inLow */
+                       (const float *)params->in[0].data.inPrice.close, /* inClose */
+                       outBegIdx, 
+                       outNBElement, 
+                       params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLSTALLEDPATTERN_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLSTALLEDPATTERN(
+                          startIdx,
+                          endIdx,
+                          (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                          (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                          (const float *)params->in[0].data.inPrice.low, /* inLow */
+                          (const float *)params->in[0].data.inPrice.close, /* inClose */
+                          outBegIdx, 
+                          outNBElement, 
+                          params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLSTICKSANDWICH_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLSTICKSANDWICH(
+                         startIdx,
+                         endIdx,
+                         (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                         (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                         (const float *)params->in[0].data.inPrice.low, /* inLow */
+                         (const float *)params->in[0].data.inPrice.close, /* inClose */
+                         outBegIdx, 
+                         outNBElement, 
+                         params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLTAKURI_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLTAKURI(
+                  startIdx,
+                  endIdx,
+                  (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                  (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                  (const float *)params->in[0].data.inPrice.low, /* inLow */
+                  (const float *)params->in[0].data.inPrice.close, /* inClose */
+                  outBegIdx, 
+                  outNBElement, 
+                  params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLTASUKIGAP_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLTASUKIGAP(
+                     startIdx,
+                     endIdx,
+                     (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                     (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                     (const float *)params->in[0].data.inPrice.low, /* inLow */
+                     (const float *)params->in[0].data.inPrice.close, /* inClose */
+                     outBegIdx, 
+                     outNBElement, 
+                     params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLTHRUSTING_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLTHRUSTING(
+                     startIdx,
+                     endIdx,
+                     (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                     (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                     (const float *)params->in[0].data.inPrice.low, /* inLow */
+                     (const float *)params->in[0].data.inPrice.close, /* inClose */
+                     outBegIdx, 
+                     outNBElement, 
+                     params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLTRISTAR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLTRISTAR(
+                   startIdx,
+                   endIdx,
+                   (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                   (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                   (const float *)params->in[0].data.inPrice.low, /* inLow */
+                   (const float *)params->in[0].data.inPrice.close, /* inClose */
+                   outBegIdx, 
+                   outNBElement, 
+                   params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLUNIQUE3RIVER_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLUNIQUE3RIVER(
+                        startIdx,
+                        endIdx,
+                        (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                        (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                        (const float *)params->in[0].data.inPrice.low, /* inLow */
+                        (const float *)params->in[0].data.inPrice.close, /* inClose */
+                        outBegIdx, 
+                        outNBElement, 
+                        params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLUPSIDEGAP2CROWS_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLUPSIDEGAP2CROWS(
+                           startIdx,
+                           endIdx,
+                           (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                           (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                           (const float *)params->in[0].data.inPrice.low, /* inLow */
+                           (const float *)params->in[0].data.inPrice.close, /* inClose */
+                           outBegIdx, 
+                           outNBElement, 
+                           params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CDLXSIDEGAP3METHODS_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CDLXSIDEGAP3METHODS(
+                            startIdx,
+                            endIdx,
+                            (const float *)params->in[0].data.inPrice.open, /* inOpen */
+                            (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                            (const float *)params->in[0].data.inPrice.low, /* inLow */
+                            (const float *)params->in[0].data.inPrice.close, /* inClose */
+                            outBegIdx, 
+                            outNBElement, 
+                            params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_CEIL_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CEIL(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_CMO_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CMO(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_CORREL_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_CORREL(
+               startIdx,
+               endIdx,
+               (const float *)params->in[0].data.inReal, /* inReal0 */
+               (const float *)params->in[1].data.inReal, /* inReal1 */
+               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+               outBegIdx, 
+               outNBElement, 
+               params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_COS_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_COS(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_COSH_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_COSH(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_DEMA_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_DEMA(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_DIV_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_DIV(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal0 */
+            (const float *)params->in[1].data.inReal, /* inReal1 */
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_DX_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_DX(
+           startIdx,
+           endIdx,
+           (const float *)params->in[0].data.inPrice.high, /* inHigh */
+           (const float *)params->in[0].data.inPrice.low, /* inLow */
+           (const float *)params->in[0].data.inPrice.close, /* inClose */
+           params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+           outBegIdx, 
+           outNBElement, 
+           params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_EMA_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_EMA(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_EXP_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_EXP(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_FLOOR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_FLOOR(
+              startIdx,
+              endIdx,
+              (const float *)params->in[0].data.inReal, /* inReal */
+              outBegIdx, 
+              outNBElement, 
+              params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_HT_DCPERIOD_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_HT_DCPERIOD(
+                    startIdx,
+                    endIdx,
+                    (const float *)params->in[0].data.inReal, /* inReal */
+                    outBegIdx, 
+                    outNBElement, 
+                    params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_HT_DCPHASE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_HT_DCPHASE(
+                   startIdx,
+                   endIdx,
+                   (const float *)params->in[0].data.inReal, /* inReal */
+                   outBegIdx, 
+                   outNBElement, 
+                   params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_HT_PHASOR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_HT_PHASOR(
+                  startIdx,
+                  endIdx,
+                  (const float *)params->in[0].data.inReal, /* inReal */
+                  outBegIdx, 
+                  outNBElement, 
+                  params->out[0].data.outReal, /*  outInPhase */
+                  params->out[1].data.outReal /*  outQuadrature */ );
+}
+
+static TA_RetCode TA_S_HT_SINE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_HT_SINE(
+                startIdx,
+                endIdx,
+                (const float *)params->in[0].data.inReal, /* inReal */
+                outBegIdx, 
+                outNBElement, 
+                params->out[0].data.outReal, /*  outSine */
+                params->out[1].data.outReal /*  outLeadSine */ );
+}
+
+static TA_RetCode TA_S_HT_TRENDLINE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_HT_TRENDLINE(
+                     startIdx,
+                     endIdx,
+                     (const float *)params->in[0].data.inReal, /* inReal */
+                     outBegIdx, 
+                     outNBElement, 
+                     params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_HT_TRENDMODE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_HT_TRENDMODE(
+                     startIdx,
+                     endIdx,
+                     (const float *)params->in[0].data.inReal, /* inReal */
+                     outBegIdx, 
+                     outNBElement, 
+                     params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_IMI_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_IMI(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inPrice.open, /* inOpen */
+            (const float *)params->in[0].data.inPrice.close, /* inClose */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_KAMA_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_KAMA(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_LINEARREG_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_LINEARREG(
+                  startIdx,
+                  endIdx,
+                  (const float *)params->in[0].data.inReal, /* inReal */
+                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                  outBegIdx, 
+                  outNBElement, 
+                  params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_LINEARREG_ANGLE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_LINEARREG_ANGLE(
+                        startIdx,
+                        endIdx,
+                        (const float *)params->in[0].data.inReal, /* inReal */
+                        params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                        outBegIdx, 
+                        outNBElement, 
+                        params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_LINEARREG_INTERCEPT_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_LINEARREG_INTERCEPT(
+                            startIdx,
+                            endIdx,
+                            (const float *)params->in[0].data.inReal, /* inReal */
+                            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                            outBegIdx, 
+                            outNBElement, 
+                            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_LINEARREG_SLOPE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_LINEARREG_SLOPE(
+                        startIdx,
+                        endIdx,
+                        (const float *)params->in[0].data.inReal, /* inReal */
+                        params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                        outBegIdx, 
+                        outNBElement, 
+                        params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_LN_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_LN(
+           startIdx,
+           endIdx,
+           (const float *)params->in[0].data.inReal, /* inReal */
+           outBegIdx, 
+           outNBElement, 
+           params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_LOG10_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_LOG10(
+              startIdx,
+              endIdx,
+              (const float *)params->in[0].data.inReal, /* inReal */
+              outBegIdx, 
+              outNBElement, 
+              params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_MA_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MA(
+           startIdx,
+           endIdx,
+           (const float *)params->in[0].data.inReal, /* inReal */
+           params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+           (TA_MAType)params->optIn[1].data.optInInteger, /* optInMAType*/
+           outBegIdx, 
+           outNBElement, 
+           params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_MACD_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MACD(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+             params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
+             params->optIn[2].data.optInInteger, /* optInSignalPeriod*/
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal, /*  outMACD */
+             params->out[1].data.outReal, /*  outMACDSignal */
+             params->out[2].data.outReal /*  outMACDHist */ );
+}
+
+static TA_RetCode TA_S_MACDEXT_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MACDEXT(
+                startIdx,
+                endIdx,
+                (const float *)params->in[0].data.inReal, /* inReal */
+                params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+                (TA_MAType)params->optIn[1].data.optInInteger, /* optInFastMAType*/
+                params->optIn[2].data.optInInteger, /* optInSlowPeriod*/
+                (TA_MAType)params->optIn[3].data.optInInteger, /* optInSlowMAType*/
+                params->optIn[4].data.optInInteger, /* optInSignalPeriod*/
+                (TA_MAType)params->optIn[5].data.optInInteger, /* optInSignalMAType*/
+                outBegIdx, 
+                outNBElement, 
+                params->out[0].data.outReal, /*  outMACD */
+                params->out[1].data.outReal, /*  outMACDSignal */
+                params->out[2].data.outReal /*  outMACDHist */ );
+}
+
+static TA_RetCode TA_S_MACDFIX_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MACDFIX(
+                startIdx,
+                endIdx,
+                (const float *)params->in[0].data.inReal, /* inReal */
+                params->optIn[0].data.optInInteger, /* optInSignalPeriod*/
+                outBegIdx, 
+                outNBElement, 
+                params->out[0].data.outReal, /*  outMACD */
+                params->out[1].data.outReal, /*  outMACDSignal */
+                params->out[2].data.outReal /*  outMACDHist */ );
+}
+
+static TA_RetCode TA_S_MAMA_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MAMA(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             params->optIn[0].data.optInReal, /* optInFastLimit*/
+             params->optIn[1].data.optInReal, /* optInSlowLimit*/
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal, /*  outMAMA */
+             params->out[1].data.outReal /*  outFAMA */ );
+}
+
+static TA_RetCode TA_S_MAVP_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MAVP(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             (const float *)params->in[1].data.inReal, /* inPeriods */
+             params->optIn[0].data.optInInteger, /* optInMinPeriod*/
+             params->optIn[1].data.optInInteger, /* optInMaxPeriod*/
+             (TA_MAType)params->optIn[2].data.optInInteger, /* optInMAType*/
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_MAX_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MAX(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_MAXINDEX_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MAXINDEX(
+                 startIdx,
+                 endIdx,
+                 (const float *)params->in[0].data.inReal, /* inReal */
+                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                 outBegIdx, 
+                 outNBElement, 
+                 params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_MEDPRICE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MEDPRICE(
+                 startIdx,
+                 endIdx,
+                 (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                 (const float *)params->in[0].data.inPrice.low, /* inLow */
+                 outBegIdx, 
+                 outNBElement, 
+                 params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_MFI_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MFI(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inPrice.high, /* inHigh */
+            (const float *)params->in[0].data.inPrice.low, /* inLow */
+            (const float *)params->in[0].data.inPrice.close, /* inClose */
+            (const float *)params->in[0].data.inPrice.volume, /* inVolume */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_MIDPOINT_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MIDPOINT(
+                 startIdx,
+                 endIdx,
+                 (const float *)params->in[0].data.inReal, /* inReal */
+                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                 outBegIdx, 
+                 outNBElement, 
+                 params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_MIDPRICE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MIDPRICE(
+                 startIdx,
+                 endIdx,
+                 (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                 (const float *)params->in[0].data.inPrice.low, /* inLow */
+                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                 outBegIdx, 
+                 outNBElement, 
+                 params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_MIN_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MIN(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_MININDEX_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MININDEX(
+                 startIdx,
+                 endIdx,
+                 (const float *)params->in[0].data.inReal, /* inReal */
+                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                 outBegIdx, 
+                 outNBElement, 
+                 params->out[0].data.outInteger /*  outInteger */ );
+}
+
+static TA_RetCode TA_S_MINMAX_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MINMAX(
+               startIdx,
+               endIdx,
+               (const float *)params->in[0].data.inReal, /* inReal */
+               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+               outBegIdx, 
+               outNBElement, 
+               params->out[0].data.outReal, /*  outMin */
+               params->out[1].data.outReal /*  outMax */ );
+}
+
+static TA_RetCode TA_S_MINMAXINDEX_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MINMAXINDEX(
+                    startIdx,
+                    endIdx,
+                    (const float *)params->in[0].data.inReal, /* inReal */
+                    params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                    outBegIdx, 
+                    outNBElement, 
+                    params->out[0].data.outInteger, /*  outMinIdx */
+                    params->out[1].data.outInteger /*  outMaxIdx */ );
+}
+
+static TA_RetCode TA_S_MINUS_DI_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MINUS_DI(
+                 startIdx,
+                 endIdx,
+                 (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                 (const float *)params->in[0].data.inPrice.low, /* inLow */
+                 (const float *)params->in[0].data.inPrice.close, /* inClose */
+                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                 outBegIdx, 
+                 outNBElement, 
+                 params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_MINUS_DM_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MINUS_DM(
+                 startIdx,
+                 endIdx,
+                 (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                 (const float *)params->in[0].data.inPrice.low, /* inLow */
+                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                 outBegIdx, 
+                 outNBElement, 
+                 params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_MOM_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MOM(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_MULT_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_MULT(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal0 */
+             (const float *)params->in[1].data.inReal, /* inReal1 */
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_NATR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_NATR(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inPrice.high, /* inHigh */
+             (const float *)params->in[0].data.inPrice.low, /* inLow */
+             (const float *)params->in[0].data.inPrice.close, /* inClose */
+             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_OBV_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_OBV(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            (const float *)params->in[1].data.inPrice.volume, /* inVolume */
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_PLUS_DI_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_PLUS_DI(
+                startIdx,
+                endIdx,
+                (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                (const float *)params->in[0].data.inPrice.low, /* inLow */
+                (const float *)params->in[0].data.inPrice.close, /* inClose */
+                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                outBegIdx, 
+                outNBElement, 
+                params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_PLUS_DM_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_PLUS_DM(
+                startIdx,
+                endIdx,
+                (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                (const float *)params->in[0].data.inPrice.low, /* inLow */
+                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                outBegIdx, 
+                outNBElement, 
+                params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_PPO_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_PPO(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+            params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
+            (TA_MAType)params->optIn[2].data.optInInteger, /* optInMAType*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_ROC_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ROC(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_ROCP_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ROCP(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_ROCR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ROCR(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_ROCR100_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ROCR100(
+                startIdx,
+                endIdx,
+                (const float *)params->in[0].data.inReal, /* inReal */
+                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                outBegIdx, 
+                outNBElement, 
+                params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_RSI_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_RSI(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_SAR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_SAR(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inPrice.high, /* inHigh */
+            (const float *)params->in[0].data.inPrice.low, /* inLow */
+            params->optIn[0].data.optInReal, /* optInAcceleration*/
+            params->optIn[1].data.optInReal, /* optInMaximum*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_SAREXT_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_SAREXT(
+               startIdx,
+               endIdx,
+               (const float *)params->in[0].data.inPrice.high, /* inHigh */
+               (const float *)params->in[0].data.inPrice.low, /* inLow */
+               params->optIn[0].data.optInReal, /* optInStartValue*/
+               params->optIn[1].data.optInReal, /* optInOffsetOnReverse*/
+               params->optIn[2].data.optInReal, /* optInAccelerationInitLong*/
+               params->optIn[3].data.optInReal, /* optInAccelerationLong*/
+               params->optIn[4].data.optInReal, /* optInAccelerationMaxLong*/
+               params->optIn[5].data.optInReal, /* optInAccelerationInitShort*/
+               params->optIn[6].data.optInReal, /* optInAccelerationShort*/
+               params->optIn[7].data.optInReal, /* optInAccelerationMaxShort*/
+               outBegIdx, 
+               outNBElement, 
+               params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_SIN_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_SIN(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_SINH_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_SINH(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_SMA_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_SMA(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_SQRT_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_SQRT(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_STDDEV_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_STDDEV(
+               startIdx,
+               endIdx,
+               (const float *)params->in[0].data.inReal, /* inReal */
+               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+               params->optIn[1].data.optInReal, /* optInNbDev*/
+               outBegIdx, 
+               outNBElement, 
+               params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_STOCH_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_STOCH(
+              startIdx,
+              endIdx,
+              (const float *)params->in[0].data.inPrice.high, /* inHigh */
+              (const float *)params->in[0].data.inPrice.low, /* inLow */
+              (const float *)params->in[0].data.inPrice.close, /* inClose */
+              params->optIn[0].data.optInInteger, /* optInFastK_Period*/
+              params->optIn[1].data.optInInteger, /* optInSlowK_Period*/
+              (TA_MAType)params->optIn[2].data.optInInteger, /* optInSlowK_MAType*/
+              params->optIn[3].data.optInInteger, /* optInSlowD_Period*/
+              (TA_MAType)params->optIn[4].data.optInInteger, /* optInSlowD_MAType*/
+              outBegIdx, 
+              outNBElement, 
+              params->out[0].data.outReal, /*  outSlowK */
+              params->out[1].data.outReal /*  outSlowD */ );
+}
+
+static TA_RetCode TA_S_STOCHF_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_STOCHF(
+               startIdx,
+               endIdx,
+               (const float *)params->in[0].data.inPrice.high, /* inHigh */
+               (const float *)params->in[0].data.inPrice.low, /* inLow */
+               (const float *)params->in[0].data.inPrice.close, /* inClose */
+               params->optIn[0].data.optInInteger, /* optInFastK_Period*/
+               params->optIn[1].data.optInInteger, /* optInFastD_Period*/
+               (TA_MAType)params->optIn[2].data.optInInteger, /* optInFastD_MAType*/
+               outBegIdx, 
+               outNBElement, 
+               params->out[0].data.outReal, /*  outFastK */
+               params->out[1].data.outReal /*  outFastD */ );
+}
+
+static TA_RetCode TA_S_STOCHRSI_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_STOCHRSI(
+                 startIdx,
+                 endIdx,
+                 (const float *)params->in[0].data.inReal, /* inReal */
+                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+                 params->optIn[1].data.optInInteger, /* optInFastK_Period*/
+                 params->optIn[2].data.optInInteger, /* optInFastD_Period*/
+                 (TA_MAType)params->optIn[3].data.optInInteger, /* optInFastD_MAType*/
+                 outBegIdx, 
+                 outNBElement, 
+                 params->out[0].data.outReal, /*  outFastK */
+                 params->out[1].data.outReal /*  outFastD */ );
+}
+
+static TA_RetCode TA_S_SUB_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_SUB(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal0 */
+            (const float *)params->in[1].data.inReal, /* inReal1 */
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_SUM_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_SUM(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_T3_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_T3(
+           startIdx,
+           endIdx,
+           (const float *)params->in[0].data.inReal, /* inReal */
+           params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+           params->optIn[1].data.optInReal, /* optInVFactor*/
+           outBegIdx, 
+           outNBElement, 
+           params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_TAN_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_TAN(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_TANH_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_TANH(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_TEMA_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_TEMA(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_TRANGE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_TRANGE(
+               startIdx,
+               endIdx,
+               (const float *)params->in[0].data.inPrice.high, /* inHigh */
+               (const float *)params->in[0].data.inPrice.low, /* inLow */
+               (const float *)params->in[0].data.inPrice.close, /* inClose */
+               outBegIdx, 
+               outNBElement, 
+               params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_TRIMA_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_TRIMA(
+              startIdx,
+              endIdx,
+              (const float *)params->in[0].data.inReal, /* inReal */
+              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+              outBegIdx, 
+              outNBElement, 
+              params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_TRIX_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_TRIX(
+             startIdx,
+             endIdx,
+             (const float *)params->in[0].data.inReal, /* inReal */
+             params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+             outBegIdx, 
+             outNBElement, 
+             params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_TSF_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_TSF(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_TYPPRICE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_TYPPRICE(
+                 startIdx,
+                 endIdx,
+                 (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                 (const float *)params->in[0].data.inPrice.low, /* inLow */
+                 (const float *)params->in[0].data.inPrice.close, /* inClose */
+                 outBegIdx, 
+                 outNBElement, 
+                 params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_ULTOSC_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_ULTOSC(
+               startIdx,
+               endIdx,
+               (const float *)params->in[0].data.inPrice.high, /* inHigh */
+               (const float *)params->in[0].data.inPrice.low, /* inLow */
+               (const float *)params->in[0].data.inPrice.close, /* inClose */
+               params->optIn[0].data.optInInteger, /* optInTimePeriod1*/
+               params->optIn[1].data.optInInteger, /* optInTimePeriod2*/
+               params->optIn[2].data.optInInteger, /* optInTimePeriod3*/
+               outBegIdx, 
+               outNBElement, 
+               params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_VAR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_VAR(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            params->optIn[1].data.optInReal, /* optInNbDev*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_WCLPRICE_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_WCLPRICE(
+                 startIdx,
+                 endIdx,
+                 (const float *)params->in[0].data.inPrice.high, /* inHigh */
+                 (const float *)params->in[0].data.inPrice.low, /* inLow */
+                 (const float *)params->in[0].data.inPrice.close, /* inClose */
+                 outBegIdx, 
+                 outNBElement, 
+                 params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_WILLR_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_WILLR(
+              startIdx,
+              endIdx,
+              (const float *)params->in[0].data.inPrice.high, /* inHigh */
+              (const float *)params->in[0].data.inPrice.low, /* inLow */
+              (const float *)params->in[0].data.inPrice.close, /* inClose */
+              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+              outBegIdx, 
+              outNBElement, 
+              params->out[0].data.outReal /*  outReal */ );
+}
+
+static TA_RetCode TA_S_WMA_FramePP( const TA_ParamHolderPriv *params,
+                                 int startIdx,
+                                 int endIdx,
+                                 int *outBegIdx,
+                                 int *outNBElement )
+{
+   return TA_S_WMA(
+            startIdx,
+            endIdx,
+            (const float *)params->in[0].data.inReal, /* inReal */
+            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+            outBegIdx, 
+            outNBElement, 
+            params->out[0].data.outReal /*  outReal */ );
+}
+
+const TA_FrameS TA_FramesS[] =
+{
+   { "ACCBANDS", TA_S_ACCBANDS_FramePP },
+   { "ACOS", TA_S_ACOS_FramePP },
+   { "AD", TA_S_AD_FramePP },
+   { "ADD", TA_S_ADD_FramePP },
+   { "ADOSC", TA_S_ADOSC_FramePP },
+   { "ADX", TA_S_ADX_FramePP },
+   { "ADXR", TA_S_ADXR_FramePP },
+   { "APO", TA_S_APO_FramePP },
+   { "AROON", TA_S_AROON_FramePP },
+   { "AROONOSC", TA_S_AROONOSC_FramePP },
+   { "ASIN", TA_S_ASIN_FramePP },
+   { "ATAN", TA_S_ATAN_FramePP },
+   { "ATR", TA_S_ATR_FramePP },
+   { "AVGPRICE", TA_S_AVGPRICE_FramePP },
+   { "AVGDEV", TA_S_AVGDEV_FramePP },
+   { "BBANDS", TA_S_BBANDS_FramePP },
+   { "BETA", TA_S_BETA_FramePP },
+   { "BOP", TA_S_BOP_FramePP },
+   { "CCI", TA_S_CCI_FramePP },
+   { "CDL2CROWS", TA_S_CDL2CROWS_FramePP },
+   { "CDL3BLACKCROWS", TA_S_CDL3BLACKCROWS_FramePP },
+   { "CDL3INSIDE", TA_S_CDL3INSIDE_FramePP },
+   { "CDL3LINESTRIKE", TA_S_CDL3LINESTRIKE_FramePP },
+   { "CDL3OUTSIDE", TA_S_CDL3OUTSIDE_FramePP },
+   { "CDL3STARSINSOUTH", TA_S_CDL3STARSINSOUTH_FramePP },
+   { "CDL3WHITESOLDIERS", TA_S_CDL3WHITESOLDIERS_FramePP },
+   { "CDLABANDONEDBABY", TA_S_CDLABANDONEDBABY_FramePP },
+   { "CDLADVANCEBLOCK", TA_S_CDLADVANCEBLOCK_FramePP },
+   { "CDLBELTHOLD", TA_S_CDLBELTHOLD_FramePP },
+   { "CDLBREAKAWAY", TA_S_CDLBREAKAWAY_FramePP },
+   { "CDLCLOSINGMARUBOZU", TA_S_CDLCLOSINGMARUBOZU_FramePP },
+   { "CDLCONCEALBABYSWALL", TA_S_CDLCONCEALBABYSWALL_FramePP },
+   { "CDLCOUNTERATTACK", TA_S_CDLCOUNTERATTACK_FramePP },
+   { "CDLDARKCLOUDCOVER", TA_S_CDLDARKCLOUDCOVER_FramePP },
+   { "CDLDOJI", TA_S_CDLDOJI_FramePP },
+   { "CDLDOJISTAR", TA_S_CDLDOJISTAR_FramePP },
+   { "CDLDRAGONFLYDOJI", TA_S_CDLDRAGONFLYDOJI_FramePP },
+   { "CDLENGULFING", TA_S_CDLENGULFING_FramePP },
+   { "CDLEVENINGDOJISTAR", TA_S_CDLEVENINGDOJISTAR_FramePP },
+   { "CDLEVENINGSTAR", TA_S_CDLEVENINGSTAR_FramePP },
+   { "CDLGAPSIDESIDEWHITE", TA_S_CDLGAPSIDESIDEWHITE_FramePP },
+   { "CDLGRAVESTONEDOJI", TA_S_CDLGRAVESTONEDOJI_FramePP },
+   { "CDLHAMMER", TA_S_CDLHAMMER_FramePP },
+   { "CDLHANGINGMAN", TA_S_CDLHANGINGMAN_FramePP },
+   { "CDLHARAMI", TA_S_CDLHARAMI_FramePP },
+   { "CDLHARAMICROSS", TA_S_CDLHARAMICROSS_FramePP },
+   { "CDLHIGHWAVE", TA_S_CDLHIGHWAVE_FramePP },
+   { "CDLHIKKAKE", TA_S_CDLHIKKAKE_FramePP },
+   { "CDLHIKKAKEMOD", TA_S_CDLHIKKAKEMOD_FramePP },
+   { "CDLHOMINGPIGEON", TA_S_CDLHOMINGPIGEON_FramePP },
+   { "CDLIDENTICAL3CROWS", TA_S_CDLIDENTICAL3CROWS_FramePP },
+   { "CDLINNECK", TA_S_CDLINNECK_FramePP },
+   { "CDLINVERTEDHAMMER", TA_S_CDLINVERTEDHAMMER_FramePP },
+   { "CDLKICKING", TA_S_CDLKICKING_FramePP },
+   { "CDLKICKINGBYLENGTH", TA_S_CDLKICKINGBYLENGTH_FramePP },
+   { "CDLLADDERBOTTOM", TA_S_CDLLADDERBOTTOM_FramePP },
+   { "CDLLONGLEGGEDDOJI", TA_S_CDLLONGLEGGEDDOJI_FramePP },
+   { "CDLLONGLINE", TA_S_CDLLONGLINE_FramePP },
+   { "CDLMARUBOZU", TA_S_CDLMARUBOZU_FramePP },
+   { "CDLMATCHINGLOW", TA_S_CDLMATCHINGLOW_FramePP },
+   { "CDLMATHOLD", TA_S_CDLMATHOLD_FramePP },
+   { "CDLMORNINGDOJISTAR", TA_S_CDLMORNINGDOJISTAR_FramePP },
+   { "CDLMORNINGSTAR", TA_S_CDLMORNINGSTAR_FramePP },
+   { "CDLONNECK", TA_S_CDLONNECK_FramePP },
+   { "CDLPIERCING", TA_S_CDLPIERCING_FramePP },
+   { "CDLRICKSHAWMAN", TA_S_CDLRICKSHAWMAN_FramePP },
+   { "CDLRISEFALL3METHODS", TA_S_CDLRISEFALL3METHODS_FramePP },
+   { "CDLSEPARATINGLINES", TA_S_CDLSEPARATINGLINES_FramePP },
+   { "CDLSHOOTINGSTAR", TA_S_CDLSHOOTINGSTAR_FramePP },
+   { "CDLSHORTLINE", TA_S_CDLSHORTLINE_FramePP },
+   { "CDLSPINNINGTOP", TA_S_CDLSPINNINGTOP_FramePP },
+   { "CDLSTALLEDPATTERN", TA_S_CDLSTALLEDPATTERN_FramePP },
+   { "CDLSTICKSANDWICH", TA_S_CDLSTICKSANDWICH_FramePP },
+   { "CDLTAKURI", TA_S_CDLTAKURI_FramePP },
+   { "CDLTASUKIGAP", TA_S_CDLTASUKIGAP_FramePP },
+   { "CDLTHRUSTING", TA_S_CDLTHRUSTING_FramePP },
+   { "CDLTRISTAR", TA_S_CDLTRISTAR_FramePP },
+   { "CDLUNIQUE3RIVER", TA_S_CDLUNIQUE3RIVER_FramePP },
+   { "CDLUPSIDEGAP2CROWS", TA_S_CDLUPSIDEGAP2CROWS_FramePP },
+   { "CDLXSIDEGAP3METHODS", TA_S_CDLXSIDEGAP3METHODS_FramePP },
+   { "CEIL", TA_S_CEIL_FramePP },
+   { "CMO", TA_S_CMO_FramePP },
+   { "CORREL", TA_S_CORREL_FramePP },
+   { "COS", TA_S_COS_FramePP },
+   { "COSH", TA_S_COSH_FramePP },
+   { "DEMA", TA_S_DEMA_FramePP },
+   { "DIV", TA_S_DIV_FramePP },
+   { "DX", TA_S_DX_FramePP },
+   { "EMA", TA_S_EMA_FramePP },
+   { "EXP", TA_S_EXP_FramePP },
+   { "FLOOR", TA_S_FLOOR_FramePP },
+   { "HT_DCPERIOD", TA_S_HT_DCPERIOD_FramePP },
+   { "HT_DCPHASE", TA_S_HT_DCPHASE_FramePP },
+   { "HT_PHASOR", TA_S_HT_PHASOR_FramePP },
+   { "HT_SINE", TA_S_HT_SINE_FramePP },
+   { "HT_TRENDLINE", TA_S_HT_TRENDLINE_FramePP },
+   { "HT_TRENDMODE", TA_S_HT_TRENDMODE_FramePP },
+   { "IMI", TA_S_IMI_FramePP },
+   { "KAMA", TA_S_KAMA_FramePP },
+   { "LINEARREG", TA_S_LINEARREG_FramePP },
+   { "LINEARREG_ANGLE", TA_S_LINEARREG_ANGLE_FramePP },
+   { "LINEARREG_INTERCEPT", TA_S_LINEARREG_INTERCEPT_FramePP },
+   { "LINEARREG_SLOPE", TA_S_LINEARREG_SLOPE_FramePP },
+   { "LN", TA_S_LN_FramePP },
+   { "LOG10", TA_S_LOG10_FramePP },
+   { "MA", TA_S_MA_FramePP },
+   { "MACD", TA_S_MACD_FramePP },
+   { "MACDEXT", TA_S_MACDEXT_FramePP },
+   { "MACDFIX", TA_S_MACDFIX_FramePP },
+   { "MAMA", TA_S_MAMA_FramePP },
+   { "MAVP", TA_S_MAVP_FramePP },
+   { "MAX", TA_S_MAX_FramePP },
+   { "MAXINDEX", TA_S_MAXINDEX_FramePP },
+   { "MEDPRICE", TA_S_MEDPRICE_FramePP },
+   { "MFI", TA_S_MFI_FramePP },
+   { "MIDPOINT", TA_S_MIDPOINT_FramePP },
+   { "MIDPRICE", TA_S_MIDPRICE_FramePP },
+   { "MIN", TA_S_MIN_FramePP },
+   { "MININDEX", TA_S_MININDEX_FramePP },
+   { "MINMAX", TA_S_MINMAX_FramePP },
+   { "MINMAXINDEX", TA_S_MINMAXINDEX_FramePP },
+   { "MINUS_DI", TA_S_MINUS_DI_FramePP },
+   { "MINUS_DM", TA_S_MINUS_DM_FramePP },
+   { "MOM", TA_S_MOM_FramePP },
+   { "MULT", TA_S_MULT_FramePP },
+   { "NATR", TA_S_NATR_FramePP },
+   { "OBV", TA_S_OBV_FramePP },
+   { "PLUS_DI", TA_S_PLUS_DI_FramePP },
+   { "PLUS_DM", TA_S_PLUS_DM_FramePP },
+   { "PPO", TA_S_PPO_FramePP },
+   { "ROC", TA_S_ROC_FramePP },
+   { "ROCP", TA_S_ROCP_FramePP },
+   { "ROCR", TA_S_ROCR_FramePP },
+   { "ROCR100", TA_S_ROCR100_FramePP },
+   { "RSI", TA_S_RSI_FramePP },
+   { "SAR", TA_S_SAR_FramePP },
+   { "SAREXT", TA_S_SAREXT_FramePP },
+   { "SIN", TA_S_SIN_FramePP },
+   { "SINH", TA_S_SINH_FramePP },
+   { "SMA", TA_S_SMA_FramePP },
+   { "SQRT", TA_S_SQRT_FramePP },
+   { "STDDEV", TA_S_STDDEV_FramePP },
+   { "STOCH", TA_S_STOCH_FramePP },
+   { "STOCHF", TA_S_STOCHF_FramePP },
+   { "STOCHRSI", TA_S_STOCHRSI_FramePP },
+   { "SUB", TA_S_SUB_FramePP },
+   { "SUM", TA_S_SUM_FramePP },
+   { "T3", TA_S_T3_FramePP },
+   { "TAN", TA_S_TAN_FramePP },
+   { "TANH", TA_S_TANH_FramePP },
+   { "TEMA", TA_S_TEMA_FramePP },
+   { "TRANGE", TA_S_TRANGE_FramePP },
+   { "TRIMA", TA_S_TRIMA_FramePP },
+   { "TRIX", TA_S_TRIX_FramePP },
+   { "TSF", TA_S_TSF_FramePP },
+   { "TYPPRICE", TA_S_TYPPRICE_FramePP },
+   { "ULTOSC", TA_S_ULTOSC_FramePP },
+   { "VAR", TA_S_VAR_FramePP },
+   { "WCLPRICE", TA_S_WCLPRICE_FramePP },
+   { "WILLR", TA_S_WILLR_FramePP },
+   { "WMA", TA_S_WMA_FramePP },
+};
+
+const unsigned int TA_FramesSCount = 161;
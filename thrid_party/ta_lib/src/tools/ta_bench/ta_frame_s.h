@@ -0,0 +1,27 @@
+#ifndef TA_FRAME_S_H
+#define TA_FRAME_S_H
+
+#ifndef TA_FRAME_PRIV_H
+   #include "ta_frame_priv.h"
+#endif
+
+/* Single precision counterpart of the TA_XXX_FramePP functions, see
+ * gen_frame_s.py. The float input arrays are stored in the param holder
+ * in place of the TA_Real pointers.
+ */
+typedef TA_RetCode (*TA_FrameSFunction)( const TA_ParamHolderPriv *params,
+                                         int startIdx,
+                                         int endIdx,
+                                         int *outBegIdx,
+                                         int *outNBElement );
+
+typedef struct
+{
+   const char *name;
+   TA_FrameSFunction function;
+} TA_FrameS;
+
+extern const TA_FrameS TA_FramesS[];
+extern const unsigned int TA_FramesSCount;
+
+#endif